@@ -122,6 +122,18 @@ function(core_add_test_library name)
   endforeach()
 endfunction()
 
+# Add sources to the micro-benchmark executable
+# Implicit arguments:
+#   BENCH_SOURCES the sources of the benchmarks
+# On return:
+#   Benchmark sources will be added to ${APP_NAME_LC}-bench
+function(core_add_bench_sources)
+  foreach(src IN LISTS BENCH_SOURCES)
+    get_filename_component(src_path "${src}" ABSOLUTE)
+    set(bench_sources "${src_path}" ${bench_sources} CACHE STRING "" FORCE)
+  endforeach()
+endfunction()
+
 # Add addon dev kit headers to main application
 # Arguments:
 #   name name of the header part to add
@@ -139,6 +139,13 @@ else()
   message(STATUS "include/linux/dma-buf.h not found")
 endif()
 
+check_include_files("linux/io_uring.h" HAVE_LINUX_IO_URING)
+if(HAVE_LINUX_IO_URING)
+  list(APPEND ARCH_DEFINES "-DHAVE_LINUX_IO_URING=1")
+else()
+  message(STATUS "include/linux/io_uring.h not found")
+endif()
+
 include(CheckSymbolExists)
 set(CMAKE_REQUIRED_DEFINITIONS "-D_GNU_SOURCE")
 check_symbol_exists("mkostemp" "stdlib.h" HAVE_MKOSTEMP)
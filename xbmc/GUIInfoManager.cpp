@@ -1764,6 +1764,78 @@ constexpr std::array<InfoMap, 10> weather = {{
 ///     @return The current rendering speed (frames per second).
 ///     <p>
 ///   }
+///   \table_row3{   <b>`System.FrameTimeP50`</b>,
+///                  \anchor System_FrameTimeP50
+///                  _string_,
+///     @return The median duration of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_FrameTimeP50 `System.FrameTimeP50`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.FrameTimeP95`</b>,
+///                  \anchor System_FrameTimeP95
+///                  _string_,
+///     @return The 95th percentile of the duration of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_FrameTimeP95 `System.FrameTimeP95`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.FrameTimeP99`</b>,
+///                  \anchor System_FrameTimeP99
+///                  _string_,
+///     @return The 99th percentile of the duration of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_FrameTimeP99 `System.FrameTimeP99`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.FrameTimeMax`</b>,
+///                  \anchor System_FrameTimeMax
+///                  _string_,
+///     @return The longest duration of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_FrameTimeMax `System.FrameTimeMax`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.MissedVsyncs`</b>,
+///                  \anchor System_MissedVsyncs
+///                  _string_,
+///     @return The number of frames since startup which took longer than one and a half display refresh intervals.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_MissedVsyncs `System.MissedVsyncs`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.ProcessTime`</b>,
+///                  \anchor System_ProcessTime
+///                  _string_,
+///     @return The average time per frame spent processing messages and jobs of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_ProcessTime `System.ProcessTime`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.FrameMoveTime`</b>,
+///                  \anchor System_FrameMoveTime
+///                  _string_,
+///     @return The average time per frame spent processing input and animating the GUI of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_FrameMoveTime `System.FrameMoveTime`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.RenderTime`</b>,
+///                  \anchor System_RenderTime
+///                  _string_,
+///     @return The average time per frame spent rendering of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_RenderTime `System.RenderTime`\endlink
+///     <p>
+///   }
+///   \table_row3{   <b>`System.SwapTime`</b>,
+///                  \anchor System_SwapTime
+///                  _string_,
+///     @return The average time per frame spent presenting the frame (swapping buffers) of the recent frames in milliseconds.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link System_SwapTime `System.SwapTime`\endlink
+///     <p>
+///   }
 ///   \table_row3{   <b>`System.FreeMemory`</b>,
 ///                  \anchor System_FreeMemory
 ///                  _string_,
@@ -2025,7 +2097,7 @@ constexpr std::array<InfoMap, 10> weather = {{
 ///     <p>
 ///   }
 // clang-format off
-constexpr std::array<InfoMap, 76> system_labels = {{
+constexpr std::array<InfoMap, 85> system_labels = {{
     {"hasnetwork",              SYSTEM_ETHERNET_LINK_ACTIVE},
     {"hasmediadvd",             SYSTEM_MEDIA_DVD},
     {"hasmediaaudiocd",         SYSTEM_MEDIA_AUDIO_CD},
@@ -2063,6 +2135,15 @@ constexpr std::array<InfoMap, 76> system_labels = {{
     {"buildversiongit",         SYSTEM_BUILD_VERSION_GIT},
     {"builddate",               SYSTEM_BUILD_DATE},
     {"fps",                     SYSTEM_FPS},
+    {"frametimep50",            SYSTEM_FRAMETIME_P50},
+    {"frametimep95",            SYSTEM_FRAMETIME_P95},
+    {"frametimep99",            SYSTEM_FRAMETIME_P99},
+    {"frametimemax",            SYSTEM_FRAMETIME_MAX},
+    {"missedvsyncs",            SYSTEM_MISSED_VSYNCS},
+    {"processtime",             SYSTEM_PROCESS_TIME},
+    {"framemovetime",           SYSTEM_FRAMEMOVE_TIME},
+    {"rendertime",              SYSTEM_RENDER_TIME},
+    {"swaptime",                SYSTEM_SWAP_TIME},
     {"freememory",              SYSTEM_FREE_MEMORY},
     {"language",                SYSTEM_LANGUAGE},
     {"temperatureunits",        SYSTEM_TEMPERATURE_UNITS},
@@ -151,3 +151,9 @@ constexpr const int GUI_MSG_PLAYBACK_PAUSED = GUI_MSG_USER + 47;
 constexpr const int GUI_MSG_PLAYBACK_RESUMED = GUI_MSG_USER + 48;
 constexpr const int GUI_MSG_PLAYBACK_SEEKED = GUI_MSG_USER + 49;
 constexpr const int GUI_MSG_PLAYBACK_SPEED_CHANGED = GUI_MSG_USER + 50;
+
+// Sent to media windows with a batch of items of a directory still being listed
+//  Parameter:
+//  Param1 = Listing the items belong to
+//  Item = CFileItemList with the items
+constexpr const int GUI_MSG_DIRECTORY_ITEMS = GUI_MSG_USER + 51;
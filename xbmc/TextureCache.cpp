@@ -29,17 +29,27 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <mutex>
 #include <optional>
 #include <string.h>
+#include <thread>
 
 using namespace XFILE;
 using namespace std::chrono_literals;
 
+namespace
+{
+// video files decoded at once to generate images
+constexpr unsigned int MAX_GENERATED_IMAGE_JOBS = 4;
+} // unnamed namespace
+
 CTextureCache::CTextureCache()
-  : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE), m_cleanTimer{[this]() { CleanTimer(); }}
+  : CJobQueue(false, 1, CJob::PRIORITY_LOW_PAUSABLE),
+    m_cleanTimer{[this]() { CleanTimer(); }},
+    m_generatedImageQueue(*this)
 {
 }
 
@@ -57,6 +67,7 @@ void CTextureCache::Deinitialize()
 {
   m_cleanTimer.Stop(true);
   CancelJobs();
+  m_generatedImageQueue.CancelJobs();
 
   std::unique_lock lock(m_databaseSection);
   m_database.Close();
@@ -132,7 +143,10 @@ void CTextureCache::BackgroundCacheImage(const std::string &url)
     return;
 
   // needs (re)caching
-  AddJob(new CTextureCacheJob(path, details.hash));
+  if (IMAGE_FILES::CImageFileURL(path).GetSpecialType() == "video")
+    m_generatedImageQueue.AddJob(new CTextureCacheJob(path, details.hash));
+  else
+    AddJob(new CTextureCacheJob(path, details.hash));
 }
 
 bool CTextureCache::StartCacheImage(const std::string& image)
@@ -328,6 +342,23 @@ void CTextureCache::OnJobComplete(unsigned int jobID, bool success, CJob *job)
   return CJobQueue::OnJobComplete(jobID, success, job);
 }
 
+CTextureCache::CGeneratedImageQueue::CGeneratedImageQueue(CTextureCache& cache)
+  : CJobQueue(false,
+              std::clamp(std::thread::hardware_concurrency() / 2, 1u, MAX_GENERATED_IMAGE_JOBS),
+              CJob::PRIORITY_LOW_PAUSABLE),
+    m_cache(cache)
+{
+}
+
+void CTextureCache::CGeneratedImageQueue::OnJobComplete(unsigned int jobID,
+                                                        bool success,
+                                                        CJob* job)
+{
+  if (strcmp(job->GetType(), CTextureCacheJob::JOB_TYPE_CACHE_IMAGE) == 0)
+    m_cache.OnCachingComplete(success, static_cast<CTextureCacheJob*>(job));
+  return CJobQueue::OnJobComplete(jobID, success, job);
+}
+
 bool CTextureCache::Export(const std::string &image, const std::string &destination, bool overwrite)
 {
   CTextureDetails details;
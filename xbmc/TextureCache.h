@@ -241,5 +241,20 @@ private:
   CEvent               m_completeEvent; ///< Set whenever a job has finished
   std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
   CCriticalSection             m_useCountSection;
+
+  /*! \brief Queue for images generated by decoding video files.
+   Decoding takes long enough to run a few of these jobs in parallel, without holding up the caching
+   of other images. Memory used by the decoders is bounded by CDVDFileInfo.
+   */
+  class CGeneratedImageQueue : public CJobQueue
+  {
+  public:
+    explicit CGeneratedImageQueue(CTextureCache& cache);
+    void OnJobComplete(unsigned int jobID, bool success, CJob* job) override;
+
+  private:
+    CTextureCache& m_cache;
+  };
+  CGeneratedImageQueue m_generatedImageQueue;
 };
 
@@ -7,43 +7,67 @@
  */
 #include "FilesystemInstaller.h"
 
-#include "FileItem.h"
-#include "FileItemList.h"
 #include "filesystem/Directory.h"
 #include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
-#include "utils/FileOperationJob.h"
+#include "filesystem/ZipManager.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <string_view>
+#include <vector>
+
 using namespace XFILE;
 
 namespace
 {
-bool UnpackArchive(std::string path, const std::string& dest)
+bool UnpackArchive(const std::string& path, const std::string& dest)
 {
-  if (!URIUtils::IsProtocol(path, "zip"))
-    path = URIUtils::CreateArchivePath("zip", CURL(path), "").Get();
+  CURL archive(path);
+  std::string root;
+  if (archive.IsProtocol("zip"))
+  {
+    root = archive.GetFileName();
+    archive = CURL(archive.GetHostName());
+  }
 
-  CFileItemList files;
-  if (!CDirectory::GetDirectory(path, files, "", DIR_FLAG_DEFAULTS))
+  std::vector<SZipEntry> entries;
+  if (!g_ZipManager.GetZipList(URIUtils::CreateArchivePath("zip", archive, root), entries))
     return false;
 
-  if (files.Size() == 1 && files[0]->IsFolder())
+  // add-on archives usually hold a single folder named after the add-on, only its content is
+  // unpacked then
+  const std::string prefix = root.empty() ? "" : URIUtils::AddFileToFolder(root, "");
+  std::string folder;
+  bool singleFolder = true;
+  for (const auto& entry : entries)
   {
-    path = files[0]->GetPath();
-    files.Clear();
-    if (!CDirectory::GetDirectory(path, files, "", DIR_FLAG_DEFAULTS))
-      return false;
+    const std::string_view name(entry.name);
+    if (!name.starts_with(prefix))
+      continue;
+
+    // the directory entry of the sub folder itself
+    const std::string_view relative = name.substr(prefix.size());
+    if (relative.empty())
+      continue;
+
+    const size_t slash = relative.find('/');
+    if (slash == std::string_view::npos || (!folder.empty() && relative.substr(0, slash) != folder))
+    {
+      singleFolder = false;
+      break;
+    }
+    folder = relative.substr(0, slash);
   }
-  CLog::Log(LOGDEBUG, "Unpacking {} to {}", path, dest);
+  if (singleFolder && !folder.empty())
+    root = URIUtils::AddFileToFolder(root, folder);
 
-  for (auto i = 0; i < files.Size(); ++i)
-    files[i]->Select(true);
+  CLog::Log(LOGDEBUG, "Unpacking {}/{} to {}", archive.GetRedacted(), root, dest);
 
-  CFileOperationJob job(CFileOperationJob::ActionCopy, files, dest);
-  return job.DoWork();
+  // entries are inflated straight from the archive in one pass, instead of opening each file
+  // through the zip:// protocol
+  return g_ZipManager.ExtractArchive(archive, dest, root);
 }
 } // unnamed namespace
 
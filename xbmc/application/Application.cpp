@@ -40,6 +40,7 @@
 #include "application/AppInboundProtocol.h"
 #include "application/AppParams.h"
 #include "application/ApplicationActionListeners.h"
+#include "application/ApplicationFrameStatistics.h"
 #include "application/ApplicationMessageHandling.h"
 #include "application/ApplicationPlay.h"
 #include "application/ApplicationPlayer.h"
@@ -235,10 +236,13 @@ CApplication::CApplication(void)
   RegisterComponent(std::make_shared<CApplicationSkinHandling>(this, this, m_bInitializing));
   RegisterComponent(std::make_shared<CApplicationVolumeHandling>());
   RegisterComponent(std::make_shared<CApplicationStackHelper>());
+  m_frameStatistics = std::make_shared<CApplicationFrameStatistics>();
+  RegisterComponent(m_frameStatistics);
 }
 
 CApplication::~CApplication(void)
 {
+  DeregisterComponent(typeid(CApplicationFrameStatistics));
   DeregisterComponent(typeid(CApplicationStackHelper));
   DeregisterComponent(typeid(CApplicationVolumeHandling));
   DeregisterComponent(typeid(CApplicationSkinHandling));
@@ -289,6 +293,12 @@ bool CApplication::Create()
   appMessenger->SetGUIThread(CThread::GetCurrentThreadId());
   appMessenger->SetProcessThread(CThread::GetCurrentThreadId());
 
+  // bursts of these, e.g. from remotes, only need the latest value applied
+  appMessenger->SetCoalescing(TMSG_SET_VOLUME);
+  appMessenger->SetCoalescing(TMSG_VOLUME_SHOW);
+  appMessenger->SetCoalescing(TMSG_MEDIA_SEEK_TIME);
+  appMessenger->SetCoalescing(TMSG_RESETSCREENSAVER);
+
   // copy required files
   CUtil::CopyUserDataIfNeeded("special://masterprofile/", "RssFeeds.xml");
   CUtil::CopyUserDataIfNeeded("special://masterprofile/", "favourites.xml");
@@ -321,6 +331,9 @@ bool CApplication::Create()
   if (!settingsComponent->Load())
     return false;
 
+  CServiceBroker::GetJobManager()->SetWorkStealing(
+      settingsComponent->GetAdvancedSettings()->m_jobManagerWorkStealing);
+
   // Log Cache GUI settings (replacement of cache in advancedsettings.xml)
   const auto settings = settingsComponent->GetSettings();
   const float readFactor = settings->GetInt(CSettings::SETTING_FILECACHE_READFACTOR) / 100.0f;
@@ -847,6 +860,7 @@ void CApplication::Render()
     appPower->ResetScreenSaver();
   }
 
+  const auto renderStart = std::chrono::steady_clock::now();
   if (!CServiceBroker::GetRenderSystem()->BeginRender())
     return;
 
@@ -901,9 +915,15 @@ void CApplication::Render()
     infoMgr.GetInfoProviders().GetSystemInfoProvider().UpdateFPS();
   }
 
+  const auto swapStart = std::chrono::steady_clock::now();
+  m_frameStatistics->AddStage(CApplicationFrameStatistics::Stage::RENDER, swapStart - renderStart);
+
   CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
                                                        appPlayer->IsRenderingVideoLayer());
 
+  m_frameStatistics->AddStage(CApplicationFrameStatistics::Stage::SWAP,
+                              std::chrono::steady_clock::now() - swapStart);
+
   CTimeUtils::UpdateFrameTime(hasRendered);
 
   // [debug hack] count gui-on-screen frames vs total played and skipped
@@ -1630,18 +1650,28 @@ int CApplication::Run()
   {
     // Animate and render a frame
 
+    m_frameStatistics->BeginFrame();
     lastFrameTime = std::chrono::steady_clock::now();
     Process();
 
+    auto stageEnd = std::chrono::steady_clock::now();
+    m_frameStatistics->AddStage(CApplicationFrameStatistics::Stage::PROCESS,
+                                stageEnd - lastFrameTime);
+
     bool renderGUI = GetComponent<CApplicationPowerHandling>()->GetRenderGUI();
     if (!m_bStop)
     {
+      const auto stageStart = stageEnd;
       FrameMove(true, renderGUI);
+      stageEnd = std::chrono::steady_clock::now();
+      m_frameStatistics->AddStage(CApplicationFrameStatistics::Stage::FRAME_MOVE,
+                                  stageEnd - stageStart);
     }
 
     if (renderGUI && !m_bStop)
     {
       Render();
+      m_frameStatistics->EndFrame(CServiceBroker::GetWinSystem()->GetGfxContext().GetFPS());
     }
     else if (!renderGUI)
     {
@@ -28,6 +28,7 @@
 #include <vector>
 
 class CAction;
+class CApplicationFrameStatistics;
 class CApplicationMessageHandling;
 class CBookmark;
 class CFileItem;
@@ -225,6 +226,8 @@ protected:
 
   std::chrono::time_point<std::chrono::steady_clock> m_lastRenderTime;
   bool m_skipGuiRender = false;
+  std::shared_ptr<CApplicationFrameStatistics>
+      m_frameStatistics; /*!< Frame statistics component, recorded by every frame */
 
   std::unique_ptr<MUSIC_INFO::CMusicInfoScanner> m_musicInfoScanner;
 
@@ -0,0 +1,159 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ApplicationFrameStatistics.h"
+
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <mutex>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+double ToMilliseconds(std::chrono::steady_clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// a frame counts as missed vsync if it took longer than this many refresh intervals
+constexpr double MissedVsyncFactor = 1.5;
+} // unnamed namespace
+
+CApplicationFrameStatistics::CApplicationFrameStatistics()
+{
+  m_frames.reserve(WINDOW);
+}
+
+void CApplicationFrameStatistics::BeginFrame()
+{
+  m_current = {};
+  m_frameStart = clock::now();
+  m_inFrame = true;
+}
+
+void CApplicationFrameStatistics::AddStage(Stage stage, clock::duration duration)
+{
+  m_current.stages[static_cast<size_t>(stage)] += duration;
+}
+
+void CApplicationFrameStatistics::EndFrame(float refreshRate)
+{
+  if (m_inFrame)
+    EndFrame(clock::now() - m_frameStart, refreshRate);
+}
+
+void CApplicationFrameStatistics::EndFrame(clock::duration duration, float refreshRate)
+{
+  if (!m_inFrame)
+    return;
+
+  m_inFrame = false;
+  m_current.total = duration;
+
+  std::unique_lock lock(m_section);
+  if (m_frames.size() < WINDOW)
+    m_frames.emplace_back(m_current);
+  else
+    m_frames[m_next] = m_current;
+  m_next = (m_next + 1) % WINDOW;
+
+  ++m_frameCount;
+  if (refreshRate > 0.0f &&
+      ToMilliseconds(m_current.total) > MissedVsyncFactor * 1000.0 / refreshRate)
+    ++m_missedVsyncs;
+}
+
+CApplicationFrameStatistics::Summary CApplicationFrameStatistics::GetSummary() const
+{
+  std::unique_lock lock(m_section);
+
+  const auto now = clock::now();
+  if (!m_summaryValid || now - m_summaryTime >= 1s)
+  {
+    m_summary = CalculateSummary();
+    m_summaryTime = now;
+    m_summaryValid = true;
+  }
+  return m_summary;
+}
+
+CApplicationFrameStatistics::Summary CApplicationFrameStatistics::CalculateSummary() const
+{
+  Summary summary;
+  summary.frames = m_frameCount;
+  summary.missedVsyncs = m_missedVsyncs;
+  if (m_frames.empty())
+    return summary;
+
+  std::vector<clock::duration> totals;
+  totals.reserve(m_frames.size());
+  std::array<clock::duration, STAGES> stageTotals{};
+  for (const auto& frame : m_frames)
+  {
+    totals.emplace_back(frame.total);
+    for (size_t stage = 0; stage < STAGES; ++stage)
+      stageTotals[stage] += frame.stages[stage];
+  }
+
+  const auto percentile = [&totals](double percent)
+  {
+    const auto nth = totals.begin() + static_cast<ptrdiff_t>((totals.size() - 1) * percent / 100.0);
+    std::nth_element(totals.begin(), nth, totals.end());
+    return ToMilliseconds(*nth);
+  };
+  summary.p50Ms = percentile(50);
+  summary.p95Ms = percentile(95);
+  summary.p99Ms = percentile(99);
+  summary.maxMs = ToMilliseconds(*std::ranges::max_element(totals));
+
+  for (size_t stage = 0; stage < STAGES; ++stage)
+    summary.stageAverageMs[stage] = ToMilliseconds(stageTotals[stage]) / m_frames.size();
+
+  return summary;
+}
+
+void CApplicationFrameStatistics::Reset()
+{
+  std::unique_lock lock(m_section);
+  m_frames.clear();
+  m_next = 0;
+  m_frameCount = 0;
+  m_missedVsyncs = 0;
+  m_summaryValid = false;
+}
+
+void CApplicationFrameStatistics::Serialize(CVariant& value) const
+{
+  const Summary summary = GetSummary();
+  value["frames"] = summary.frames;
+  value["missedvsyncs"] = summary.missedVsyncs;
+  value["p50ms"] = summary.p50Ms;
+  value["p95ms"] = summary.p95Ms;
+  value["p99ms"] = summary.p99Ms;
+  value["maxms"] = summary.maxMs;
+  for (size_t stage = 0; stage < STAGES; ++stage)
+    value["stages"][GetStageName(static_cast<Stage>(stage))] = summary.stageAverageMs[stage];
+}
+
+const char* CApplicationFrameStatistics::GetStageName(Stage stage)
+{
+  switch (stage)
+  {
+    case Stage::PROCESS:
+      return "process";
+    case Stage::FRAME_MOVE:
+      return "framemove";
+    case Stage::RENDER:
+      return "render";
+    case Stage::SWAP:
+      return "swap";
+  }
+  return "";
+}
@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "application/IApplicationComponent.h"
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+class CVariant;
+
+/*!
+ * \brief Class collecting frame time statistics of the application render loop.
+ *
+ * Keeps the durations of the most recent frames, split into the stages of a frame, and counts
+ * frames which took longer than the display refresh interval allows. Statistics are always on,
+ * recording a frame only takes a few clock reads.
+ */
+class CApplicationFrameStatistics : public IApplicationComponent
+{
+public:
+  enum class Stage
+  {
+    PROCESS,
+    FRAME_MOVE,
+    RENDER,
+    SWAP,
+  };
+  static constexpr size_t STAGES = 4;
+
+  //! number of frames percentiles and averages are calculated over
+  static constexpr size_t WINDOW = 1024;
+
+  struct Summary
+  {
+    uint64_t frames{0}; //!< frames since start or last reset
+    uint64_t missedVsyncs{0}; //!< frames since start or last reset exceeding 1.5 refresh intervals
+    double p50Ms{0.0};
+    double p95Ms{0.0};
+    double p99Ms{0.0};
+    double maxMs{0.0};
+    std::array<double, STAGES> stageAverageMs{};
+  };
+
+  CApplicationFrameStatistics();
+
+  void BeginFrame();
+  void AddStage(Stage stage, std::chrono::steady_clock::duration duration);
+
+  /*!
+   * \brief Finish the current frame.
+   * \param refreshRate refresh rate of the display in Hz, 0 if unknown
+   */
+  void EndFrame(float refreshRate);
+
+  /*!
+   * \brief Finish the current frame with a duration measured by the caller.
+   * \param duration total time of the frame
+   * \param refreshRate refresh rate of the display in Hz, 0 if unknown
+   */
+  void EndFrame(std::chrono::steady_clock::duration duration, float refreshRate);
+
+  /*!
+   * \brief Get the statistics over the recent frames. The result is cached for a second, so this
+   * is cheap enough to be polled by info labels every frame.
+   */
+  Summary GetSummary() const;
+
+  void Reset();
+
+  void Serialize(CVariant& value) const;
+
+  static const char* GetStageName(Stage stage);
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  struct Frame
+  {
+    clock::duration total{};
+    std::array<clock::duration, STAGES> stages{};
+  };
+
+  Summary CalculateSummary() const;
+
+  mutable CCriticalSection m_section;
+  std::vector<Frame> m_frames;
+  size_t m_next{0};
+  uint64_t m_frameCount{0};
+  uint64_t m_missedVsyncs{0};
+
+  // only used by the rendering thread
+  Frame m_current;
+  clock::time_point m_frameStart;
+  bool m_inFrame{false};
+
+  mutable Summary m_summary;
+  mutable clock::time_point m_summaryTime;
+  mutable bool m_summaryValid{false};
+};
@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "application/ApplicationFrameStatistics.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+using Stage = CApplicationFrameStatistics::Stage;
+
+constexpr float REFRESH_RATE = 60.0f;
+
+void AddFrame(CApplicationFrameStatistics& stats, std::chrono::milliseconds duration)
+{
+  stats.BeginFrame();
+  stats.AddStage(Stage::RENDER, 2ms);
+  stats.AddStage(Stage::SWAP, duration - 2ms);
+  stats.EndFrame(duration, REFRESH_RATE);
+}
+} // namespace
+
+TEST(TestApplicationFrameStatistics, Percentiles)
+{
+  CApplicationFrameStatistics stats;
+  // frames of 100 ms down to 1 ms, out of order
+  for (int i = 100; i > 0; --i)
+    AddFrame(stats, std::chrono::milliseconds(i));
+
+  const auto summary = stats.GetSummary();
+  EXPECT_EQ(100u, summary.frames);
+  EXPECT_DOUBLE_EQ(50.0, summary.p50Ms);
+  EXPECT_DOUBLE_EQ(95.0, summary.p95Ms);
+  EXPECT_DOUBLE_EQ(99.0, summary.p99Ms);
+  EXPECT_DOUBLE_EQ(100.0, summary.maxMs);
+  EXPECT_DOUBLE_EQ(2.0, summary.stageAverageMs[static_cast<size_t>(Stage::RENDER)]);
+  EXPECT_DOUBLE_EQ(48.5, summary.stageAverageMs[static_cast<size_t>(Stage::SWAP)]);
+  EXPECT_DOUBLE_EQ(0.0, summary.stageAverageMs[static_cast<size_t>(Stage::PROCESS)]);
+}
+
+TEST(TestApplicationFrameStatistics, MissedVsyncs)
+{
+  CApplicationFrameStatistics stats;
+  // at 60 Hz a frame misses vsync above 1.5 refresh intervals, i.e. 25 ms
+  AddFrame(stats, 16ms);
+  AddFrame(stats, 25ms);
+  AddFrame(stats, 26ms);
+  AddFrame(stats, 40ms);
+  AddFrame(stats, 100ms);
+
+  // unknown refresh rate doesn't count missed vsyncs
+  stats.BeginFrame();
+  stats.EndFrame(100ms, 0.0f);
+
+  const auto summary = stats.GetSummary();
+  EXPECT_EQ(6u, summary.frames);
+  EXPECT_EQ(3u, summary.missedVsyncs);
+}
+
+TEST(TestApplicationFrameStatistics, WindowKeepsRecentFrames)
+{
+  CApplicationFrameStatistics stats;
+  for (size_t i = 0; i < CApplicationFrameStatistics::WINDOW; ++i)
+    AddFrame(stats, 100ms);
+  for (size_t i = 0; i < CApplicationFrameStatistics::WINDOW; ++i)
+    AddFrame(stats, 10ms);
+
+  const auto summary = stats.GetSummary();
+  EXPECT_EQ(2 * CApplicationFrameStatistics::WINDOW, summary.frames);
+  EXPECT_EQ(CApplicationFrameStatistics::WINDOW, summary.missedVsyncs);
+  EXPECT_DOUBLE_EQ(10.0, summary.p99Ms);
+  EXPECT_DOUBLE_EQ(10.0, summary.maxMs);
+}
+
+TEST(TestApplicationFrameStatistics, Reset)
+{
+  CApplicationFrameStatistics stats;
+  AddFrame(stats, 100ms);
+  EXPECT_EQ(1u, stats.GetSummary().missedVsyncs);
+
+  stats.Reset();
+  AddFrame(stats, 10ms);
+
+  const auto summary = stats.GetSummary();
+  EXPECT_EQ(1u, summary.frames);
+  EXPECT_EQ(0u, summary.missedVsyncs);
+  EXPECT_DOUBLE_EQ(10.0, summary.p50Ms);
+}
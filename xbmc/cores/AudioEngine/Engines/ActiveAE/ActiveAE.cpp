@@ -21,6 +21,7 @@
 #include "cores/DataCacheCore.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/TraceEvents.h"
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
@@ -1955,6 +1956,7 @@ void CActiveAE::UnconfigureSink()
 
 bool CActiveAE::RunStages()
 {
+  KODI_TRACE_SCOPE("audio", "CActiveAE::RunStages");
   bool busy = false;
 
   // serve input streams
@@ -2647,6 +2649,7 @@ CSampleBuffer* CActiveAE::SyncStream(CActiveAEStream *stream)
 
 void CActiveAE::MixSounds(CSoundPacket &dstSample)
 {
+  KODI_TRACE_SCOPE("audio", "CActiveAE::MixSounds");
   if (m_sounds_playing.empty())
     return;
 
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAEBuffer.h"
+#include "cores/AudioEngine/Utils/AEAudioFormat.h"
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace ActiveAE;
+
+namespace
+{
+AEAudioFormat MakeFormat()
+{
+  AEAudioFormat format;
+  format.m_dataFormat = AE_FMT_FLOATP;
+  format.m_sampleRate = 48000;
+  format.m_channelLayout = AE_CH_LAYOUT_5_1;
+  format.m_frames = 1024;
+  format.m_frameSize = format.m_channelLayout.Count() * sizeof(float);
+  return format;
+}
+} // unnamed namespace
+
+static void BM_ActiveAEBufferPool_Create(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    CActiveAEBufferPool pool(MakeFormat());
+    benchmark::DoNotOptimize(pool.Create(static_cast<unsigned int>(state.range(0))));
+  }
+}
+BENCHMARK(BM_ActiveAEBufferPool_Create)->Arg(100)->Arg(500);
+
+static void BM_ActiveAEBufferPool_GetReturn(benchmark::State& state)
+{
+  CActiveAEBufferPool pool(MakeFormat());
+  pool.Create(500);
+
+  const auto inFlight = static_cast<size_t>(state.range(0));
+  std::vector<CSampleBuffer*> buffers;
+  buffers.reserve(inFlight);
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < inFlight; ++i)
+      buffers.push_back(pool.GetFreeBuffer());
+    for (CSampleBuffer* buffer : buffers)
+      buffer->Return();
+    buffers.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * inFlight);
+}
+BENCHMARK(BM_ActiveAEBufferPool_GetReturn)->Arg(1)->Arg(5);
@@ -43,11 +43,17 @@ CCriticalSection videoCodecSection, audioCodecSection;
 
 std::unique_ptr<CDVDVideoCodec> CDVDFactoryCodec::CreateVideoCodec(CDVDStreamInfo& hint,
                                                                    CProcessInfo& processInfo)
+{
+  return CreateVideoCodec(hint, processInfo, CDVDCodecOptions());
+}
+
+std::unique_ptr<CDVDVideoCodec> CDVDFactoryCodec::CreateVideoCodec(
+    CDVDStreamInfo& hint, CProcessInfo& processInfo, const CDVDCodecOptions& codecOptions)
 {
   std::unique_lock lock(videoCodecSection);
 
   std::unique_ptr<CDVDVideoCodec> pCodec;
-  CDVDCodecOptions options;
+  CDVDCodecOptions options(codecOptions);
 
   // addon handler for this stream ?
 
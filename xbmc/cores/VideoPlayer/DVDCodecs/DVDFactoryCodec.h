@@ -42,6 +42,12 @@ class CDVDFactoryCodec
 public:
   static std::unique_ptr<CDVDVideoCodec> CreateVideoCodec(CDVDStreamInfo& hint,
                                                           CProcessInfo& processInfo);
+  /*!
+   * \brief Create a video codec, passing special options to it, e.g. FFmpeg decoder options.
+   */
+  static std::unique_ptr<CDVDVideoCodec> CreateVideoCodec(CDVDStreamInfo& hint,
+                                                          CProcessInfo& processInfo,
+                                                          const CDVDCodecOptions& codecOptions);
 
   static IHardwareDecoder* CreateVideoCodecHWAccel(const std::string& id,
                                                    CDVDStreamInfo& hint,
@@ -419,6 +419,9 @@ bool CDVDVideoCodecDRMPRIME::AddData(const DemuxPacket& packet)
 
   avpkt->data = packet.pData;
   avpkt->size = packet.iSize;
+  // a shared payload is referenced by the decoder instead of copied
+  if (packet.m_buffer)
+    avpkt->buf = av_buffer_ref(packet.m_buffer);
   avpkt->dts = (packet.dts == DVD_NOPTS_VALUE)
                    ? AV_NOPTS_VALUE
                    : static_cast<int64_t>(packet.dts / DVD_TIME_BASE * AV_TIME_BASE);
@@ -22,7 +22,6 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
-#include "utils/CPUInfo.h"
 #include "utils/StringUtils.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
@@ -392,12 +391,18 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     }
     else
     {
-      int num_threads = CServiceBroker::GetCPUInfo()->GetCPUCount() * 3 / 2;
-      num_threads = std::max(1, std::min(num_threads, 16));
-      m_pCodecContext->thread_count = num_threads;
+      CVideoThreadingPolicy& policy = CVideoThreadingPolicy::GetInstance();
+      m_threading = policy.Decide(GetThreadingStream());
+      policy.Acquire(m_threading);
+      m_pCodecContext->thread_count = m_threading.threadCount;
+      if (m_threading.threadType)
+        m_pCodecContext->thread_type = m_threading.threadType;
+      m_lagDetector.Reset();
+      m_threadingReopen = false;
       m_decoderState = STATE_SW_MULTI;
-      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open frame threaded with {} threads",
-                num_threads);
+      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open {} threaded with {} threads",
+                m_threading.threadType == FF_THREAD_SLICE ? "slice" : "frame",
+                m_threading.threadCount);
     }
   }
   else
@@ -489,6 +494,23 @@ void CDVDVideoCodecFFmpeg::Dispose()
   }
 
   FilterClose();
+
+  if (m_threading.threadCount > 1)
+    CVideoThreadingPolicy::GetInstance().Release(m_threading);
+  m_threading = {};
+}
+
+CVideoThreadingPolicy::Stream CDVDVideoCodecFFmpeg::GetThreadingStream() const
+{
+  CVideoThreadingPolicy::Stream stream;
+  stream.codec = m_hints.codec;
+  if (m_pCodecContext && m_pCodecContext->codec)
+    stream.capabilities = m_pCodecContext->codec->capabilities;
+  stream.width = m_hints.width;
+  stream.height = m_hints.height;
+  if (m_hints.fpsrate > 0 && m_hints.fpsscale > 0)
+    stream.fps = static_cast<double>(m_hints.fpsrate) / m_hints.fpsscale;
+  return stream;
 }
 
 void CDVDVideoCodecFFmpeg::SetFilters()
@@ -609,6 +631,9 @@ bool CDVDVideoCodecFFmpeg::AddData(const DemuxPacket &packet)
 
   avpkt->data = packet.pData;
   avpkt->size = packet.iSize;
+  // a shared payload is referenced by the decoder instead of copied
+  if (packet.m_buffer)
+    avpkt->buf = av_buffer_ref(packet.m_buffer);
   avpkt->dts = (packet.dts == DVD_NOPTS_VALUE)
                    ? AV_NOPTS_VALUE
                    : static_cast<int64_t>(packet.dts / DVD_TIME_BASE * AV_TIME_BASE);
@@ -666,6 +691,13 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
     return VC_EOF;
   }
 
+  // the player resends the packets since the last key frame to the reopened decoder
+  if (m_threadingReopen)
+  {
+    m_threadingReopen = false;
+    return VC_REOPEN;
+  }
+
   // handle hw accelerators first, they may have frames ready
   if (m_pHardware)
   {
@@ -961,6 +993,7 @@ void CDVDVideoCodecFFmpeg::Reset()
   m_filters = "";
   FilterClose();
   m_dropCtrl.Reset(false);
+  m_lagDetector.Reset();
 }
 
 void CDVDVideoCodecFFmpeg::Reopen()
@@ -1427,6 +1460,21 @@ void CDVDVideoCodecFFmpeg::SetCodecControl(int flags)
 {
   m_codecControlFlags = flags;
 
+  if (m_decoderState == STATE_SW_MULTI && m_started && !m_threadingReopen &&
+      m_lagDetector.Update(flags))
+  {
+    const CVideoThreadingPolicy::Decision threading =
+        CVideoThreadingPolicy::GetInstance().ReportLagging(GetThreadingStream(), m_threading);
+    if (threading.threadCount > m_threading.threadCount)
+    {
+      CLog::Log(LOGINFO,
+                "CDVDVideoCodecFFmpeg - decoding falls behind, reopening with {} instead of {} "
+                "threads",
+                threading.threadCount, m_threading.threadCount);
+      m_threadingReopen = true;
+    }
+  }
+
   if (m_pCodecContext)
   {
     bool bDrop = (flags & DVD_CODEC_CTRL_DROP_ANY) != 0;
@@ -10,6 +10,7 @@
 
 #include "DVDVideoCodec.h"
 #include "DVDVideoPP.h"
+#include "VideoThreadingPolicy.h"
 #include "cores/VideoPlayer/DVDCodecs/DVDCodecs.h"
 #include "cores/VideoPlayer/DVDStreamInfo.h"
 
@@ -58,6 +59,8 @@ protected:
   void UpdateName();
   bool SetPictureParams(VideoPicture* pVideoPicture);
 
+  CVideoThreadingPolicy::Stream GetThreadingStream() const;
+
   bool HasHardware() { return m_pHardware != nullptr; }
   void SetHardware(IHardwareDecoder *hardware);
 
@@ -100,6 +103,9 @@ protected:
   double m_DAR = 1.0;
   CDVDStreamInfo m_hints;
   CDVDCodecOptions m_options;
+  CVideoThreadingPolicy::Decision m_threading;
+  CVideoThreadingPolicy::CLagDetector m_lagDetector;
+  bool m_threadingReopen = false;
 
   struct CDropControl
   {
@@ -0,0 +1,201 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoThreadingPolicy.h"
+
+#include "DVDVideoCodec.h"
+#include "ServiceBroker.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace
+{
+constexpr int MAX_THREADS = 16;
+constexpr int MIN_FRAME_THREADS = 2;
+
+// pixel rate a single thread is assumed to decode of a codec with cost 1, 1080p30 takes 4 threads
+constexpr double PIXELS_PER_THREAD = 1920.0 * 1080.0 * 30.0 / 4.0;
+
+constexpr double DEFAULT_FPS = 25.0;
+constexpr double BOOST_STEP = 1.5;
+constexpr double MAX_BOOST = 4.0;
+
+// packets to judge a decoder by, about 10 s at 25 fps, and the share of them decoded in a hurry
+// which counts as falling behind. The player also hurries for a while after starts and seeks.
+constexpr unsigned int LAG_WINDOW = 250;
+constexpr unsigned int LAG_SHARE = 4;
+} // unnamed namespace
+
+bool CVideoThreadingPolicy::CLagDetector::Update(int codecControlFlags)
+{
+  // playing faster than normal can't be kept up with anyway
+  if (codecControlFlags & DVD_CODEC_CTRL_NO_POSTPROC)
+    return false;
+
+  ++m_packets;
+  if (codecControlFlags & (DVD_CODEC_CTRL_HURRY | DVD_CODEC_CTRL_DROP_ANY))
+    ++m_late;
+
+  if (m_packets < LAG_WINDOW)
+    return false;
+
+  const bool lagging = m_late * LAG_SHARE > m_packets;
+  Reset();
+  return lagging;
+}
+
+void CVideoThreadingPolicy::CLagDetector::Reset()
+{
+  m_packets = 0;
+  m_late = 0;
+}
+
+CVideoThreadingPolicy::CVideoThreadingPolicy(unsigned int cpuCount)
+  : m_cpuCount(std::max(1u, cpuCount))
+{
+}
+
+CVideoThreadingPolicy& CVideoThreadingPolicy::GetInstance()
+{
+  static CVideoThreadingPolicy policy(CServiceBroker::GetCPUInfo()->GetCPUCount());
+  return policy;
+}
+
+CVideoThreadingPolicy::Decision CVideoThreadingPolicy::Decide(const Stream& stream) const
+{
+  std::unique_lock lock(m_section);
+  const auto it = m_boost.find(GetKey(stream));
+  return Decide(stream, m_activeThreads, it != m_boost.end() ? it->second : 1.0);
+}
+
+void CVideoThreadingPolicy::Acquire(const Decision& decision)
+{
+  if (decision.threadCount <= 1)
+    return;
+
+  std::unique_lock lock(m_section);
+  m_activeThreads += decision.threadCount;
+}
+
+void CVideoThreadingPolicy::Release(const Decision& decision)
+{
+  if (decision.threadCount <= 1)
+    return;
+
+  std::unique_lock lock(m_section);
+  m_activeThreads = std::max(0, m_activeThreads - decision.threadCount);
+}
+
+CVideoThreadingPolicy::Decision CVideoThreadingPolicy::ReportLagging(const Stream& stream,
+                                                                     const Decision& decision)
+{
+  std::unique_lock lock(m_section);
+  double& boost = m_boost.try_emplace(GetKey(stream), 1.0).first->second;
+  boost = std::min(boost * BOOST_STEP, MAX_BOOST);
+
+  // the threads of the lagging decoder are given back when it's reopened
+  const int otherThreads = m_activeThreads - (decision.threadCount > 1 ? decision.threadCount : 0);
+  const Decision boosted = Decide(stream, std::max(0, otherThreads), boost);
+  if (boosted.threadCount <= decision.threadCount)
+    return decision;
+
+  return boosted;
+}
+
+unsigned int CVideoThreadingPolicy::GetReservedCores() const
+{
+  // the render thread, which also runs the GUI, and the audio engine. Below 8 cores they share one,
+  // as reserving two would leave a quad core with too few threads for UHD streams.
+  if (m_cpuCount >= 8)
+    return 2;
+  if (m_cpuCount >= 2)
+    return 1;
+  return 0;
+}
+
+CVideoThreadingPolicy::Key CVideoThreadingPolicy::GetKey(const Stream& stream)
+{
+  int heightClass = 0;
+  if (stream.height > 1440)
+    heightClass = 4;
+  else if (stream.height > 1080)
+    heightClass = 3;
+  else if (stream.height > 720)
+    heightClass = 2;
+  else if (stream.height > 576)
+    heightClass = 1;
+
+  return {stream.codec, heightClass};
+}
+
+double CVideoThreadingPolicy::GetCodecCost(AVCodecID codec)
+{
+  switch (codec)
+  {
+    case AV_CODEC_ID_MPEG1VIDEO:
+    case AV_CODEC_ID_MPEG2VIDEO:
+    case AV_CODEC_ID_MPEG4:
+    case AV_CODEC_ID_H263:
+    case AV_CODEC_ID_MJPEG:
+      return 0.5;
+    case AV_CODEC_ID_HEVC:
+    case AV_CODEC_ID_VP9:
+      return 1.5;
+    case AV_CODEC_ID_AV1:
+      return 2.0;
+    default:
+      return 1.0;
+  }
+}
+
+CVideoThreadingPolicy::Decision CVideoThreadingPolicy::Decide(const Stream& stream,
+                                                              int otherThreads,
+                                                              double boost) const
+{
+  // streams which fell behind may use the reserved cores, they'd drop frames otherwise
+  const unsigned int reserved = boost > 1.0 ? 0 : GetReservedCores();
+  const int cores = static_cast<int>(m_cpuCount - reserved);
+  // frame threads spend much of their time waiting for reference frames, so the cores are
+  // oversubscribed by half
+  const int maxThreads = std::min(MAX_THREADS, std::max(1, cores * 3 / 2));
+  const int budget = std::max(1, maxThreads - otherThreads);
+
+  // streams of unknown size are taken for full HD
+  const bool hasSize = stream.width > 0 && stream.height > 0;
+  const double pixels =
+      hasSize ? static_cast<double>(stream.width) * stream.height : 1920.0 * 1080.0;
+  const double fps = stream.fps > 0.0 ? std::min(stream.fps, 240.0) : DEFAULT_FPS;
+  const int needed = static_cast<int>(
+      std::ceil(pixels * fps * GetCodecCost(stream.codec) * boost / PIXELS_PER_THREAD));
+
+  Decision decision;
+  if (stream.capabilities & AV_CODEC_CAP_FRAME_THREADS)
+  {
+    decision.threadType = FF_THREAD_FRAME;
+    decision.threadCount = std::min(std::max(needed, MIN_FRAME_THREADS), budget);
+  }
+  else if (stream.capabilities & AV_CODEC_CAP_SLICE_THREADS)
+  {
+    // slice threads never wait for each other, more of them than cores don't help
+    decision.threadType = FF_THREAD_SLICE;
+    decision.threadCount = std::min({needed, budget, cores});
+  }
+  else if (stream.capabilities & AV_CODEC_CAP_OTHER_THREADS)
+  {
+    // e.g. libdav1d, which threads on its own
+    decision.threadCount = std::min(std::max(needed, MIN_FRAME_THREADS), budget);
+  }
+
+  if (decision.threadCount <= 1)
+    return {};
+
+  return decision;
+}
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <map>
+#include <utility>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+}
+
+/*!
+ \brief Picks the threading of software video decoders.
+
+ Frame threading decodes several frames at once and scales with the number of threads for all
+ streams, at the cost of a frame of latency and a frame buffer per thread. Slice threading only
+ helps streams encoded in several slices, it's used for decoders which can't thread frames.
+
+ The number of threads follows the pixel rate of the stream and the cost of the codec. It's bounded
+ by the cores left after reserving one for the render thread, and one for the audio engine on
+ machines with 8 cores or more, and by the threads of the other open decoders. Streams which turn
+ out to decode too slowly get more threads, which may use the reserved cores as well, and later
+ streams of the same codec and size start with them.
+ */
+class CVideoThreadingPolicy
+{
+public:
+  struct Stream
+  {
+    AVCodecID codec = AV_CODEC_ID_NONE;
+    int capabilities = 0; //!< AV_CODEC_CAP_* of the decoder
+    int width = 0;
+    int height = 0;
+    double fps = 0.0; //!< 0 if unknown
+  };
+
+  struct Decision
+  {
+    int threadType = 0; //!< FF_THREAD_FRAME, FF_THREAD_SLICE or 0 to leave it to the decoder
+    int threadCount = 1;
+
+    bool operator==(const Decision& other) const = default;
+  };
+
+  /*!
+   \brief Tells from the codec controls of the video player whether a decoder keeps up.
+   The player asks to hurry when the render queue runs low and to drop frames when they're late.
+   */
+  class CLagDetector
+  {
+  public:
+    /*!
+     \brief Account for the controls a packet was decoded with.
+     \return true once too many of the recent packets were decoded in a hurry
+     */
+    bool Update(int codecControlFlags);
+    void Reset();
+
+  private:
+    unsigned int m_packets = 0;
+    unsigned int m_late = 0;
+  };
+
+  explicit CVideoThreadingPolicy(unsigned int cpuCount);
+
+  static CVideoThreadingPolicy& GetInstance();
+
+  Decision Decide(const Stream& stream) const;
+
+  /*!
+   \brief Account for the threads of an opened decoder until they're released, so decoders open at
+   the same time share the cores.
+   */
+  void Acquire(const Decision& decision);
+  void Release(const Decision& decision);
+
+  /*!
+   \brief Report that a decoder with the given threading falls behind.
+   \return the threading to reopen the decoder with, the given one if there is no room for more
+   */
+  Decision ReportLagging(const Stream& stream, const Decision& decision);
+
+  unsigned int GetReservedCores() const;
+
+private:
+  using Key = std::pair<AVCodecID, int>; //!< codec and height class
+
+  static Key GetKey(const Stream& stream);
+  static double GetCodecCost(AVCodecID codec);
+  Decision Decide(const Stream& stream, int otherThreads, double boost) const;
+
+  const unsigned int m_cpuCount;
+
+  mutable CCriticalSection m_section;
+  int m_activeThreads = 0;
+  std::map<Key, double> m_boost; //!< extra threads of streams which fell behind, as factor
+};
@@ -89,6 +89,7 @@ bool CDVDDemuxClient::Open(std::shared_ptr<CDVDInputStream> pInput)
 void CDVDDemuxClient::Dispose()
 {
   DisposeStreams();
+  m_packet.reset();
 
   m_pInput = nullptr;
   m_IDemux = nullptr;
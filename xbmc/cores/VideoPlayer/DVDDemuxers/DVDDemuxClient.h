@@ -9,6 +9,7 @@
 #pragma once
 
 #include "DVDDemux.h"
+#include "DVDDemuxUtils.h"
 #include "DVDInputStreams/DVDInputStream.h"
 
 #include <map>
@@ -57,7 +58,9 @@ protected:
   std::map<int, std::shared_ptr<CDemuxStream>> m_streams;
   int m_displayTime;
   double m_dtsAtDisplayTime;
-  std::unique_ptr<DemuxPacket> m_packet;
+  // packets come from the packet pool, they mustn't be deleted
+  std::unique_ptr<DemuxPacket, decltype(&CDVDDemuxUtils::FreeDemuxPacket)> m_packet{
+      nullptr, &CDVDDemuxUtils::FreeDemuxPacket};
   int m_videoStreamPlaying = -1;
 
 private:
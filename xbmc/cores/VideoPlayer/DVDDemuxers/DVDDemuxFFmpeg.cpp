@@ -172,7 +172,20 @@ static int dvd_file_read(void* h, uint8_t* buf, int size)
     return AVERROR_EXIT;
 
   std::shared_ptr<CDVDInputStream> pInputStream = static_cast<CDVDDemuxFFmpeg*>(h)->m_pInput;
-  int len = pInputStream->Read(buf, size);
+
+  // copy straight out of the file cache into the avio buffer if the stream can lend its memory
+  const uint8_t* data = nullptr;
+  int len = pInputStream->ReadSpan(data, size);
+  if (len > 0)
+  {
+    memcpy(buf, data, len);
+    pInputStream->ReleaseSpan(len);
+  }
+  else if (len == -1)
+    len = pInputStream->Read(buf, size);
+  else if (len < 0)
+    return AVERROR(EIO);
+
   if (len == 0)
     return AVERROR_EOF;
   else
@@ -1069,7 +1082,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               if (m_pkt.pkt.stream_index ==
                   (int)m_pFormatContext->programs[m_program]->stream_index[i])
               {
-                pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+                pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt);
                 break;
               }
             }
@@ -1078,7 +1091,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               bReturnEmpty = true;
           }
           else
-            pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+            pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt);
         }
         else
           bReturnEmpty = true;
@@ -1092,13 +1105,6 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
             m_pkt.pkt.pts = AV_NOPTS_VALUE;
           }
 
-          // copy contents into our own packet
-          pPacket->iSize = m_pkt.pkt.size;
-
-          // maybe we can avoid a memcpy here by detecting where pkt.destruct is pointing too?
-          if (m_pkt.pkt.data)
-            memcpy(pPacket->pData, m_pkt.pkt.data, pPacket->iSize);
-
           pPacket->pts =
               ConvertTimestamp(m_pkt.pkt.pts, stream->time_base.den, stream->time_base.num);
           pPacket->dts =
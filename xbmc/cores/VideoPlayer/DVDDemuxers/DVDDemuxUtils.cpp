@@ -9,6 +9,7 @@
 #include "DVDDemuxUtils.h"
 
 #include "cores/VideoPlayer/Interface/DemuxCrypto.h"
+#include "threads/CriticalSection.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
 
@@ -19,13 +20,195 @@ extern "C"
 }
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace
+{
+/*!
+ * \brief Recycles packet headers, a demuxer allocates one for every packet it reads.
+ * Headers are allocated in slabs which are kept for the lifetime of the process, the memory held
+ * is bounded by the number of packets queued at once.
+ */
+class CPacketHeaderSlab
+{
+public:
+  DemuxPacket* Allocate()
+  {
+    Storage* storage;
+    {
+      std::unique_lock lock(m_section);
+      if (m_free.empty())
+        Grow();
+      storage = m_free.back();
+      m_free.pop_back();
+    }
+    return new (storage) DemuxPacket();
+  }
+
+  void Free(DemuxPacket* packet)
+  {
+    packet->~DemuxPacket();
+    std::unique_lock lock(m_section);
+    m_free.emplace_back(reinterpret_cast<Storage*>(packet));
+  }
+
+private:
+  static constexpr size_t SLAB_SIZE = 256;
+
+  struct Storage
+  {
+    alignas(DemuxPacket) std::byte data[sizeof(DemuxPacket)];
+  };
+
+  void Grow()
+  {
+    Storage* slab = m_slabs.emplace_back(std::make_unique<Storage[]>(SLAB_SIZE)).get();
+    for (size_t i = 0; i < SLAB_SIZE; ++i)
+      m_free.emplace_back(slab + i);
+  }
+
+  CCriticalSection m_section;
+  std::vector<std::unique_ptr<Storage[]>> m_slabs;
+  std::vector<Storage*> m_free;
+};
+
+CPacketHeaderSlab& GetHeaderSlab()
+{
+  // never destroyed, packets may still be freed during static destruction
+  static CPacketHeaderSlab* slab = new CPacketHeaderSlab();
+  return *slab;
+}
+
+/*!
+ * \brief Recycles packet payloads by size class.
+ * Blocks are rounded up to one of four classes per power of two, so a payload wastes at most a
+ * quarter of its block. Each block is preceded by a small header holding its class. Payloads
+ * larger than the largest class and freed payloads exceeding the pool limit go to the system
+ * allocator.
+ */
+class CPayloadPool
+{
+public:
+  uint8_t* Allocate(size_t size)
+  {
+    // decoders may read over the end of the payload
+    size += AV_INPUT_BUFFER_PADDING_SIZE;
+
+    const size_t sizeClass = GetClass(size);
+    std::byte* block = nullptr;
+    {
+      std::unique_lock lock(m_section);
+      m_stats.allocations++;
+      if (sizeClass < CLASSES && !m_free[sizeClass].empty())
+      {
+        block = m_free[sizeClass].back();
+        m_free[sizeClass].pop_back();
+        m_stats.reused++;
+        m_stats.pooledBytes -= GetCapacity(sizeClass);
+      }
+    }
+
+    if (!block)
+    {
+      const size_t capacity = sizeClass < CLASSES ? GetCapacity(sizeClass) : size;
+      block = static_cast<std::byte*>(KODI::MEMORY::AlignedMalloc(HEADER_SIZE + capacity, 16));
+      if (!block)
+        return nullptr;
+      *reinterpret_cast<size_t*>(block) = sizeClass;
+    }
+
+    uint8_t* data = reinterpret_cast<uint8_t*>(block + HEADER_SIZE);
+    memset(data + size - AV_INPUT_BUFFER_PADDING_SIZE, 0, AV_INPUT_BUFFER_PADDING_SIZE);
+    return data;
+  }
+
+  void Free(uint8_t* data)
+  {
+    std::byte* block = reinterpret_cast<std::byte*>(data) - HEADER_SIZE;
+    const size_t sizeClass = *reinterpret_cast<size_t*>(block);
+    if (sizeClass < CLASSES)
+    {
+      std::unique_lock lock(m_section);
+      if (m_stats.pooledBytes + GetCapacity(sizeClass) <= MAX_POOLED_BYTES)
+      {
+        m_free[sizeClass].emplace_back(block);
+        m_stats.pooledBytes += GetCapacity(sizeClass);
+        return;
+      }
+    }
+    KODI::MEMORY::AlignedFree(block);
+  }
+
+  void Trim()
+  {
+    std::array<std::vector<std::byte*>, CLASSES> free;
+    {
+      std::unique_lock lock(m_section);
+      free.swap(m_free);
+      m_stats.pooledBytes = 0;
+    }
+    for (const auto& blocks : free)
+      std::ranges::for_each(blocks, KODI::MEMORY::AlignedFree);
+  }
+
+  CDVDDemuxUtils::PacketPoolStats GetStats()
+  {
+    std::unique_lock lock(m_section);
+    return m_stats;
+  }
+
+private:
+  static constexpr size_t HEADER_SIZE = 16; // keeps the payload aligned like the block
+  static constexpr unsigned int MIN_EXP = 8; // smallest class holds 256 bytes
+  static constexpr unsigned int MAX_EXP = 22; // largest class holds 4 MiB
+  static constexpr size_t CLASSES = (MAX_EXP - MIN_EXP) * 4 + 1;
+  static constexpr size_t MAX_POOLED_BYTES = 32 * 1024 * 1024;
+
+  static size_t GetClass(size_t size)
+  {
+    if (size <= (size_t{1} << MIN_EXP))
+      return 0;
+    // 2^exp < size <= 2^(exp + 1)
+    const unsigned int exp = std::bit_width(size - 1) - 1;
+    const size_t step = (size_t{1} << exp) / 4;
+    return (exp - MIN_EXP) * 4 + (size - 1 - (size_t{1} << exp)) / step + 1;
+  }
+
+  static size_t GetCapacity(size_t sizeClass)
+  {
+    if (sizeClass == 0)
+      return size_t{1} << MIN_EXP;
+    const size_t base = size_t{1} << ((sizeClass - 1) / 4 + MIN_EXP);
+    return base + ((sizeClass - 1) % 4 + 1) * (base / 4);
+  }
+
+  CCriticalSection m_section;
+  std::array<std::vector<std::byte*>, CLASSES> m_free;
+  CDVDDemuxUtils::PacketPoolStats m_stats;
+};
+
+CPayloadPool& GetPayloadPool()
+{
+  // never destroyed, packets may still be freed during static destruction
+  static CPayloadPool* pool = new CPayloadPool();
+  return *pool;
+}
+} // unnamed namespace
 
 void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
 {
   if (pPacket)
   {
-    if (pPacket->pData)
-      KODI::MEMORY::AlignedFree(pPacket->pData);
+    if (pPacket->m_buffer)
+      av_buffer_unref(&pPacket->m_buffer);
+    else if (pPacket->pData)
+      GetPayloadPool().Free(pPacket->pData);
     if (pPacket->iSideDataElems)
     {
       AVPacket* avPkt = av_packet_alloc();
@@ -49,13 +232,13 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
     }
     if (pPacket->cryptoInfo)
       delete pPacket->cryptoInfo;
-    delete pPacket;
+    GetHeaderSlab().Free(pPacket);
   }
 }
 
 DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
 {
-  DemuxPacket* pPacket = new DemuxPacket();
+  DemuxPacket* pPacket = GetHeaderSlab().Allocate();
 
   if (iDataSize > 0)
   {
@@ -68,15 +251,13 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
      * Note, if the first 23 bits of the additional bytes are not 0 then damaged
      * MPEG bitstreams could cause overread and segfault
      */
-    pPacket->pData = static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(iDataSize + AV_INPUT_BUFFER_PADDING_SIZE, 16));
+    // the pool allocates and clears the padding
+    pPacket->pData = GetPayloadPool().Allocate(iDataSize);
     if (!pPacket->pData)
     {
       FreeDemuxPacket(pPacket);
       return NULL;
     }
-
-    // reset the last 8 bytes to 0;
-    memset(pPacket->pData + iDataSize, 0, AV_INPUT_BUFFER_PADDING_SIZE);
   }
 
   return pPacket;
@@ -90,6 +271,38 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(unsigned int iDataSize, unsigne
   return ret;
 }
 
+DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(const AVPacket& src)
+{
+  // the payload can only be shared if decoders may read over its end like with our own buffers,
+  // and if nobody else references it yet, so the padding can be cleared
+  if (!src.buf || !src.data || src.size <= 0 || src.data < src.buf->data ||
+      src.data + src.size + AV_INPUT_BUFFER_PADDING_SIZE > src.buf->data + src.buf->size ||
+      !av_buffer_is_writable(src.buf))
+  {
+    DemuxPacket* pPacket = AllocateDemuxPacket(src.size);
+    if (pPacket && src.data && src.size > 0)
+    {
+      pPacket->iSize = src.size;
+      memcpy(pPacket->pData, src.data, src.size);
+    }
+    return pPacket;
+  }
+
+  memset(src.data + src.size, 0, AV_INPUT_BUFFER_PADDING_SIZE);
+
+  DemuxPacket* pPacket = GetHeaderSlab().Allocate();
+  pPacket->m_buffer = av_buffer_ref(src.buf);
+  if (!pPacket->m_buffer)
+  {
+    FreeDemuxPacket(pPacket);
+    return nullptr;
+  }
+  pPacket->pData = src.data;
+  pPacket->iSize = src.size;
+
+  return pPacket;
+}
+
 void CDVDDemuxUtils::StoreSideData(DemuxPacket *pkt, AVPacket *src)
 {
   AVPacket* avPkt = av_packet_alloc();
@@ -114,6 +327,16 @@ void CDVDDemuxUtils::StoreSideData(DemuxPacket *pkt, AVPacket *src)
   av_free(avPkt);
 }
 
+CDVDDemuxUtils::PacketPoolStats CDVDDemuxUtils::GetPacketPoolStats()
+{
+  return GetPayloadPool().GetStats();
+}
+
+void CDVDDemuxUtils::TrimPacketPool()
+{
+  GetPayloadPool().Trim();
+}
+
 std::vector<ChapterFFmpeg> CDVDDemuxUtils::LoadChapters(std::span<AVChapter*> chapters)
 {
   using namespace std::chrono_literals;
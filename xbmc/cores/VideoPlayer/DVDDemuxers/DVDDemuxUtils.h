@@ -11,6 +11,8 @@
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <span>
 #include <string>
 #include <vector>
@@ -30,10 +32,30 @@ struct ChapterFFmpeg
 class CDVDDemuxUtils
 {
 public:
+  struct PacketPoolStats
+  {
+    uint64_t allocations = 0; //!< payloads allocated
+    uint64_t reused = 0; //!< payloads allocated from the pool
+    size_t pooledBytes = 0; //!< memory held by freed payloads kept for reuse
+  };
+
   static void FreeDemuxPacket(DemuxPacket* pPacket);
   static DemuxPacket* AllocateDemuxPacket(int iDataSize = 0);
   static DemuxPacket* AllocateDemuxPacket(unsigned int iDataSize,
                                           unsigned int encryptedSubsampleCount);
+  /*!
+   * \brief Allocate a packet holding the payload of an FFmpeg packet.
+   * If the payload is refcounted and padded, the packet takes a reference to it instead of a
+   * copy. Side data and timestamps are not taken over.
+   */
+  static DemuxPacket* AllocateDemuxPacket(const AVPacket& src);
   static void StoreSideData(DemuxPacket* pkt, AVPacket* src);
+
+  static PacketPoolStats GetPacketPoolStats();
+  /*!
+   * \brief Release the payloads kept for reuse, e.g. once the packet queues were flushed.
+   */
+  static void TrimPacketPool();
+
   static std::vector<ChapterFFmpeg> LoadChapters(std::span<AVChapter*> chapters);
 };
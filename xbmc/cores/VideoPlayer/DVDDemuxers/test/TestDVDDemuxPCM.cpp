@@ -0,0 +1,119 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxBXA.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxCDDA.h"
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDInputStreams/DVDInputStream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class CMemoryFileInputStream : public CDVDInputStream
+{
+public:
+  explicit CMemoryFileInputStream(std::vector<uint8_t> data)
+    : CDVDInputStream(DVDSTREAM_TYPE_FILE, CFileItem()), m_data(std::move(data))
+  {
+  }
+
+  int Read(uint8_t* buf, int buf_size) override
+  {
+    const int size = std::min(buf_size, static_cast<int>(m_data.size() - m_pos));
+    std::memcpy(buf, m_data.data() + m_pos, size);
+    m_pos += size;
+    return size;
+  }
+
+  int64_t Seek(int64_t offset, int whence) override
+  {
+    if (whence != SEEK_SET || offset < 0 || offset > static_cast<int64_t>(m_data.size()))
+      return -1;
+    m_pos = static_cast<size_t>(offset);
+    return offset;
+  }
+
+  int64_t GetLength() override { return static_cast<int64_t>(m_data.size()); }
+  bool IsEOF() override { return m_pos >= m_data.size(); }
+
+private:
+  std::vector<uint8_t> m_data;
+  size_t m_pos = 0;
+};
+
+/*!
+ \brief Read all packets of a demuxer, the packets are freed as the player does.
+ \return the payload bytes read
+ */
+int ReadToEOF(CDVDDemux& demuxer)
+{
+  int bytes = 0;
+  while (DemuxPacket* packet = demuxer.Read())
+  {
+    bytes += packet->iSize;
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+  }
+  return bytes;
+}
+} // unnamed namespace
+
+class TestDVDDemuxPCM : public ::testing::Test
+{
+protected:
+  void SetUp() override { CDVDDemuxUtils::TrimPacketPool(); }
+  void TearDown() override { CDVDDemuxUtils::TrimPacketPool(); }
+
+  // the packet returned empty at EOF has to go back to the pool like all others
+  static void ExpectAllPayloadsReturned(const CDVDDemuxUtils::PacketPoolStats& before)
+  {
+    const CDVDDemuxUtils::PacketPoolStats after = CDVDDemuxUtils::GetPacketPoolStats();
+    EXPECT_EQ(after.allocations - before.allocations - 1, after.reused - before.reused);
+    EXPECT_LT(0u, after.pooledBytes);
+  }
+};
+
+TEST_F(TestDVDDemuxPCM, CDDAReadToEOF)
+{
+  auto input = std::make_shared<CMemoryFileInputStream>(std::vector<uint8_t>(10000, 0x11));
+  CDVDDemuxCDDA demuxer;
+  ASSERT_TRUE(demuxer.Open(input));
+
+  const CDVDDemuxUtils::PacketPoolStats before = CDVDDemuxUtils::GetPacketPoolStats();
+  EXPECT_EQ(10000, ReadToEOF(demuxer));
+  EXPECT_EQ(nullptr, demuxer.Read());
+  ExpectAllPayloadsReturned(before);
+}
+
+TEST_F(TestDVDDemuxPCM, BXAReadToEOF)
+{
+  Demux_BXA_FmtHeader header{};
+  std::memcpy(header.fourcc, "BXA ", 4);
+  header.type = BXA_PACKET_TYPE_FMT_DEMUX;
+  header.channels = 2;
+  header.sampleRate = 44100;
+  header.bitsPerSample = 16;
+
+  std::vector<uint8_t> data(sizeof(header) + 10000, 0x22);
+  std::memcpy(data.data(), &header, sizeof(header));
+
+  auto input = std::make_shared<CMemoryFileInputStream>(std::move(data));
+  CDVDDemuxBXA demuxer;
+  ASSERT_TRUE(demuxer.Open(input));
+
+  const CDVDDemuxUtils::PacketPoolStats before = CDVDDemuxUtils::GetPacketPoolStats();
+  EXPECT_EQ(10000, ReadToEOF(demuxer));
+  EXPECT_EQ(nullptr, demuxer.Read());
+  ExpectAllPayloadsReturned(before);
+}
@@ -9,7 +9,9 @@
 #include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
 
 #include <algorithm>
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -112,3 +114,109 @@ TEST(TestDVDDemuxUtils, ReadChaptersInvalid)
   output = CDVDDemuxUtils::LoadChapters(std::span<AVChapter*>{&avcptr, 0});
   EXPECT_TRUE(output.empty());
 }
+
+TEST(TestDVDDemuxUtils, SharedPayload)
+{
+  AVPacket* avPkt = av_packet_alloc();
+  ASSERT_NE(nullptr, avPkt);
+  ASSERT_EQ(0, av_new_packet(avPkt, 100));
+  memset(avPkt->data, 0x55, 100);
+  memset(avPkt->data + 100, 0xff, AV_INPUT_BUFFER_PADDING_SIZE);
+
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(*avPkt);
+  ASSERT_NE(nullptr, packet);
+  EXPECT_NE(nullptr, packet->m_buffer);
+  EXPECT_EQ(avPkt->data, packet->pData);
+  EXPECT_EQ(100, packet->iSize);
+  EXPECT_TRUE(std::all_of(packet->pData + 100, packet->pData + 100 + AV_INPUT_BUFFER_PADDING_SIZE,
+                          [](uint8_t b) { return b == 0; }));
+
+  // the payload outlives the demuxer packet
+  av_packet_free(&avPkt);
+  EXPECT_TRUE(
+      std::all_of(packet->pData, packet->pData + 100, [](uint8_t b) { return b == 0x55; }));
+
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+}
+
+TEST(TestDVDDemuxUtils, CopiedPayload)
+{
+  AVPacket* avPkt = av_packet_alloc();
+  ASSERT_NE(nullptr, avPkt);
+  ASSERT_EQ(0, av_new_packet(avPkt, 100));
+  memset(avPkt->data, 0x55, 100);
+
+  // a payload referenced elsewhere can't have its padding cleared, so it's copied
+  AVBufferRef* ref = av_buffer_ref(avPkt->buf);
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(*avPkt);
+  ASSERT_NE(nullptr, packet);
+  EXPECT_EQ(nullptr, packet->m_buffer);
+  EXPECT_NE(avPkt->data, packet->pData);
+  ASSERT_EQ(100, packet->iSize);
+  EXPECT_EQ(0, memcmp(avPkt->data, packet->pData, 100));
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+  av_buffer_unref(&ref);
+
+  // as is a payload which isn't refcounted
+  AVBufferRef* buf = avPkt->buf;
+  avPkt->buf = nullptr;
+  packet = CDVDDemuxUtils::AllocateDemuxPacket(*avPkt);
+  ASSERT_NE(nullptr, packet);
+  EXPECT_EQ(nullptr, packet->m_buffer);
+  EXPECT_NE(avPkt->data, packet->pData);
+  EXPECT_EQ(0, memcmp(avPkt->data, packet->pData, 100));
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+  avPkt->buf = buf;
+  av_packet_free(&avPkt);
+}
+
+TEST(TestDVDDemuxUtils, RecycledHeaders)
+{
+  std::vector<DemuxPacket*> packets;
+  for (int i = 0; i < 1000; ++i)
+    packets.emplace_back(CDVDDemuxUtils::AllocateDemuxPacket(i % 10));
+  for (DemuxPacket* packet : packets)
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+  // recycled headers are reset
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(0);
+  ASSERT_NE(nullptr, packet);
+  EXPECT_EQ(nullptr, packet->pData);
+  EXPECT_EQ(nullptr, packet->m_buffer);
+  EXPECT_EQ(-1, packet->iStreamId);
+  EXPECT_EQ(DVD_NOPTS_VALUE, packet->dts);
+  CDVDDemuxUtils::FreeDemuxPacket(packet);
+}
+
+TEST(TestDVDDemuxUtils, PooledPayloads)
+{
+  CDVDDemuxUtils::TrimPacketPool();
+  const CDVDDemuxUtils::PacketPoolStats before = CDVDDemuxUtils::GetPacketPoolStats();
+  EXPECT_EQ(0u, before.pooledBytes);
+
+  for (int size : {1, 200, 1000, 5000, 100000, 3000000})
+  {
+    DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+    ASSERT_NE(nullptr, packet);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(packet->pData) % 16);
+    memset(packet->pData, 0xff, size + AV_INPUT_BUFFER_PADDING_SIZE);
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+    // the block is reused, its padding is cleared again
+    packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+    ASSERT_NE(nullptr, packet);
+    EXPECT_TRUE(std::all_of(packet->pData + size,
+                            packet->pData + size + AV_INPUT_BUFFER_PADDING_SIZE,
+                            [](uint8_t b) { return b == 0; }));
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+  }
+
+  const CDVDDemuxUtils::PacketPoolStats after = CDVDDemuxUtils::GetPacketPoolStats();
+  EXPECT_EQ(12u, after.allocations - before.allocations);
+  EXPECT_EQ(6u, after.reused - before.reused);
+  EXPECT_LT(3000000u, after.pooledBytes);
+
+  CDVDDemuxUtils::TrimPacketPool();
+  EXPECT_EQ(0u, CDVDDemuxUtils::GetPacketPoolStats().pooledBytes);
+}
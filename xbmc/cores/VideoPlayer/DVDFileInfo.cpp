@@ -15,6 +15,7 @@
 #include "ServiceBroker.h"
 #include "filesystem/StackDirectory.h"
 #include "guilib/Texture.h"
+#include "jobs/JobManager.h"
 #include "network/NetworkFileItemClassify.h"
 #include "pictures/Picture.h"
 #include "playlists/PlayListFileItemClassify.h"
@@ -24,11 +25,13 @@
 #include "utils/MemUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
+#include "video/StreamDetailsCache.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
 #ifdef HAVE_LIBBLURAY
 #include "DVDInputStreams/DVDInputStreamBluray.h"
 #endif
+#include "DVDCodecs/DVDCodecs.h"
 #include "DVDCodecs/DVDFactoryCodec.h"
 #include "DVDCodecs/Video/DVDVideoCodec.h"
 #include "DVDCodecs/Video/DVDVideoCodecFFmpeg.h"
@@ -39,14 +42,20 @@
 #include "DVDInputStreams/DVDFactoryInputStream.h"
 #include "Process/ProcessInfo.h"
 #include "TextureCache.h"
+#include "ThumbExtraction.h"
 #include "Util.h"
 #include "cores/FFmpeg.h"
 #include "filesystem/File.h"
 #include "utils/LangCodeExpander.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 extern "C" {
 #include <libavcodec/avcodec.h>
@@ -55,9 +64,37 @@ extern "C" {
 }
 
 using namespace KODI;
+using namespace std::chrono_literals;
+
+using KODI::VIDEO::CStreamDetailsCache;
+
+namespace
+{
+CStreamDetailsCache& GetStreamDetailsCache()
+{
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  CStreamDetailsCache& cache = CStreamDetailsCache::GetInstance();
+  cache.Configure(URIUtils::AddFileToFolder(advancedSettings->m_cachePath, "streamdetails"),
+                  advancedSettings->m_videoStreamDetailsCacheSize);
+  return cache;
+}
+} // unnamed namespace
 
 bool CDVDFileInfo::GetFileDuration(const std::string &path, int& duration)
 {
+  CStreamDetailsCache& cache = GetStreamDetailsCache();
+  CStreamDetailsCache::Fingerprint fingerprint;
+  CStreamDetailsCache::Record record;
+  if (cache.IsEnabled())
+  {
+    fingerprint = CStreamDetailsCache::GetFingerprint(path);
+    if (cache.Get(path, fingerprint, record))
+    {
+      duration = record.duration;
+      return duration > 0;
+    }
+  }
+
   std::unique_ptr<CDVDDemux> demux;
 
   CFileItem item(path, false);
@@ -73,6 +110,11 @@ bool CDVDFileInfo::GetFileDuration(const std::string &path, int& duration)
     return false;
 
   duration = demux->GetStreamLength();
+
+  // nothing is cached for the file, so there are no stream details to keep
+  record.duration = duration;
+  cache.Store(path, fingerprint, record);
+
   if (duration > 0)
     return true;
   else
@@ -94,165 +136,280 @@ int DegreeToOrientation(int degrees)
   }
 }
 
-std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& fileItem,
-                                                              int chapterNumber)
+namespace
 {
-  if (!CanExtract(fileItem))
-    return {};
-
-  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
-  auto start = std::chrono::steady_clock::now();
+// memory of the decoders extracting thumbnails at once, a single extraction is always admitted
+constexpr size_t EXTRACTION_MEMORY_BUDGET = 256 * 1024 * 1024;
+// frames a decoder may hold on to for reference and reordering
+constexpr size_t DECODER_FRAMES = 16;
+// how long the contexts of a file are kept open for thumbnails of further chapters
+constexpr auto IDLE_EXTRACTOR_TIMEOUT = 10s;
+// files whose contexts are kept open at once, for thumbnail jobs running in parallel
+constexpr size_t IDLE_EXTRACTORS = 4;
+
+CThumbExtractionBudget& GetExtractionBudget()
+{
+  static CThumbExtractionBudget budget(EXTRACTION_MEMORY_BUDGET);
+  return budget;
+}
 
-  CFileItem item(fileItem);
-  item.SetMimeTypeForInternetFile();
-  auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
-  if (!pInputStream)
+/*!
+ * \brief Input stream, demuxer and decoder of a file, kept open to extract thumbnails of several
+ * chapters without probing the file and setting up the decoder again for each of them.
+ *
+ * Only key frames are decoded, which is all a thumbnail needs after seeking to a key frame, and
+ * codecs supporting it decode at a reduced resolution close to the thumbnail size.
+ */
+class CThumbExtractor
+{
+public:
+  bool Open(const CFileItem& fileItem)
   {
-    CLog::Log(LOGERROR, "InputStream: Error creating stream for {}", redactPath);
-    return {};
-  }
+    m_path = fileItem.GetDynPath();
+    m_redactPath = CURL::GetRedacted(fileItem.GetPath());
 
-  if (!pInputStream->Open())
-  {
-    CLog::Log(LOGERROR, "InputStream: Error opening, {}", redactPath);
-    return {};
-  }
+    CFileItem item(fileItem);
+    item.SetMimeTypeForInternetFile();
+    m_inputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
+    if (!m_inputStream)
+    {
+      CLog::Log(LOGERROR, "InputStream: Error creating stream for {}", m_redactPath);
+      return false;
+    }
 
-  std::unique_ptr<CDVDDemux> demuxer{CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true)};
-  if (!demuxer)
-  {
-    CLog::LogF(LOGERROR, "Error creating demuxer");
-    return {};
-  }
+    if (!m_inputStream->Open())
+    {
+      CLog::Log(LOGERROR, "InputStream: Error opening, {}", m_redactPath);
+      return false;
+    }
 
-  int nVideoStream = -1;
-  int64_t demuxerId = -1;
-  for (CDemuxStream* pStream : demuxer->GetStreams())
-  {
-    if (pStream)
+    m_demuxer.reset(CDVDFactoryDemuxer::CreateDemuxer(m_inputStream, true));
+    if (!m_demuxer)
     {
-      // ignore if it's a picture attachment (e.g. jpeg artwork)
-      // assume the first video stream is the one we want, ie the base layer in DV DTDL files
-      if (pStream->type == StreamType::VIDEO && !(pStream->flags & AV_DISPOSITION_ATTACHED_PIC) &&
-          nVideoStream == -1)
+      CLog::LogF(LOGERROR, "Error creating demuxer");
+      return false;
+    }
+
+    int64_t demuxerId = -1;
+    for (CDemuxStream* pStream : m_demuxer->GetStreams())
+    {
+      if (pStream)
       {
-        nVideoStream = pStream->uniqueId;
-        demuxerId = pStream->demuxerId;
+        // ignore if it's a picture attachment (e.g. jpeg artwork)
+        // assume the first video stream is the one we want, ie the base layer in DV DTDL files
+        if (pStream->type == StreamType::VIDEO &&
+            !(pStream->flags & AV_DISPOSITION_ATTACHED_PIC) && m_videoStream == -1)
+        {
+          m_videoStream = pStream->uniqueId;
+          demuxerId = pStream->demuxerId;
+        }
+        else
+          m_demuxer->EnableStream(pStream->demuxerId, pStream->uniqueId, false);
       }
-      else
-        demuxer->EnableStream(pStream->demuxerId, pStream->uniqueId, false);
     }
-  }
 
-  int packetsTried = 0;
+    if (m_videoStream == -1)
+      return false;
 
-  std::unique_ptr<CTexture> result{};
-  if (nVideoStream != -1)
-  {
-    std::unique_ptr<CProcessInfo> pProcessInfo(CProcessInfo::CreateInstance());
+    m_processInfo.reset(CProcessInfo::CreateInstance());
     std::vector<AVPixelFormat> pixFmts;
     pixFmts.push_back(AV_PIX_FMT_YUV420P);
-    pProcessInfo->SetPixFormats(pixFmts);
+    m_processInfo->SetPixFormats(pixFmts);
 
-    CDVDStreamInfo hint(*demuxer->GetStream(demuxerId, nVideoStream), true);
-    hint.codecOptions = CODEC_FORCE_SOFTWARE;
+    m_hint.Assign(*m_demuxer->GetStream(demuxerId, m_videoStream), true);
+    m_hint.codecOptions = CODEC_FORCE_SOFTWARE;
 
-    std::unique_ptr<CDVDVideoCodec> pVideoCodec =
-        CDVDFactoryCodec::CreateVideoCodec(hint, *pProcessInfo);
+    // a thumbnail doesn't need more than a fraction of the resolution of a large video
+    const AVCodec* codec = avcodec_find_decoder(m_hint.codec);
+    const unsigned int imageRes =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes;
+    while (codec && m_lowres < codec->max_lowres && imageRes > 0 &&
+           static_cast<unsigned int>(m_hint.width >> (m_lowres + 1)) >= imageRes)
+      m_lowres++;
 
-    if (pVideoCodec)
+    m_memory = static_cast<size_t>(std::max(m_hint.width, 1920) >> m_lowres) *
+               (std::max(m_hint.height, 1080) >> m_lowres) * 3 / 2 * DECODER_FRAMES;
+
+    return OpenCodec();
+  }
+
+  const std::string& GetPath() const { return m_path; }
+
+  std::unique_ptr<CTexture> Extract(int chapterNumber)
+  {
+    const int nTotalLen = m_demuxer->GetStreamLength();
+    const bool seekToChapter = chapterNumber > 0 && m_demuxer->GetChapterCount() > 0;
+    const int64_t nSeekTo =
+        seekToChapter ? m_demuxer->GetChapterPos(chapterNumber).count() : nTotalLen / 3;
+
+    CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", nSeekTo, nTotalLen,
+               m_redactPath);
+
+    GetExtractionBudget().Acquire(m_memory);
+    std::unique_ptr<CTexture> result = Decode(nSeekTo);
+    if (!result && m_keyFramesOnly)
     {
-      int nTotalLen = demuxer->GetStreamLength();
+      // some streams, e.g. with intra refresh, don't flag key frames
+      CLog::LogF(LOGDEBUG, "no key frame found in {}, decoding all frames", m_redactPath);
+      m_keyFramesOnly = false;
+      if (OpenCodec())
+        result = Decode(nSeekTo);
+    }
+    // release the frames held by the decoder while the extractor is idle
+    if (m_codec)
+      m_codec->Reset();
+    GetExtractionBudget().Release(m_memory);
 
-      bool seekToChapter = chapterNumber > 0 && demuxer->GetChapterCount() > 0;
-      int64_t nSeekTo =
-          seekToChapter ? demuxer->GetChapterPos(chapterNumber).count() : nTotalLen / 3;
+    return result;
+  }
 
-      CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", nSeekTo, nTotalLen,
-                 redactPath);
+  int GetPacketsTried() const { return m_packetsTried; }
 
-      if (demuxer->SeekTime(static_cast<double>(nSeekTo), true))
-      {
-        CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
-        VideoPicture picture = {};
+private:
+  bool OpenCodec()
+  {
+    m_codec.reset();
 
-        // num streams * 160 frames, should get a valid frame, if not abort.
-        int abort_index = demuxer->GetNrOfStreams() * 160;
-        do
-        {
-          DemuxPacket* pPacket = demuxer->Read();
-          packetsTried++;
+    CDVDCodecOptions options;
+    if (m_keyFramesOnly)
+      options.m_keys.emplace_back("skip_frame", "nokey");
+    if (m_lowres > 0)
+      options.m_keys.emplace_back("lowres", std::to_string(m_lowres));
 
-          if (!pPacket)
-            break;
+    m_codec = CDVDFactoryCodec::CreateVideoCodec(m_hint, *m_processInfo, options);
+    return m_codec != nullptr;
+  }
 
-          if (pPacket->iStreamId != nVideoStream)
-          {
-            CDVDDemuxUtils::FreeDemuxPacket(pPacket);
-            continue;
-          }
+  std::unique_ptr<CTexture> Decode(int64_t seekTo)
+  {
+    if (!m_codec || !m_demuxer->SeekTime(static_cast<double>(seekTo), true))
+      return {};
 
-          pVideoCodec->AddData(*pPacket);
-          CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+    m_codec->Reset();
 
-          iDecoderState = CDVDVideoCodec::VC_NONE;
-          while (iDecoderState == CDVDVideoCodec::VC_NONE)
-          {
-            iDecoderState = pVideoCodec->GetPicture(&picture);
-          }
+    CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
+    VideoPicture picture = {};
 
-          if (iDecoderState == CDVDVideoCodec::VC_PICTURE)
-          {
-            if (!(picture.iFlags & DVP_FLAG_DROPPED))
-              break;
-          }
+    // num streams * 160 frames, should get a valid frame, if not abort.
+    int abort_index = m_demuxer->GetNrOfStreams() * 160;
+    do
+    {
+      DemuxPacket* pPacket = m_demuxer->Read();
+      m_packetsTried++;
 
-        } while (abort_index--);
+      if (!pPacket)
+        break;
 
-        if (iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED))
-        {
-          unsigned int nWidth =
-              std::min(picture.iDisplayWidth,
-                       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes);
-          double aspect = (double)picture.iDisplayWidth / (double)picture.iDisplayHeight;
-          if (hint.forced_aspect && hint.aspect != 0)
-            aspect = hint.aspect;
-          unsigned int nHeight = (unsigned int)((double)nWidth / aspect);
-
-          result = CTexture::CreateTexture(nWidth, nHeight);
-          result->SetAlpha(false);
-          struct SwsContext* context =
-              sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, nWidth, nHeight,
-                             AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
-
-          if (context)
-          {
-            uint8_t* planes[YuvImage::MAX_PLANES];
-            int stride[YuvImage::MAX_PLANES];
-            picture.videoBuffer->GetPlanes(planes);
-            picture.videoBuffer->GetStrides(stride);
-            uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
-            int srcStride[] = {stride[0], stride[1], stride[2], 0};
-            uint8_t* dst[] = {result->GetPixels(), 0, 0, 0};
-            int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
-            result->SetOrientation(DegreeToOrientation(hint.orientation));
-            sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
-            sws_freeContext(context);
-          }
-        }
-        else
-        {
-          CLog::LogF(LOGDEBUG, "decode failed in {} after {} packets.", redactPath, packetsTried);
-        }
+      if (pPacket->iStreamId != m_videoStream)
+      {
+        CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+        continue;
       }
+
+      m_codec->AddData(*pPacket);
+      CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+
+      iDecoderState = CDVDVideoCodec::VC_NONE;
+      while (iDecoderState == CDVDVideoCodec::VC_NONE)
+      {
+        iDecoderState = m_codec->GetPicture(&picture);
+      }
+
+      if (iDecoderState == CDVDVideoCodec::VC_PICTURE)
+      {
+        if (!(picture.iFlags & DVP_FLAG_DROPPED))
+          break;
+      }
+
+    } while (abort_index--);
+
+    if (iDecoderState != CDVDVideoCodec::VC_PICTURE || (picture.iFlags & DVP_FLAG_DROPPED))
+    {
+      CLog::LogF(LOGDEBUG, "decode failed in {} after {} packets.", m_redactPath, m_packetsTried);
+      return {};
+    }
+
+    unsigned int nWidth =
+        std::min(picture.iDisplayWidth,
+                 CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageRes);
+    double aspect = (double)picture.iDisplayWidth / (double)picture.iDisplayHeight;
+    if (m_hint.forced_aspect && m_hint.aspect != 0)
+      aspect = m_hint.aspect;
+    unsigned int nHeight = (unsigned int)((double)nWidth / aspect);
+
+    std::unique_ptr<CTexture> result = CTexture::CreateTexture(nWidth, nHeight);
+    result->SetAlpha(false);
+    struct SwsContext* context =
+        sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, nWidth, nHeight,
+                       AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
+
+    if (context)
+    {
+      uint8_t* planes[YuvImage::MAX_PLANES];
+      int stride[YuvImage::MAX_PLANES];
+      picture.videoBuffer->GetPlanes(planes);
+      picture.videoBuffer->GetStrides(stride);
+      uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
+      int srcStride[] = {stride[0], stride[1], stride[2], 0};
+      uint8_t* dst[] = {result->GetPixels(), 0, 0, 0};
+      int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
+      result->SetOrientation(DegreeToOrientation(m_hint.orientation));
+      sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
+      sws_freeContext(context);
     }
+
+    return result;
+  }
+
+  std::string m_path;
+  std::string m_redactPath;
+  std::shared_ptr<CDVDInputStream> m_inputStream;
+  std::unique_ptr<CDVDDemux> m_demuxer;
+  std::unique_ptr<CProcessInfo> m_processInfo;
+  CDVDStreamInfo m_hint;
+  std::unique_ptr<CDVDVideoCodec> m_codec;
+  int m_videoStream = -1;
+  int m_lowres = 0;
+  bool m_keyFramesOnly = true;
+  size_t m_memory = 0;
+  int m_packetsTried = 0;
+};
+
+using CIdleExtractor = CIdleThumbExtractor<CThumbExtractor>;
+
+CIdleExtractor& GetIdleExtractor()
+{
+  // never destroyed, closing a file during static destruction isn't safe
+  static CIdleExtractor* idle = new CIdleExtractor(IDLE_EXTRACTOR_TIMEOUT, IDLE_EXTRACTORS);
+  return *idle;
+}
+} // unnamed namespace
+
+std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& fileItem,
+                                                              int chapterNumber)
+{
+  if (!CanExtract(fileItem))
+    return {};
+
+  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
+  auto start = std::chrono::steady_clock::now();
+
+  std::unique_ptr<CThumbExtractor> extractor = GetIdleExtractor().Take(fileItem.GetDynPath());
+  if (!extractor)
+  {
+    extractor = std::make_unique<CThumbExtractor>();
+    if (!extractor->Open(fileItem))
+      return {};
   }
 
+  std::unique_ptr<CTexture> result = extractor->Extract(chapterNumber);
+
   auto end = std::chrono::steady_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
   CLog::LogF(LOGDEBUG, "measured {} ms to extract thumb from file <{}> in {} packets. ",
-             duration.count(), redactPath, packetsTried);
+             duration.count(), redactPath, extractor->GetPacketsTried());
 
+  GetIdleExtractor().Put(std::move(extractor));
   return result;
 }
 
@@ -305,7 +462,69 @@ bool CDVDFileInfo::GetFileStreamDetails(CFileItem *pItem)
   if (URIUtils::IsStack(playablePath))
     playablePath = XFILE::CStackDirectory::GetFirstStackedFile(playablePath);
 
-  CFileItem item(playablePath, false);
+  CStreamDetails& details = pItem->GetVideoInfoTag()->m_streamDetails;
+  int duration = 0;
+  bool isPVR = false;
+  if (!GetStreamDetails(playablePath, details, duration, isPVR))
+    return false;
+
+  // stack handling, the details are those of the first file
+  if (URIUtils::IsStack(strFileNameAndPath))
+  {
+    CFileItemList files;
+    XFILE::CStackDirectory stack;
+    stack.GetDirectory(CURL(strFileNameAndPath), files);
+
+    // skip first path as we already know the duration
+    for (int i = 1; i < files.Size(); i++)
+    {
+      int partDuration = 0;
+      if (GetFileDuration(files[i]->GetDynPath(), partDuration))
+        duration += partDuration;
+    }
+
+    if (duration > 0)
+    {
+      for (int i = 1; i <= details.GetVideoStreamCount(); i++)
+        details.SetVideoDuration(i, duration / 1000);
+    }
+  }
+
+  if (!isPVR)
+    ProcessExternalSubtitles(pItem);
+
+  return details.HasItems();
+}
+
+bool CDVDFileInfo::GetStreamDetails(const std::string& path,
+                                    CStreamDetails& details,
+                                    int& duration,
+                                    bool& isPVR)
+{
+  CStreamDetailsCache& cache = GetStreamDetailsCache();
+  CStreamDetailsCache::Fingerprint fingerprint;
+  std::optional<CStreamDetailsCache::CProbeLock> probeLock;
+  if (cache.IsEnabled())
+  {
+    fingerprint = CStreamDetailsCache::GetFingerprint(path);
+    if (fingerprint.IsValid())
+    {
+      // a file being probed already, e.g. by the prewarm job, is found in the cache afterwards
+      probeLock.emplace(cache, path);
+
+      CStreamDetailsCache::Record record;
+      if (cache.Get(path, fingerprint, record) && record.hasDetails)
+      {
+        details = record.details;
+        duration = record.duration;
+        // files opened as PVR streams can't be fingerprinted
+        isPVR = false;
+        return true;
+      }
+    }
+  }
+
+  CFileItem item(path, false);
   item.SetMimeTypeForInternetFile();
   auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
   if (!pInputStream)
@@ -316,21 +535,65 @@ bool CDVDFileInfo::GetFileStreamDetails(CFileItem *pItem)
     return false;
   }
 
-  CDVDDemux *pDemuxer = CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true);
-  if (pDemuxer)
-  {
-    bool retVal = DemuxerToStreamDetails(pInputStream, pDemuxer, pItem->GetVideoInfoTag()->m_streamDetails, strFileNameAndPath);
+  std::unique_ptr<CDVDDemux> pDemuxer(CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true));
+  if (!pDemuxer)
+    return false;
 
-    if (!pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
-      ProcessExternalSubtitles(pItem);
+  DemuxerToStreamDetails(pInputStream, pDemuxer.get(), details);
+  duration = pDemuxer->GetStreamLength();
+  isPVR = pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER);
 
-    delete pDemuxer;
-    return retVal;
-  }
-  else
-  {
-    return false;
-  }
+  CStreamDetailsCache::Record record;
+  record.duration = duration;
+  record.hasDetails = true;
+  record.details = details;
+  cache.Store(path, fingerprint, record);
+
+  return true;
+}
+
+void CDVDFileInfo::PrewarmStreamDetails(std::vector<std::string> paths,
+                                        std::function<bool()> isCancelled)
+{
+  const auto jobManager = CServiceBroker::GetJobManager();
+  if (paths.empty() || !jobManager || !GetStreamDetailsCache().IsEnabled())
+    return;
+
+  jobManager->Submit(
+      [paths = std::move(paths), isCancelled = std::move(isCancelled)]()
+      {
+        CStreamDetailsCache& cache = GetStreamDetailsCache();
+        for (const std::string& path : paths)
+        {
+          const auto jobManager = CServiceBroker::GetJobManager();
+          if (isCancelled() || !jobManager || !jobManager->IsRunning() || !cache.IsEnabled())
+            return;
+
+          if (!CanExtract(CFileItem(path, false)))
+            continue;
+
+          CStreamDetails details;
+          int duration = 0;
+          bool isPVR = false;
+          if (!URIUtils::IsStack(path))
+          {
+            GetStreamDetails(path, details, duration, isPVR);
+            continue;
+          }
+
+          CFileItemList files;
+          XFILE::CStackDirectory stack;
+          stack.GetDirectory(CURL(path), files);
+          for (int i = 0; i < files.Size(); i++)
+          {
+            if (i == 0)
+              GetStreamDetails(files[i]->GetDynPath(), details, duration, isPVR);
+            else
+              GetFileDuration(files[i]->GetDynPath(), duration);
+          }
+        }
+      },
+      CJob::PRIORITY_LOW_PAUSABLE);
 }
 
 bool CDVDFileInfo::DemuxerToStreamDetails(const std::shared_ptr<CDVDInputStream>& pInputStream,
@@ -436,13 +699,11 @@ static bool GetDetailsFromFrame(CDemuxStreamVideo* stream,
 /* returns true if details have been added */
 bool CDVDFileInfo::DemuxerToStreamDetails(const std::shared_ptr<CDVDInputStream>& pInputStream,
                                           CDVDDemux* pDemux,
-                                          CStreamDetails& details,
-                                          const std::string& path)
+                                          CStreamDetails& details)
 {
   bool retVal = false;
   details.Reset();
 
-  const CURL pathToUrl(path);
   for (CDemuxStream* stream : pDemux->GetStreams())
   {
     if (stream->type == StreamType::VIDEO && !(stream->flags & AV_DISPOSITION_ATTACHED_PIC))
@@ -483,22 +744,6 @@ bool CDVDFileInfo::DemuxerToStreamDetails(const std::shared_ptr<CDVDInputStream>
           CLog::LogF(LOGERROR, "Failed to get HDR details from frame");
       }
 
-      // stack handling
-      if (URIUtils::IsStack(path))
-      {
-        CFileItemList files;
-        XFILE::CStackDirectory stack;
-        stack.GetDirectory(pathToUrl, files);
-
-        // skip first path as we already know the duration
-        for (int i = 1; i < files.Size(); i++)
-        {
-           int duration = 0;
-           if (CDVDFileInfo::GetFileDuration(files[i]->GetDynPath(), duration))
-             p->m_iDuration = p->m_iDuration + duration;
-        }
-      }
-
       // finally, calculate seconds
       if (p->m_iDuration > 0)
         p->m_iDuration = p->m_iDuration / 1000;
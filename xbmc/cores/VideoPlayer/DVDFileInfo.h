@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,6 +24,12 @@ class CTextureDetails;
 class CDVDFileInfo
 {
 public:
+  /*!
+   * @brief Extract a thumbnail of a chapter of a file. The file stays open for a moment, so
+   * thumbnails of further chapters of the same file don't probe it again.
+   * @param chapterNumber chapter to extract the thumbnail of, 0 for a frame approx 1/3 into the video
+   * @return the thumbnail, empty if extraction failed
+   */
   static std::unique_ptr<CTexture> ExtractThumbToTexture(const CFileItem& fileItem,
                                                          int chapterNumber = 0);
 
@@ -36,11 +43,30 @@ public:
 
   static bool GetFileDuration(const std::string& path, int& duration);
 
+  /*!
+   * @brief Probe the streams of files in the background, so their details are cached by the time
+   * they're needed.
+   * @param paths files to probe, files which are cached already are skipped
+   * @param isCancelled checked before each file, probing stops once it returns true
+   */
+  static void PrewarmStreamDetails(std::vector<std::string> paths,
+                                   std::function<bool()> isCancelled);
+
 private:
+  /*!
+   * @brief Get the streams of a file from the stream details cache, or probe and cache them.
+   * @param[out] duration length of the file in ms
+   * @param[out] isPVR whether the file was opened as a PVR stream
+   * @return false if the file couldn't be opened
+   */
+  static bool GetStreamDetails(const std::string& path,
+                               CStreamDetails& details,
+                               int& duration,
+                               bool& isPVR);
+
   static bool DemuxerToStreamDetails(const std::shared_ptr<CDVDInputStream>& pInputStream,
                                      CDVDDemux* pDemux,
-                                     CStreamDetails& details,
-                                     const std::string& path = "");
+                                     CStreamDetails& details);
 
   /** \brief Probe the file's internal and external streams and store the info in the StreamDetails parameter.
   *   \param[out] details The file's StreamDetails consisting of internal streams and external subtitle streams.
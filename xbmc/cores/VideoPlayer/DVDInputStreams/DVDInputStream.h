@@ -169,6 +169,14 @@ public:
   virtual bool Open();
   virtual void Close();
   virtual int Read(uint8_t* buf, int buf_size) = 0;
+
+  /*! \brief Borrow data at the read position without copying it.
+   *  Has to be followed by ReleaseSpan() before any other call on the stream.
+   \return number of bytes available at data, 0 at EOF, -1 if not supported and the data has to
+   be read with Read(), -2 on error, e.g. a timeout waiting for data
+   */
+  virtual int ReadSpan(const uint8_t*& data, int size) { return -1; }
+  virtual void ReleaseSpan(int consumed) {}
   virtual int64_t Seek(int64_t offset, int whence) = 0;
   virtual int64_t GetLength() = 0;
   virtual std::string& GetContent() { return m_content; }
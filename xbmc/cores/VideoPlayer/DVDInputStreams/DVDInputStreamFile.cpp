@@ -47,7 +47,7 @@ bool CDVDInputStreamFile::Open()
 
   // If this file is audio and/or video (= not a subtitle) flag to caller
   if (!VIDEO::IsSubtitle(m_item))
-    flags |= READ_AUDIO_VIDEO;
+    flags |= READ_AUDIO_VIDEO | READ_QUEUED;
   else
     flags |= READ_NO_BUFFER; // disable CFileStreamBuffer for subtitles
 
@@ -105,6 +105,24 @@ int CDVDInputStreamFile::Read(uint8_t* buf, int buf_size)
   return (int)ret;
 }
 
+int CDVDInputStreamFile::ReadSpan(const uint8_t*& data, int size)
+{
+  if (!m_pFile)
+    return -1;
+
+  const ssize_t ret = m_pFile->ReadSpan(data, size);
+  if (ret == 0)
+    m_eof = true;
+
+  return static_cast<int>(ret);
+}
+
+void CDVDInputStreamFile::ReleaseSpan(int consumed)
+{
+  if (m_pFile)
+    m_pFile->ReleaseSpan(consumed);
+}
+
 int64_t CDVDInputStreamFile::Seek(int64_t offset, int whence)
 {
   if(!m_pFile) return -1;
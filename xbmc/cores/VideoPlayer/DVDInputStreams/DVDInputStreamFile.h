@@ -18,6 +18,8 @@ public:
   bool Open() override;
   void Close() override;
   int Read(uint8_t* buf, int buf_size) override;
+  int ReadSpan(const uint8_t*& data, int size) override;
+  void ReleaseSpan(int consumed) override;
   int64_t Seek(int64_t offset, int whence) override;
   bool IsEOF() override;
   int64_t GetLength() override;
@@ -14,9 +14,20 @@
 
 #include <math.h>
 #include <mutex>
+#include <thread>
 
 using namespace std::chrono_literals;
 
+namespace
+{
+double GetPacketTime(const DemuxPacket* packet)
+{
+  if (packet->dts != DVD_NOPTS_VALUE)
+    return packet->dts;
+  return packet->pts;
+}
+} // unnamed namespace
+
 CDVDMessageQueue::CDVDMessageQueue(const std::string &owner) : m_hEvent(true), m_owner(owner)
 {
   m_iDataSize     = 0;
@@ -36,29 +47,49 @@ CDVDMessageQueue::~CDVDMessageQueue()
 
 void CDVDMessageQueue::Init()
 {
+  std::unique_lock lock(m_section);
+
+  // messages put into the ingress ring during a previous session must not survive into this one
+  m_bInitialized = false;
+  WaitForPuts();
+  std::shared_ptr<CDVDMsg> msg;
+  while (m_ingress.TryPop(msg))
+    msg.reset();
+
   m_iDataSize = 0;
   m_bAbortRequest = false;
-  m_bInitialized = true;
   m_TimeBack = DVD_NOPTS_VALUE;
   m_TimeFront = DVD_NOPTS_VALUE;
   m_drain = false;
+  m_bInitialized = true;
 }
 
 void CDVDMessageQueue::Flush(CDVDMsg::Message type)
 {
   std::unique_lock lock(m_section);
 
-  m_messages.remove_if([type](const DVDMessageListItem &item){
-    return type == CDVDMsg::NONE || item.message->IsType(type);
-  });
+  DrainIngress();
+
+  // packets still on their way into the ingress ring are already accounted for, so only subtract
+  // what is actually removed instead of resetting the data size
+  int removedSize = 0;
+  m_messages.RemoveIf(
+      [this, type, &removedSize](const std::shared_ptr<CDVDMsg>& msg)
+      {
+        if (type != CDVDMsg::NONE && !msg->IsType(type))
+          return false;
+        removedSize += GetPacketSize(msg);
+        return true;
+      });
 
   m_prioMessages.remove_if([type](const DVDMessageListItem &item){
     return type == CDVDMsg::NONE || item.message->IsType(type);
   });
 
+  m_iDataSize -= removedSize;
+
   if (type == CDVDMsg::DEMUXER_PACKET ||  type == CDVDMsg::NONE)
   {
-    m_iDataSize = 0;
     m_TimeBack = DVD_NOPTS_VALUE;
     m_TimeFront = DVD_NOPTS_VALUE;
   }
@@ -78,9 +109,11 @@ void CDVDMessageQueue::End()
 {
   std::unique_lock lock(m_section);
 
+  // puts that saw the queue initialized finish first, their messages are discarded by the flush
+  m_bInitialized = false;
+  WaitForPuts();
   Flush(CDVDMsg::NONE);
 
-  m_bInitialized = false;
   m_iDataSize = 0;
   m_bAbortRequest = false;
 }
@@ -99,8 +132,6 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
                                          int priority,
                                          bool front)
 {
-  std::unique_lock lock(m_section);
-
   if (!m_bInitialized)
   {
     CLog::Log(LOGWARNING, "CDVDMessageQueue({})::Put MSGQ_NOT_INITIALIZED", m_owner);
@@ -112,6 +143,60 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     return MSGQ_INVALID_MSG;
   }
 
+  if (priority <= 0 && front)
+  {
+    // Init() and End() wait for puts in flight, so a put either sees the queue uninitialized or
+    // its message is discarded by them
+    ++m_putsInFlight;
+    if (!m_bInitialized)
+    {
+      --m_putsInFlight;
+      return MSGQ_NOT_INITIALIZED;
+    }
+
+    // account before publishing, so the consumer never subtracts a packet that was not added yet
+    AddPacket(pMsg, true);
+
+    if (m_ingress.TryPush(pMsg))
+    {
+      // End() flipped the flag meanwhile and discards the message once this put is done
+      const bool initialized = m_bInitialized;
+      --m_putsInFlight;
+      if (!initialized)
+        return MSGQ_NOT_INITIALIZED;
+
+      NotifyConsumer();
+      return MSGQ_OK;
+    }
+
+    // the consumer is lagging behind, take the locked path, accounting again under the lock as
+    // the session might end before it is taken
+    m_iDataSize -= GetPacketSize(pMsg);
+    --m_putsInFlight;
+
+    // append behind whatever is still in the ingress ring, including messages other producers
+    // reserved a slot for but did not publish yet
+    const size_t reserved = m_ingress.GetPushPosition();
+    std::unique_lock lock(m_section);
+    if (!m_bInitialized)
+      return MSGQ_NOT_INITIALIZED;
+
+    AddPacket(pMsg, true);
+    DrainIngress();
+    while (m_ingress.GetPopPosition() < reserved)
+    {
+      std::this_thread::yield();
+      DrainIngress();
+    }
+    m_messages.PushFront(pMsg);
+    m_hEvent.Set();
+    return MSGQ_OK;
+  }
+
+  std::unique_lock lock(m_section);
+
+  DrainIngress();
+
   if (priority > 0)
   {
     int prio = priority;
@@ -126,30 +211,8 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
   }
   else
   {
-    if (m_messages.empty())
-    {
-      m_iDataSize = 0;
-      m_TimeBack = DVD_NOPTS_VALUE;
-      m_TimeFront = DVD_NOPTS_VALUE;
-    }
-
-    if (front)
-      m_messages.emplace_front(pMsg, priority);
-    else
-      m_messages.emplace_back(pMsg, priority);
-  }
-
-  if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && priority == 0)
-  {
-    DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(pMsg.get())->GetPacket();
-    if (packet)
-    {
-      m_iDataSize += packet->iSize;
-      if (front)
-        UpdateTimeFront();
-      else
-        UpdateTimeBack();
-    }
+    m_messages.PushBack(pMsg);
+    AddPacket(pMsg, false);
   }
 
   // inform waiter for new packet
@@ -174,45 +237,56 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
+    DrainIngress();
 
-    if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
+    if (priority > 0 || !m_prioMessages.empty())
     {
-      DVDMessageListItem& item(msgs.back());
-      priority = item.priority;
-
-      if (item.message->IsType(CDVDMsg::DEMUXER_PACKET) && item.priority == 0)
+      if (!m_prioMessages.empty() && (m_prioMessages.back().priority >= priority || m_drain))
       {
-        DemuxPacket* packet =
-            std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-        if (packet)
-        {
-          m_iDataSize -= packet->iSize;
-        }
+        DVDMessageListItem& item(m_prioMessages.back());
+        priority = item.priority;
+        pMsg = std::move(item.message);
+        m_prioMessages.pop_back();
+        ret = MSGQ_OK;
+        break;
       }
-
-      pMsg = std::move(item.message);
-      msgs.pop_back();
+    }
+    else if (!m_messages.Empty())
+    {
+      priority = 0;
+      pMsg = m_messages.PopBack();
+      m_iDataSize -= GetPacketSize(pMsg);
       UpdateTimeBack();
       ret = MSGQ_OK;
       break;
     }
-    else if (timeout == 0ms)
+
+    if (timeout == 0ms)
     {
       ret = MSGQ_TIMEOUT;
       break;
     }
-    else
-    {
-      m_hEvent.Reset();
-      lock.unlock();
 
-      // wait for a new message
-      if (!m_hEvent.Wait(timeout))
-        return MSGQ_TIMEOUT;
+    m_hEvent.Reset();
 
-      lock.lock();
+    // producers of the lock-free path only signal the event if they see us waiting
+    m_consumerWaiting = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!m_ingress.IsEmpty())
+    {
+      m_consumerWaiting = false;
+      continue;
     }
+
+    lock.unlock();
+
+    // wait for a new message
+    const bool signaled = m_hEvent.Wait(timeout);
+    m_consumerWaiting = false;
+    if (!signaled)
+      return MSGQ_TIMEOUT;
+
+    lock.lock();
   }
 
   if (m_bAbortRequest)
@@ -221,48 +295,84 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
   return (MsgQueueReturnCode)ret;
 }
 
-void CDVDMessageQueue::UpdateTimeFront()
+void CDVDMessageQueue::DrainIngress()
 {
-  if (!m_messages.empty())
-  {
-    auto &item = m_messages.front();
-    if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
-    {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-      if (packet)
-      {
-        if (packet->dts != DVD_NOPTS_VALUE)
-          m_TimeFront = packet->dts;
-        else if (packet->pts != DVD_NOPTS_VALUE)
-          m_TimeFront = packet->pts;
+  std::shared_ptr<CDVDMsg> msg;
+  while (m_ingress.TryPop(msg))
+    m_messages.PushFront(std::move(msg));
+}
 
-        if (m_TimeBack == DVD_NOPTS_VALUE)
-          m_TimeBack = m_TimeFront;
-      }
-    }
+void CDVDMessageQueue::WaitForPuts()
+{
+  while (m_putsInFlight > 0)
+    std::this_thread::yield();
+}
+
+void CDVDMessageQueue::NotifyConsumer()
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_consumerWaiting)
+    m_hEvent.Set();
+}
+
+int CDVDMessageQueue::GetPacketSize(const std::shared_ptr<CDVDMsg>& msg) const
+{
+  if (!msg->IsType(CDVDMsg::DEMUXER_PACKET))
+    return 0;
+
+  const DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(msg.get())->GetPacket();
+  return packet ? packet->iSize : 0;
+}
+
+void CDVDMessageQueue::AddPacket(const std::shared_ptr<CDVDMsg>& msg, bool front)
+{
+  if (!msg->IsType(CDVDMsg::DEMUXER_PACKET))
+    return;
+
+  const DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(msg.get())->GetPacket();
+  if (!packet)
+    return;
+
+  m_iDataSize += packet->iSize;
+
+  const double time = GetPacketTime(packet);
+  if (time == DVD_NOPTS_VALUE)
+    return;
+
+  double unset = DVD_NOPTS_VALUE;
+  if (front)
+  {
+    m_TimeFront = time;
+    m_TimeBack.compare_exchange_strong(unset, time);
+  }
+  else
+  {
+    m_TimeBack = time;
+    m_TimeFront.compare_exchange_strong(unset, time);
   }
 }
 
 void CDVDMessageQueue::UpdateTimeBack()
 {
-  if (!m_messages.empty())
+  if (m_messages.Empty())
   {
-    auto &item = m_messages.back();
-    if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
+    // nothing left to play, the next packet starts a new range
+    m_TimeBack = m_TimeFront.load();
+    return;
+  }
+
+  const std::shared_ptr<CDVDMsg>& msg = m_messages.Back();
+  if (msg->IsType(CDVDMsg::DEMUXER_PACKET))
+  {
+    const DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(msg.get())->GetPacket();
+    if (packet)
     {
-      DemuxPacket* packet =
-          std::static_pointer_cast<CDVDMsgDemuxerPacket>(item.message)->GetPacket();
-      if (packet)
-      {
-        if (packet->dts != DVD_NOPTS_VALUE)
-          m_TimeBack = packet->dts;
-        else if (packet->pts != DVD_NOPTS_VALUE)
-          m_TimeBack = packet->pts;
+      const double time = GetPacketTime(packet);
+      if (time != DVD_NOPTS_VALUE)
+        m_TimeBack = time;
 
-        if (m_TimeFront == DVD_NOPTS_VALUE)
-          m_TimeFront = m_TimeBack;
-      }
+      double unset = DVD_NOPTS_VALUE;
+      m_TimeFront.compare_exchange_strong(unset, m_TimeBack.load());
     }
   }
 }
@@ -274,10 +384,12 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
   if (!m_bInitialized)
     return 0;
 
+  DrainIngress();
+
   unsigned count = 0;
-  for (const auto &item : m_messages)
+  for (size_t i = 0; i < m_messages.Size(); ++i)
   {
-    if(item.message->IsType(type))
+    if (m_messages.At(i)->IsType(type))
       count++;
   }
   for (const auto &item : m_prioMessages)
@@ -309,22 +421,22 @@ void CDVDMessageQueue::WaitUntilEmpty()
 
 int CDVDMessageQueue::GetLevel(bool dataLevel) const
 {
-  std::unique_lock lock(m_section);
+  const int dataSize = m_iDataSize;
 
-  if (m_iDataSize > m_iMaxDataSize)
+  if (dataSize > m_iMaxDataSize)
     return 100;
-  if (m_iDataSize == 0)
+  if (dataSize <= 0)
     return 0;
 
   if (IsDataBased() || dataLevel)
   {
-    return std::min(100, 100 * m_iDataSize / m_iMaxDataSize);
+    return std::min(100, 100 * dataSize / m_iMaxDataSize);
   }
 
   int level = std::min(100.0, ceil(100.0 * m_TimeSize * (m_TimeFront - m_TimeBack) / DVD_TIME_BASE ));
 
   // if we added lots of packets with NOPTS, make sure that the queue is not signalled empty
-  if (level == 0 && m_iDataSize != 0)
+  if (level == 0 && dataSize != 0)
   {
     CLog::Log(LOGDEBUG, "CDVDMessageQueue::GetLevel() - can't determine level");
     return 1;
@@ -335,8 +447,6 @@ int CDVDMessageQueue::GetLevel(bool dataLevel) const
 
 double CDVDMessageQueue::GetTimeSize() const
 {
-  std::unique_lock lock(m_section);
-
   if (IsDataBased())
     return 0.0;
   else
@@ -345,9 +455,10 @@ double CDVDMessageQueue::GetTimeSize() const
 
 bool CDVDMessageQueue::IsDataBased() const
 {
-  std::unique_lock lock(m_section);
+  const double timeBack = m_TimeBack;
+  const double timeFront = m_TimeFront;
 
-  return (m_TimeBack == DVD_NOPTS_VALUE  ||
-          m_TimeFront == DVD_NOPTS_VALUE ||
-          m_TimeFront <= m_TimeBack);
+  return (timeBack == DVD_NOPTS_VALUE  ||
+          timeFront == DVD_NOPTS_VALUE ||
+          timeFront <= timeBack);
 }
@@ -9,8 +9,10 @@
 #pragma once
 
 #include "DVDMessage.h"
+#include "DVDMessageRing.h"
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
+#include "utils/MPSCRing.h"
 
 #include <algorithm>
 #include <atomic>
@@ -45,6 +47,14 @@ enum MsgQueueReturnCode
 
 #define MSGQ_IS_ERROR(c)    (c < 0)
 
+/*!
+ * \brief Message queue between the player and its stream players.
+ *
+ * Demuxer packets are put by the demux thread and consumed by a single stream player thread. That
+ * hot path goes through a lock-free ingress ring and does not take m_section. Messages with a
+ * priority, PutBack() and all consumer side operations are serialised by m_section, which also
+ * protects draining the ingress ring into m_messages.
+ */
 class CDVDMessageQueue
 {
 public:
@@ -99,25 +109,32 @@ public:
 
 private:
   MsgQueueReturnCode Put(const std::shared_ptr<CDVDMsg>& pMsg, int priority, bool front);
-  void UpdateTimeFront();
+  void AddPacket(const std::shared_ptr<CDVDMsg>& msg, bool front);
+  int GetPacketSize(const std::shared_ptr<CDVDMsg>& msg) const;
   void UpdateTimeBack();
+  void DrainIngress();
+  void WaitForPuts();
+  void NotifyConsumer();
 
   CEvent m_hEvent;
   mutable CCriticalSection m_section;
 
   std::atomic<bool> m_bAbortRequest = false;
-  bool m_bInitialized;
+  std::atomic<bool> m_bInitialized;
+  std::atomic<bool> m_consumerWaiting = false;
+  std::atomic<int> m_putsInFlight = 0; //!< puts on the lock-free path
   bool m_drain = false;
 
-  int m_iDataSize;
-  double m_TimeFront;
-  double m_TimeBack;
+  std::atomic<int> m_iDataSize;
+  std::atomic<double> m_TimeFront;
+  std::atomic<double> m_TimeBack;
   double m_TimeSize;
 
   int m_iMaxDataSize;
   std::string m_owner;
 
-  std::list<DVDMessageListItem> m_messages;
+  KODI::UTILS::CMPSCRing<std::shared_ptr<CDVDMsg>> m_ingress{1024};
+  CDVDMessageRing m_messages;
   std::list<DVDMessageListItem> m_prioMessages;
 };
 
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDMessageRing.h"
+
+#include "DVDMessage.h"
+
+#include <algorithm>
+#include <bit>
+
+CDVDMessageRing::CDVDMessageRing(size_t capacity)
+  : m_items(std::bit_ceil(std::max<size_t>(capacity, 2))), m_mask(m_items.size() - 1)
+{
+}
+
+void CDVDMessageRing::PushFront(std::shared_ptr<CDVDMsg> msg)
+{
+  if (m_size == m_items.size())
+    Grow();
+
+  At(m_size) = std::move(msg);
+  ++m_size;
+}
+
+void CDVDMessageRing::PushBack(std::shared_ptr<CDVDMsg> msg)
+{
+  if (m_size == m_items.size())
+    Grow();
+
+  m_first = (m_first - 1) & m_mask;
+  At(0) = std::move(msg);
+  ++m_size;
+}
+
+std::shared_ptr<CDVDMsg> CDVDMessageRing::PopBack()
+{
+  std::shared_ptr<CDVDMsg> msg = std::move(At(0));
+  m_first = (m_first + 1) & m_mask;
+  --m_size;
+  return msg;
+}
+
+void CDVDMessageRing::Grow()
+{
+  std::vector<std::shared_ptr<CDVDMsg>> items(m_items.size() * 2);
+  for (size_t i = 0; i < m_size; ++i)
+    items[i] = std::move(At(i));
+
+  m_items.swap(items);
+  m_mask = m_items.size() - 1;
+  m_first = 0;
+}
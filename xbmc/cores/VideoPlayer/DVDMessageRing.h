@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class CDVDMsg;
+
+/*!
+ * \brief Growable circular buffer of messages.
+ *
+ * Slots are reused once the buffer has grown to the working set of the queue, so pushing and
+ * popping messages does not allocate. Index 0 is the back, i.e. the oldest message and the next
+ * one to be consumed. Not thread safe.
+ */
+class CDVDMessageRing
+{
+public:
+  explicit CDVDMessageRing(size_t capacity = 256);
+
+  bool Empty() const { return m_size == 0; }
+  size_t Size() const { return m_size; }
+
+  std::shared_ptr<CDVDMsg>& Back() { return At(0); }
+  std::shared_ptr<CDVDMsg>& Front() { return At(m_size - 1); }
+  std::shared_ptr<CDVDMsg>& At(size_t index) { return m_items[(m_first + index) & m_mask]; }
+
+  void PushFront(std::shared_ptr<CDVDMsg> msg);
+  void PushBack(std::shared_ptr<CDVDMsg> msg);
+  std::shared_ptr<CDVDMsg> PopBack();
+
+  /*!
+   * \brief Remove all messages for which pred returns true, keeping the order of the others.
+   */
+  template<typename Pred>
+  void RemoveIf(Pred pred)
+  {
+    size_t kept = 0;
+    for (size_t i = 0; i < m_size; ++i)
+    {
+      std::shared_ptr<CDVDMsg>& msg = At(i);
+      if (pred(msg))
+        msg.reset();
+      else if (kept++ != i)
+        At(kept - 1) = std::move(msg);
+    }
+    m_size = kept;
+  }
+
+private:
+  void Grow();
+
+  std::vector<std::shared_ptr<CDVDMsg>> m_items;
+  size_t m_mask;
+  size_t m_first = 0;
+  size_t m_size = 0;
+};
@@ -19,6 +19,8 @@ extern "C"
 {
 #endif /* __cplusplus */
 
+  struct AVBufferRef;
+
   struct DemuxPacket : DEMUX_PACKET
   {
     DemuxPacket()
@@ -43,6 +45,10 @@ extern "C"
 
     //! @brief PTS offset correction applied to the PTS and DTS.
     double m_ptsOffsetCorrection{0};
+
+    //! @brief FFmpeg buffer holding pData if the payload is shared with the demuxer instead of
+    //! copied, nullptr otherwise.
+    AVBufferRef* m_buffer{nullptr};
   };
 
 #ifdef __cplusplus
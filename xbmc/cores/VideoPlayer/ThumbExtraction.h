@@ -0,0 +1,178 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+#include "threads/Timer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Bounds the memory of thumbnail extractions running concurrently.
+ */
+class CThumbExtractionBudget
+{
+public:
+  explicit CThumbExtractionBudget(size_t limit) : m_limit(limit) {}
+
+  /*!
+   * \brief Wait until \p bytes fit into the budget. A single extraction is always admitted, even
+   * if it exceeds the budget on its own.
+   */
+  void Acquire(size_t bytes)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_released.wait(lock, [this, bytes] { return m_used == 0 || m_used + bytes <= m_limit; });
+    m_used += bytes;
+  }
+
+  void Release(size_t bytes)
+  {
+    std::unique_lock lock(m_section);
+    m_used -= bytes;
+    m_released.notifyAll();
+  }
+
+  size_t GetUsed() const
+  {
+    std::unique_lock lock(m_section);
+    return m_used;
+  }
+
+private:
+  const size_t m_limit;
+  mutable CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_released;
+  size_t m_used = 0;
+};
+
+/*!
+ * \brief Keeps the extractors of recently used files open for a moment, thumbnails of the chapters
+ * of a file are usually requested one after the other.
+ *
+ * Extractors are kept per file, so jobs extracting thumbnails of different files in parallel don't
+ * close each other's extractors. At most \p maxIdle extractors are kept, the one expiring first is
+ * closed to make room for another file.
+ *
+ * \tparam Extractor extractor type, providing GetPath() for the file it has open
+ */
+template<typename Extractor>
+class CIdleThumbExtractor
+{
+public:
+  CIdleThumbExtractor(std::chrono::milliseconds timeout, size_t maxIdle)
+    : m_timeout(timeout), m_maxIdle(maxIdle)
+  {
+  }
+
+  /*!
+   * \brief Take the idle extractor of \p path if there is one and it hasn't expired yet.
+   * \return the extractor, nullptr if a new one has to be opened
+   */
+  std::unique_ptr<Extractor> Take(const std::string& path)
+  {
+    std::unique_ptr<Extractor> extractor;
+    std::unique_lock lock(m_section);
+    const auto it = m_idle.find(path);
+    if (it != m_idle.end() && std::chrono::steady_clock::now() < it->second.expiry)
+    {
+      extractor = std::move(it->second.extractor);
+      m_idle.erase(it);
+    }
+    return extractor;
+  }
+
+  /*!
+   * \brief Keep \p extractor for the next thumbnail of its file, replacing an idle extractor of the
+   * same file.
+   */
+  void Put(std::unique_ptr<Extractor> extractor)
+  {
+    // extractors replaced or expired are closed once the lock is released
+    std::vector<std::unique_ptr<Extractor>> closed;
+    std::unique_lock lock(m_section);
+    const auto now = std::chrono::steady_clock::now();
+    RemoveExpired(now, closed);
+
+    Slot& slot = m_idle[extractor->GetPath()];
+    if (slot.extractor)
+      closed.emplace_back(std::move(slot.extractor));
+    slot = {std::move(extractor), now + m_timeout};
+
+    while (m_idle.size() > m_maxIdle)
+    {
+      const auto first = std::ranges::min_element(
+          m_idle, [](const auto& a, const auto& b) { return a.second.expiry < b.second.expiry; });
+      closed.emplace_back(std::move(first->second.extractor));
+      m_idle.erase(first);
+    }
+
+    // CTimer isn't thread safe, it's only started and restarted with the lock held
+    const auto timeout = GetNextTimeout(now);
+    if (!m_timer.Start(timeout))
+      m_timer.RestartAsync(timeout);
+  }
+
+private:
+  struct Slot
+  {
+    std::unique_ptr<Extractor> extractor;
+    std::chrono::steady_clock::time_point expiry;
+  };
+
+  void RemoveExpired(std::chrono::steady_clock::time_point now,
+                     std::vector<std::unique_ptr<Extractor>>& closed)
+  {
+    for (auto it = m_idle.begin(); it != m_idle.end();)
+    {
+      if (it->second.expiry <= now)
+      {
+        closed.emplace_back(std::move(it->second.extractor));
+        it = m_idle.erase(it);
+      }
+      else
+        ++it;
+    }
+  }
+
+  std::chrono::milliseconds GetNextTimeout(std::chrono::steady_clock::time_point now) const
+  {
+    auto next = now + m_timeout;
+    for (const auto& [path, slot] : m_idle)
+      next = std::min(next, slot.expiry);
+    return std::max(std::chrono::ceil<std::chrono::milliseconds>(next - now),
+                    std::chrono::milliseconds(1));
+  }
+
+  void Expire()
+  {
+    std::vector<std::unique_ptr<Extractor>> closed;
+    std::unique_lock lock(m_section);
+    const auto now = std::chrono::steady_clock::now();
+    RemoveExpired(now, closed);
+    // restarting from within the callback keeps the timer running for the remaining extractors
+    if (!m_idle.empty())
+      m_timer.RestartAsync(GetNextTimeout(now));
+  }
+
+  const std::chrono::milliseconds m_timeout;
+  const size_t m_maxIdle;
+  CCriticalSection m_section;
+  std::map<std::string, Slot> m_idle;
+  CTimer m_timer{[this] { Expire(); }};
+};
@@ -1014,6 +1014,10 @@ void CVideoPlayer::CloseDemuxer()
   m_pDemuxer.reset();
   m_SelectionStreams.Clear(StreamType::NONE, STREAM_SOURCE_DEMUX);
 
+  // the packets of the next stream, e.g. after a channel switch, may differ in size. Seeks keep
+  // the pool, their packets are alike.
+  CDVDDemuxUtils::TrimPacketPool();
+
   CServiceBroker::GetDataCacheCore().SignalAudioInfoChange();
   CServiceBroker::GetDataCacheCore().SignalVideoInfoChange();
   CServiceBroker::GetDataCacheCore().SignalSubtitleInfoChange();
@@ -2867,6 +2871,9 @@ void CVideoPlayer::OnExit()
 
   m_messenger.End();
 
+  // don't keep packet memory around while nothing is played
+  CDVDDemuxUtils::TrimPacketPool();
+
   CFFmpegLog::ClearLogLevel();
   m_bStop = true;
 
@@ -3722,6 +3729,12 @@ void CVideoPlayer::GetGeneralInfo(std::string& strGeneralInfo)
                                     m_State.cache_offset * 100.0);
     }
 
+    const CDVDDemuxUtils::PacketPoolStats pool = CDVDDemuxUtils::GetPacketPoolStats();
+    strBuf += StringUtils::Format(
+        "{}pkt pool: {:.0f}% reused / {}", strBuf.empty() ? "" : ", ",
+        pool.allocations ? 100.0 * pool.reused / pool.allocations : 0.0,
+        StringUtils::SizeToString(static_cast<int64_t>(pool.pooledBytes)));
+
     strGeneralInfo = StringUtils::Format("Player: a/v:{: 6.3f}, {}", dDiff, strBuf);
   }
 }
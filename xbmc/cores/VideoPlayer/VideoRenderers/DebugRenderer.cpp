@@ -84,6 +84,8 @@ void CDebugRenderer::SetInfo(DEBUG_INFO_PLAYER& info)
   m_adapter->AddSubtitle(info.video, 0., 5000000.);
   m_adapter->AddSubtitle(info.player, 0., 5000000.);
   m_adapter->AddSubtitle(info.vsync, 0., 5000000.);
+  if (!info.jobs.empty())
+    m_adapter->AddSubtitle(info.jobs, 0., 5000000.);
 }
 
 void CDebugRenderer::SetInfo(DEBUG_INFO_VIDEO& video, DEBUG_INFO_RENDER& render)
@@ -16,12 +16,14 @@
 #include "ServiceBroker.h"
 #include "application/Application.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "jobs/JobManager.h"
 #include "messaging/ApplicationMessenger.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/SingleLock.h"
 #include "utils/StringUtils.h"
+#include "utils/TraceEvents.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
@@ -290,6 +292,7 @@ bool CRenderManager::IsPresenting()
 
 void CRenderManager::FrameMove()
 {
+  KODI_TRACE_SCOPE("video", "CRenderManager::FrameMove");
   bool firstFrame = false;
   UpdateResolution();
 
@@ -772,6 +775,9 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
                                             refreshrate, missedvblanks, clockspeed * 100);
         }
 
+        if (const auto jobManager = CServiceBroker::GetJobManager())
+          info.jobs = jobManager->GetStatistics().GetSummary();
+
         m_debugRenderer.SetInfo(info);
       }
 
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsg> MakePacket(int size, double pts)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+  packet->iSize = size;
+  packet->dts = pts;
+  packet->pts = pts;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+} // unnamed namespace
+
+static void BM_DVDMessageQueue_PutGet(benchmark::State& state)
+{
+  CDVDMessageQueue queue("bench");
+  queue.Init();
+  queue.SetMaxDataSize(64 * 1024 * 1024);
+
+  const int packetSize = static_cast<int>(state.range(0));
+  double pts = 0;
+  for (auto _ : state)
+  {
+    queue.Put(MakePacket(packetSize, pts));
+    pts += DVD_MSEC_TO_TIME(40);
+    std::shared_ptr<CDVDMsg> msg;
+    queue.Get(msg, 0ms);
+    benchmark::DoNotOptimize(msg);
+  }
+  state.SetItemsProcessed(state.iterations());
+  queue.End();
+}
+BENCHMARK(BM_DVDMessageQueue_PutGet)->Arg(188)->Arg(65536);
+
+static void BM_DVDMessageQueue_Levels(benchmark::State& state)
+{
+  CDVDMessageQueue queue("bench");
+  queue.Init();
+  queue.SetMaxDataSize(64 * 1024 * 1024);
+  for (int i = 0; i < 200; ++i)
+    queue.Put(MakePacket(4096, DVD_MSEC_TO_TIME(40) * i));
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(queue.GetLevel());
+    benchmark::DoNotOptimize(queue.GetTimeSize());
+    benchmark::DoNotOptimize(queue.GetDataSize());
+  }
+  queue.End();
+}
+BENCHMARK(BM_DVDMessageQueue_Levels);
+
+static void BM_DVDMessageQueue_ProducerConsumer(benchmark::State& state)
+{
+  constexpr int PACKETS = 10000;
+  for (auto _ : state)
+  {
+    CDVDMessageQueue queue("bench");
+    queue.Init();
+    queue.SetMaxDataSize(64 * 1024 * 1024);
+
+    std::thread consumer(
+        [&queue]
+        {
+          for (int received = 0; received < PACKETS;)
+          {
+            std::shared_ptr<CDVDMsg> msg;
+            if (queue.Get(msg, 100ms) == MSGQ_OK)
+              ++received;
+          }
+        });
+
+    for (int i = 0; i < PACKETS; ++i)
+      queue.Put(MakePacket(static_cast<int>(state.range(0)), DVD_MSEC_TO_TIME(40) * i));
+
+    consumer.join();
+    queue.End();
+  }
+  state.SetItemsProcessed(state.iterations() * PACKETS);
+}
+BENCHMARK(BM_DVDMessageQueue_ProducerConsumer)->Arg(188)->Arg(65536)->UseRealTime();
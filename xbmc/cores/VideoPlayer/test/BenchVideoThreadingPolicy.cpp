@@ -0,0 +1,228 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "cores/VideoPlayer/DVDCodecs/Video/VideoThreadingPolicy.h"
+#include "utils/CPUInfo.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavutil/frame.h>
+}
+
+namespace
+{
+constexpr int CLIP_FRAMES = 48;
+constexpr int CLIP_FPS = 25;
+
+enum class Threading
+{
+  SINGLE,
+  CPU_COUNT, //!< the former heuristic of 3/2 threads per core
+  POLICY
+};
+
+struct PacketDeleter
+{
+  void operator()(AVPacket* packet) const { av_packet_free(&packet); }
+};
+
+struct FrameDeleter
+{
+  void operator()(AVFrame* frame) const { av_frame_free(&frame); }
+};
+
+struct ContextDeleter
+{
+  void operator()(AVCodecContext* context) const { avcodec_free_context(&context); }
+};
+
+using Packet = std::unique_ptr<AVPacket, PacketDeleter>;
+using Clip = std::vector<Packet>;
+
+/*!
+ \brief Encode a clip of a moving pattern, there are no sample clips in the tree.
+ */
+Clip EncodeClip(AVCodecID codecId, int height)
+{
+  Clip clip;
+  const AVCodec* codec = avcodec_find_encoder(codecId);
+  if (!codec)
+    return clip;
+
+  std::unique_ptr<AVCodecContext, ContextDeleter> context(avcodec_alloc_context3(codec));
+  context->width = (height * 16 / 9) & ~15;
+  context->height = height;
+  context->pix_fmt = AV_PIX_FMT_YUV420P;
+  context->time_base = {1, CLIP_FPS};
+  context->framerate = {CLIP_FPS, 1};
+  context->gop_size = 12;
+  context->max_b_frames = 2;
+  context->bit_rate = static_cast<int64_t>(context->width) * height * CLIP_FPS / 4;
+  if (avcodec_open2(context.get(), codec, nullptr) < 0)
+    return clip;
+
+  std::unique_ptr<AVFrame, FrameDeleter> frame(av_frame_alloc());
+  frame->format = context->pix_fmt;
+  frame->width = context->width;
+  frame->height = context->height;
+  if (av_frame_get_buffer(frame.get(), 0) < 0)
+    return clip;
+
+  auto receive = [&clip, &context]
+  {
+    Packet packet(av_packet_alloc());
+    while (avcodec_receive_packet(context.get(), packet.get()) == 0)
+    {
+      clip.emplace_back(std::move(packet));
+      packet.reset(av_packet_alloc());
+    }
+  };
+
+  for (int i = 0; i < CLIP_FRAMES; ++i)
+  {
+    av_frame_make_writable(frame.get());
+    for (int y = 0; y < frame->height; ++y)
+    {
+      for (int x = 0; x < frame->width; ++x)
+        frame->data[0][y * frame->linesize[0] + x] = static_cast<uint8_t>(x + y + i * 3);
+    }
+    for (int y = 0; y < frame->height / 2; ++y)
+    {
+      for (int x = 0; x < frame->width / 2; ++x)
+      {
+        frame->data[1][y * frame->linesize[1] + x] = static_cast<uint8_t>(128 + y + i * 2);
+        frame->data[2][y * frame->linesize[2] + x] = static_cast<uint8_t>(64 + x + i * 5);
+      }
+    }
+    frame->pts = i;
+    if (avcodec_send_frame(context.get(), frame.get()) < 0)
+      break;
+    receive();
+  }
+
+  avcodec_send_frame(context.get(), nullptr);
+  receive();
+  return clip;
+}
+
+const Clip& GetClip(AVCodecID codecId, int height)
+{
+  static std::map<std::pair<AVCodecID, int>, Clip> clips;
+  auto it = clips.find({codecId, height});
+  if (it == clips.end())
+    it = clips.emplace(std::make_pair(codecId, height), EncodeClip(codecId, height)).first;
+  return it->second;
+}
+
+void DecodeClip(benchmark::State& state, AVCodecID codecId, Threading threading)
+{
+  if (!CServiceBroker::GetCPUInfo())
+    CServiceBroker::RegisterCPUInfo(CCPUInfo::GetCPUInfo());
+
+  const int height = static_cast<int>(state.range(0));
+  const Clip& clip = GetClip(codecId, height);
+  const AVCodec* codec = avcodec_find_decoder(codecId);
+  if (clip.empty() || !codec)
+  {
+    state.SkipWithError("codec not available");
+    return;
+  }
+
+  const int cpuCount = static_cast<int>(CServiceBroker::GetCPUInfo()->GetCPUCount());
+  CVideoThreadingPolicy::Decision decision;
+  if (threading == Threading::CPU_COUNT)
+  {
+    decision.threadCount = std::min(cpuCount * 3 / 2, 16);
+  }
+  else if (threading == Threading::POLICY)
+  {
+    CVideoThreadingPolicy policy(cpuCount);
+    decision = policy.Decide({codecId, codec->capabilities, (height * 16 / 9) & ~15, height,
+                              static_cast<double>(CLIP_FPS)});
+  }
+
+  std::unique_ptr<AVFrame, FrameDeleter> frame(av_frame_alloc());
+  int64_t frames = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    std::unique_ptr<AVCodecContext, ContextDeleter> context(avcodec_alloc_context3(codec));
+    context->thread_count = decision.threadCount;
+    if (decision.threadType)
+      context->thread_type = decision.threadType;
+    if (avcodec_open2(context.get(), codec, nullptr) < 0)
+    {
+      state.SkipWithError("failed to open decoder");
+      break;
+    }
+    state.ResumeTiming();
+
+    for (const auto& packet : clip)
+    {
+      avcodec_send_packet(context.get(), packet.get());
+      while (avcodec_receive_frame(context.get(), frame.get()) == 0)
+        ++frames;
+    }
+    avcodec_send_packet(context.get(), nullptr);
+    while (avcodec_receive_frame(context.get(), frame.get()) == 0)
+      ++frames;
+
+    state.PauseTiming();
+    context.reset();
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(frames);
+  state.counters["threads"] = decision.threadCount;
+}
+} // unnamed namespace
+
+// mpeg4 decodes with frame threads, mpeg2video with slice threads
+static void BM_VideoDecode_Mpeg4(benchmark::State& state, Threading threading)
+{
+  DecodeClip(state, AV_CODEC_ID_MPEG4, threading);
+}
+BENCHMARK_CAPTURE(BM_VideoDecode_Mpeg4, Single, Threading::SINGLE)
+    ->Arg(576)
+    ->Arg(1080)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_VideoDecode_Mpeg4, CPUCount, Threading::CPU_COUNT)
+    ->Arg(576)
+    ->Arg(1080)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_VideoDecode_Mpeg4, Policy, Threading::POLICY)
+    ->Arg(576)
+    ->Arg(1080)
+    ->UseRealTime();
+
+static void BM_VideoDecode_Mpeg2(benchmark::State& state, Threading threading)
+{
+  DecodeClip(state, AV_CODEC_ID_MPEG2VIDEO, threading);
+}
+BENCHMARK_CAPTURE(BM_VideoDecode_Mpeg2, Single, Threading::SINGLE)
+    ->Arg(576)
+    ->Arg(1080)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_VideoDecode_Mpeg2, CPUCount, Threading::CPU_COUNT)
+    ->Arg(576)
+    ->Arg(1080)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_VideoDecode_Mpeg2, Policy, Threading::POLICY)
+    ->Arg(576)
+    ->Arg(1080)
+    ->UseRealTime();
@@ -0,0 +1,276 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsg> MakePacket(int size, double dts, int streamId = 0)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+  packet->iSize = size;
+  packet->dts = dts;
+  packet->pts = dts;
+  packet->iStreamId = streamId;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+
+DemuxPacket* GetPacket(const std::shared_ptr<CDVDMsg>& msg)
+{
+  if (!msg || !msg->IsType(CDVDMsg::DEMUXER_PACKET))
+    return nullptr;
+  return std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket();
+}
+
+class TestDVDMessageQueue : public testing::Test
+{
+protected:
+  TestDVDMessageQueue() : m_queue("test")
+  {
+    m_queue.Init();
+    m_queue.SetMaxDataSize(16 * 1024 * 1024);
+  }
+  ~TestDVDMessageQueue() override { m_queue.End(); }
+
+  CDVDMessageQueue m_queue;
+};
+} // unnamed namespace
+
+TEST_F(TestDVDMessageQueue, FifoOrder)
+{
+  for (int i = 0; i < 100; ++i)
+    EXPECT_EQ(MSGQ_OK, m_queue.Put(MakePacket(10, DVD_MSEC_TO_TIME(40) * i)));
+
+  EXPECT_EQ(1000, m_queue.GetDataSize());
+  EXPECT_EQ(100U, m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+  EXPECT_DOUBLE_EQ(3.96, m_queue.GetTimeSize());
+
+  for (int i = 0; i < 100; ++i)
+  {
+    std::shared_ptr<CDVDMsg> msg;
+    ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+    DemuxPacket* packet = GetPacket(msg);
+    ASSERT_NE(nullptr, packet);
+    EXPECT_DOUBLE_EQ(DVD_MSEC_TO_TIME(40) * i, packet->dts);
+  }
+
+  std::shared_ptr<CDVDMsg> msg;
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(0, m_queue.GetDataSize());
+  EXPECT_EQ(0, m_queue.GetLevel());
+}
+
+TEST_F(TestDVDMessageQueue, PriorityAndPutBack)
+{
+  m_queue.Put(MakePacket(10, DVD_MSEC_TO_TIME(0)));
+  m_queue.Put(MakePacket(10, DVD_MSEC_TO_TIME(40)));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC), 1);
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_FLUSH), 2);
+
+  std::shared_ptr<CDVDMsg> msg;
+  int priority = 0;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms, priority));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_FLUSH));
+  EXPECT_EQ(2, priority);
+
+  priority = 0;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms, priority));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESYNC));
+  EXPECT_EQ(1, priority);
+
+  // only high priority messages requested
+  priority = 1;
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms, priority));
+
+  priority = 0;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms, priority));
+  EXPECT_EQ(0, priority);
+  ASSERT_NE(nullptr, GetPacket(msg));
+  EXPECT_DOUBLE_EQ(DVD_MSEC_TO_TIME(0), GetPacket(msg)->dts);
+
+  // a message put back is returned before everything else
+  EXPECT_EQ(MSGQ_OK, m_queue.PutBack(msg));
+  EXPECT_EQ(20, m_queue.GetDataSize());
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_DOUBLE_EQ(DVD_MSEC_TO_TIME(0), GetPacket(msg)->dts);
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_DOUBLE_EQ(DVD_MSEC_TO_TIME(40), GetPacket(msg)->dts);
+  EXPECT_EQ(0, m_queue.GetDataSize());
+}
+
+TEST_F(TestDVDMessageQueue, Flush)
+{
+  for (int i = 0; i < 10; ++i)
+    m_queue.Put(MakePacket(100, DVD_MSEC_TO_TIME(40) * i));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_EOF));
+
+  m_queue.Flush();
+  EXPECT_EQ(0, m_queue.GetDataSize());
+  EXPECT_EQ(0U, m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+  EXPECT_TRUE(m_queue.IsDataBased());
+
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_EOF));
+}
+
+TEST_F(TestDVDMessageQueue, OverflowsIngress)
+{
+  // more packets than the lock-free ingress ring holds, without a consumer
+  constexpr int PACKETS = 5000;
+  for (int i = 0; i < PACKETS; ++i)
+    ASSERT_EQ(MSGQ_OK, m_queue.Put(MakePacket(1, DVD_MSEC_TO_TIME(1) * i)));
+
+  EXPECT_EQ(PACKETS, m_queue.GetDataSize());
+  for (int i = 0; i < PACKETS; ++i)
+  {
+    std::shared_ptr<CDVDMsg> msg;
+    ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+    ASSERT_DOUBLE_EQ(DVD_MSEC_TO_TIME(1) * i, GetPacket(msg)->dts);
+  }
+  EXPECT_EQ(0, m_queue.GetDataSize());
+}
+
+TEST_F(TestDVDMessageQueue, Abort)
+{
+  std::thread aborter(
+      [this]
+      {
+        std::this_thread::sleep_for(50ms);
+        m_queue.Abort();
+      });
+
+  std::shared_ptr<CDVDMsg> msg;
+  EXPECT_EQ(MSGQ_ABORT, m_queue.Get(msg, 10s));
+  EXPECT_TRUE(m_queue.ReceivedAbortRequest());
+  aborter.join();
+}
+
+TEST_F(TestDVDMessageQueue, StressMultipleProducers)
+{
+  constexpr int PRODUCERS = 4;
+  constexpr int PACKETS = 20000;
+
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < PRODUCERS; ++producer)
+  {
+    producers.emplace_back(
+        [this, producer]
+        {
+          for (int i = 0; i < PACKETS; ++i)
+          {
+            m_queue.Put(MakePacket(1 + i % 64, i, producer));
+            if (i % 1000 == 0)
+              m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC), 1);
+            if (i % 97 == 0)
+            {
+              // level queries from other threads must not disturb the queue
+              EXPECT_GE(m_queue.GetLevel(), 0);
+              EXPECT_GE(m_queue.GetDataSize(), 0);
+            }
+          }
+        });
+  }
+
+  std::vector<int> next(PRODUCERS, 0);
+  int packets = 0;
+  int prioMessages = 0;
+  while (packets < PRODUCERS * PACKETS)
+  {
+    std::shared_ptr<CDVDMsg> msg;
+    int priority = 0;
+    const MsgQueueReturnCode ret = m_queue.Get(msg, 1s, priority);
+    ASSERT_EQ(MSGQ_OK, ret);
+
+    if (DemuxPacket* packet = GetPacket(msg))
+    {
+      // packets of every single producer keep their order
+      ASSERT_DOUBLE_EQ(next[packet->iStreamId], packet->dts);
+      ++next[packet->iStreamId];
+      ++packets;
+    }
+    else
+    {
+      EXPECT_EQ(1, priority);
+      ++prioMessages;
+    }
+  }
+
+  for (auto& producer : producers)
+    producer.join();
+
+  std::shared_ptr<CDVDMsg> msg;
+  while (m_queue.Get(msg, 0ms) == MSGQ_OK)
+    ++prioMessages;
+
+  EXPECT_EQ(PRODUCERS * PACKETS / 1000, prioMessages);
+  EXPECT_EQ(0, m_queue.GetDataSize());
+  EXPECT_EQ(0, m_queue.GetLevel());
+}
+
+TEST_F(TestDVDMessageQueue, PutRacesEndAndInit)
+{
+  constexpr int PRODUCERS = 3;
+  constexpr int SESSIONS = 200;
+
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < PRODUCERS; ++producer)
+  {
+    producers.emplace_back(
+        [this, &stop, producer]
+        {
+          for (int i = 0; !stop; ++i)
+          {
+            if (m_queue.Put(MakePacket(1 + i % 64, i, producer)) == MSGQ_NOT_INITIALIZED)
+              std::this_thread::yield();
+          }
+        });
+  }
+
+  for (int session = 0; session < SESSIONS; ++session)
+  {
+    // consume part of the session, so packets are on their way while it ends
+    std::shared_ptr<CDVDMsg> msg;
+    for (int i = 0; i < 100 && m_queue.Get(msg, 0ms) == MSGQ_OK; ++i)
+      ASSERT_GE(m_queue.GetDataSize(), 0);
+
+    m_queue.End();
+    EXPECT_EQ(0, m_queue.GetDataSize());
+    m_queue.Init();
+  }
+
+  stop = true;
+  for (auto& producer : producers)
+    producer.join();
+
+  // every packet left belongs to the last session and is accounted for
+  std::shared_ptr<CDVDMsg> msg;
+  while (m_queue.Get(msg, 0ms) == MSGQ_OK)
+    ASSERT_GE(m_queue.GetDataSize(), 0);
+  EXPECT_EQ(0, m_queue.GetDataSize());
+
+  // nothing of an ended session survives into the next one
+  m_queue.End();
+  m_queue.Init();
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(0, m_queue.GetDataSize());
+}
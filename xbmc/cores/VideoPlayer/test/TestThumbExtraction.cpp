@@ -0,0 +1,146 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/ThumbExtraction.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+class CTestExtractor
+{
+public:
+  CTestExtractor(std::string path, std::shared_ptr<std::atomic<int>> closed)
+    : m_path(std::move(path)), m_closed(std::move(closed))
+  {
+  }
+  ~CTestExtractor() { ++*m_closed; }
+
+  const std::string& GetPath() const { return m_path; }
+
+private:
+  std::string m_path;
+  std::shared_ptr<std::atomic<int>> m_closed;
+};
+
+using CTestIdleExtractor = CIdleThumbExtractor<CTestExtractor>;
+} // namespace
+
+TEST(TestThumbExtraction, BudgetAdmitsSingleOversizedExtraction)
+{
+  CThumbExtractionBudget budget(100);
+
+  budget.Acquire(500);
+  EXPECT_EQ(500u, budget.GetUsed());
+  budget.Release(500);
+  EXPECT_EQ(0u, budget.GetUsed());
+}
+
+TEST(TestThumbExtraction, BudgetWaitsForRelease)
+{
+  CThumbExtractionBudget budget(100);
+  budget.Acquire(60);
+  budget.Acquire(40);
+
+  std::atomic<bool> admitted{false};
+  std::thread extraction(
+      [&]
+      {
+        budget.Acquire(30);
+        admitted = true;
+      });
+
+  std::this_thread::sleep_for(50ms);
+  EXPECT_FALSE(admitted);
+
+  // freeing enough for the waiting extraction admits it
+  budget.Release(40);
+  extraction.join();
+  EXPECT_TRUE(admitted);
+  EXPECT_EQ(90u, budget.GetUsed());
+}
+
+TEST(TestThumbExtraction, IdleExtractorReusedForSameFile)
+{
+  auto closed = std::make_shared<std::atomic<int>>(0);
+  CTestIdleExtractor idle(10s, 1);
+
+  auto extractor = std::make_unique<CTestExtractor>("/movies/a.mkv", closed);
+  const CTestExtractor* opened = extractor.get();
+  idle.Put(std::move(extractor));
+
+  // another file opens its own extractor, the idle one stays for its file
+  EXPECT_EQ(nullptr, idle.Take("/movies/b.mkv"));
+  extractor = idle.Take("/movies/a.mkv");
+  EXPECT_EQ(opened, extractor.get());
+
+  // it's taken, a concurrent request opens its own
+  EXPECT_EQ(nullptr, idle.Take("/movies/a.mkv"));
+  EXPECT_EQ(0, *closed);
+}
+
+TEST(TestThumbExtraction, IdleExtractorReplacedByNextFile)
+{
+  auto closed = std::make_shared<std::atomic<int>>(0);
+  CTestIdleExtractor idle(10s, 1);
+
+  idle.Put(std::make_unique<CTestExtractor>("/movies/a.mkv", closed));
+  idle.Put(std::make_unique<CTestExtractor>("/movies/b.mkv", closed));
+  EXPECT_EQ(1, *closed);
+
+  EXPECT_EQ(nullptr, idle.Take("/movies/a.mkv"));
+  EXPECT_NE(nullptr, idle.Take("/movies/b.mkv"));
+}
+
+TEST(TestThumbExtraction, IdleExtractorsKeptPerFile)
+{
+  auto closed = std::make_shared<std::atomic<int>>(0);
+  CTestIdleExtractor idle(10s, 2);
+
+  // parallel jobs on different files don't close each other's extractors
+  idle.Put(std::make_unique<CTestExtractor>("/movies/a.mkv", closed));
+  idle.Put(std::make_unique<CTestExtractor>("/movies/b.mkv", closed));
+  EXPECT_EQ(0, *closed);
+
+  // a second extractor of a file replaces the idle one of that file
+  idle.Put(std::make_unique<CTestExtractor>("/movies/b.mkv", closed));
+  EXPECT_EQ(1, *closed);
+
+  // over the limit the oldest one is closed
+  idle.Put(std::make_unique<CTestExtractor>("/movies/c.mkv", closed));
+  EXPECT_EQ(2, *closed);
+  EXPECT_EQ(nullptr, idle.Take("/movies/a.mkv"));
+  EXPECT_NE(nullptr, idle.Take("/movies/b.mkv"));
+  EXPECT_NE(nullptr, idle.Take("/movies/c.mkv"));
+}
+
+TEST(TestThumbExtraction, IdleExtractorExpires)
+{
+  auto closed = std::make_shared<std::atomic<int>>(0);
+  CTestIdleExtractor idle(50ms, 2);
+
+  idle.Put(std::make_unique<CTestExtractor>("/movies/a.mkv", closed));
+  std::this_thread::sleep_for(30ms);
+  idle.Put(std::make_unique<CTestExtractor>("/movies/b.mkv", closed));
+  std::this_thread::sleep_for(70ms);
+  EXPECT_EQ(nullptr, idle.Take("/movies/a.mkv"));
+
+  // the timer closes them without a further request
+  for (int i = 0; i < 100 && *closed < 2; ++i)
+    std::this_thread::sleep_for(10ms);
+  EXPECT_EQ(2, *closed);
+}
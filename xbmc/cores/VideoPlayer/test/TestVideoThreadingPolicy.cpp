@@ -0,0 +1,152 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDCodecs/Video/DVDVideoCodec.h"
+#include "cores/VideoPlayer/DVDCodecs/Video/VideoThreadingPolicy.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+CVideoThreadingPolicy::Stream MakeStream(AVCodecID codec, int capabilities, int height, double fps)
+{
+  CVideoThreadingPolicy::Stream stream;
+  stream.codec = codec;
+  stream.capabilities = capabilities;
+  stream.width = height * 16 / 9;
+  stream.height = height;
+  stream.fps = fps;
+  return stream;
+}
+
+constexpr int FRAME_AND_SLICE = AV_CODEC_CAP_FRAME_THREADS | AV_CODEC_CAP_SLICE_THREADS;
+} // namespace
+
+TEST(TestVideoThreadingPolicy, FrameThreadsFollowPixelRate)
+{
+  // 8 cores, 2 of them reserved, oversubscribed by half
+  CVideoThreadingPolicy policy(8);
+  EXPECT_EQ(2u, policy.GetReservedCores());
+
+  auto decision = policy.Decide(MakeStream(AV_CODEC_ID_H264, FRAME_AND_SLICE, 1080, 30.0));
+  EXPECT_EQ(FF_THREAD_FRAME, decision.threadType);
+  EXPECT_EQ(4, decision.threadCount);
+
+  decision = policy.Decide(MakeStream(AV_CODEC_ID_H264, FRAME_AND_SLICE, 720, 30.0));
+  EXPECT_EQ(2, decision.threadCount);
+
+  decision = policy.Decide(MakeStream(AV_CODEC_ID_HEVC, FRAME_AND_SLICE, 2160, 60.0));
+  EXPECT_EQ(9, decision.threadCount);
+
+  // unknown frame rate and size
+  decision = policy.Decide(MakeStream(AV_CODEC_ID_H264, FRAME_AND_SLICE, 0, 0.0));
+  EXPECT_EQ(4, decision.threadCount);
+}
+
+TEST(TestVideoThreadingPolicy, QuadCore)
+{
+  // a single core is reserved below 8 cores
+  CVideoThreadingPolicy policy(4);
+  EXPECT_EQ(1u, policy.GetReservedCores());
+
+  const auto uhd = MakeStream(AV_CODEC_ID_HEVC, FRAME_AND_SLICE, 2160, 60.0);
+  const auto decision = policy.Decide(uhd);
+  EXPECT_EQ(FF_THREAD_FRAME, decision.threadType);
+  EXPECT_EQ(4, decision.threadCount);
+
+  // falling behind, it may use the reserved core as well
+  EXPECT_EQ(6, policy.ReportLagging(uhd, decision).threadCount);
+}
+
+TEST(TestVideoThreadingPolicy, SliceAndOtherThreads)
+{
+  CVideoThreadingPolicy policy(4);
+
+  // no more slice threads than the 3 cores left
+  auto decision =
+      policy.Decide(MakeStream(AV_CODEC_ID_MPEG2VIDEO, AV_CODEC_CAP_SLICE_THREADS, 2160, 50.0));
+  EXPECT_EQ(FF_THREAD_SLICE, decision.threadType);
+  EXPECT_EQ(3, decision.threadCount);
+
+  decision = policy.Decide(MakeStream(AV_CODEC_ID_AV1, AV_CODEC_CAP_OTHER_THREADS, 1080, 24.0));
+  EXPECT_EQ(0, decision.threadType);
+  EXPECT_EQ(4, decision.threadCount);
+
+  // decoders which can't thread and streams which don't need it are decoded by a single thread
+  EXPECT_EQ(CVideoThreadingPolicy::Decision{},
+            policy.Decide(MakeStream(AV_CODEC_ID_H263, 0, 1080, 30.0)));
+  EXPECT_EQ(CVideoThreadingPolicy::Decision{},
+            policy.Decide(
+                MakeStream(AV_CODEC_ID_MPEG2VIDEO, AV_CODEC_CAP_SLICE_THREADS, 576, 25.0)));
+
+  const CVideoThreadingPolicy singleCore(1);
+  EXPECT_EQ(CVideoThreadingPolicy::Decision{},
+            singleCore.Decide(MakeStream(AV_CODEC_ID_H264, FRAME_AND_SLICE, 1080, 30.0)));
+}
+
+TEST(TestVideoThreadingPolicy, DecodersShareCores)
+{
+  CVideoThreadingPolicy policy(8);
+  const auto stream = MakeStream(AV_CODEC_ID_HEVC, FRAME_AND_SLICE, 2160, 60.0);
+
+  const auto first = policy.Decide(stream);
+  ASSERT_EQ(9, first.threadCount);
+  policy.Acquire(first);
+  EXPECT_EQ(CVideoThreadingPolicy::Decision{}, policy.Decide(stream));
+
+  policy.Release(first);
+  EXPECT_EQ(first, policy.Decide(stream));
+}
+
+TEST(TestVideoThreadingPolicy, LaggingStreamsGetMoreThreads)
+{
+  CVideoThreadingPolicy policy(8);
+  const auto stream = MakeStream(AV_CODEC_ID_H264, FRAME_AND_SLICE, 1080, 30.0);
+  const auto decision = policy.Decide(stream);
+  ASSERT_EQ(4, decision.threadCount);
+  policy.Acquire(decision);
+
+  const auto boosted = policy.ReportLagging(stream, decision);
+  EXPECT_EQ(6, boosted.threadCount);
+
+  // later streams of the same kind start with more threads, others don't
+  policy.Release(decision);
+  EXPECT_EQ(6, policy.Decide(stream).threadCount);
+  EXPECT_EQ(2, policy.Decide(MakeStream(AV_CODEC_ID_H264, FRAME_AND_SLICE, 720, 30.0)).threadCount);
+
+  // lagging streams may use the reserved cores, but there is no room for more than all of them
+  const auto uhd = MakeStream(AV_CODEC_ID_HEVC, FRAME_AND_SLICE, 2160, 60.0);
+  const auto max = policy.ReportLagging(uhd, policy.Decide(uhd));
+  EXPECT_EQ(12, max.threadCount);
+  EXPECT_EQ(max, policy.ReportLagging(uhd, max));
+}
+
+TEST(TestVideoThreadingPolicy, LagDetector)
+{
+  CVideoThreadingPolicy::CLagDetector detector;
+
+  bool lagging = false;
+  for (int i = 0; i < 250; ++i)
+    lagging = detector.Update(i % 10 == 0 ? DVD_CODEC_CTRL_HURRY : 0);
+  EXPECT_FALSE(lagging);
+
+  for (int i = 0; i < 250; ++i)
+    lagging = detector.Update(i % 3 == 0 ? DVD_CODEC_CTRL_DROP_ANY : 0);
+  EXPECT_TRUE(lagging);
+
+  // fast forward doesn't count
+  lagging = false;
+  for (int i = 0; i < 500; ++i)
+    lagging |= detector.Update(DVD_CODEC_CTRL_HURRY | DVD_CODEC_CTRL_NO_POSTPROC);
+  EXPECT_FALSE(lagging);
+
+  detector.Reset();
+  for (int i = 0; i < 249; ++i)
+    detector.Update(DVD_CODEC_CTRL_DROP_ANY);
+  EXPECT_TRUE(detector.Update(0));
+}
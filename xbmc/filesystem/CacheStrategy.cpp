@@ -24,6 +24,12 @@
 #include "platform/win32/filesystem/Win32File.h"
 #define CacheLocalFile CWin32File
 #endif // TARGET_WINDOWS
+#if defined(HAVE_LINUX_IO_URING)
+#include "platform/linux/filesystem/UringFile.h"
+#define CacheWriteFile CUringFile
+#else
+#define CacheWriteFile CacheLocalFile
+#endif
 
 #include <cassert>
 #include <algorithm>
@@ -50,7 +56,7 @@ void CCacheStrategy::ClearEndOfInput()
 
 CSimpleFileCache::CSimpleFileCache()
   : m_cacheFileRead(new CacheLocalFile())
-  , m_cacheFileWrite(new CacheLocalFile())
+  , m_cacheFileWrite(new CacheWriteFile())
   , m_hDataAvailEvent(NULL)
 {
 }
@@ -134,6 +140,7 @@ int CSimpleFileCache::WriteToCache(const char *pBuffer, size_t iSize)
       return CACHE_RC_ERROR;
     }
     m_nWritePosition += lastWritten;
+    pBuffer += lastWritten;
     iSize -= lastWritten;
     written += lastWritten;
   }
@@ -146,7 +153,25 @@ int CSimpleFileCache::WriteToCache(const char *pBuffer, size_t iSize)
 
 int64_t CSimpleFileCache::GetAvailableRead()
 {
-  return m_nWritePosition - m_nReadPosition;
+  return GetReadableEnd() - m_nReadPosition;
+}
+
+int64_t CSimpleFileCache::GetReadableEnd()
+{
+#if defined(HAVE_LINUX_IO_URING)
+  return static_cast<CacheWriteFile*>(m_cacheFileWrite)->GetWrittenPosition();
+#else
+  return m_nWritePosition;
+#endif
+}
+
+bool CSimpleFileCache::WaitForQueuedWrites()
+{
+#if defined(HAVE_LINUX_IO_URING)
+  return static_cast<CacheWriteFile*>(m_cacheFileWrite)->WaitForWrites();
+#else
+  return false;
+#endif
 }
 
 int CSimpleFileCache::ReadFromCache(char *pBuffer, size_t iMaxSize)
@@ -172,6 +197,7 @@ int CSimpleFileCache::ReadFromCache(char *pBuffer, size_t iMaxSize)
       return CACHE_RC_ERROR;
     }
     m_nReadPosition += lastRead;
+    pBuffer += lastRead;
     toRead -= lastRead;
     readBytes += lastRead;
   }
@@ -194,6 +220,10 @@ int64_t CSimpleFileCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseco
     if (iAvail >= iMinAvail)
       return iAvail;
 
+    // the data may already be written, just not reached the file yet
+    if (WaitForQueuedWrites())
+      continue;
+
     if (!m_hDataAvailEvent->Wait(endTime.GetTimeLeft()))
       return CACHE_RC_TIMEOUT;
   }
@@ -257,6 +287,8 @@ bool CSimpleFileCache::Reset(int64_t iSourcePosition)
 
 void CSimpleFileCache::EndOfInput()
 {
+  // readers take the end of the input as the end of the readable data
+  WaitForQueuedWrites();
   CCacheStrategy::EndOfInput();
   m_hDataAvailEvent->Set();
 }
@@ -332,6 +364,16 @@ int CDoubleCache::ReadFromCache(char *pBuffer, size_t iMaxSize)
   return m_pCache->ReadFromCache(pBuffer, iMaxSize);
 }
 
+int CDoubleCache::ReadSpan(const uint8_t*& data, size_t iMaxSize)
+{
+  return m_pCache->ReadSpan(data, iMaxSize);
+}
+
+void CDoubleCache::Release(size_t iConsumed)
+{
+  m_pCache->Release(iConsumed);
+}
+
 int64_t CDoubleCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout)
 {
   return m_pCache->WaitForData(iMinAvail, timeout);
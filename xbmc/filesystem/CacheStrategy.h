@@ -32,6 +32,23 @@ public:
   virtual size_t GetMaxWriteSize(const size_t& iRequestSize) = 0;
   virtual int WriteToCache(const char *pBuffer, size_t iSize) = 0;
   virtual int ReadFromCache(char *pBuffer, size_t iMaxSize) = 0;
+
+  /*!
+   \brief Borrow cached data at the read position without copying it.
+   The data isn't overwritten until it is given back with Release(), which has to happen before
+   any other read or seek.
+   \param data set to the start of the borrowed data
+   \return number of bytes available at data, 0 at end of input, CACHE_RC_WOULD_BLOCK if no data
+           is available yet or CACHE_RC_ERROR if the strategy can't lend its memory
+   */
+  virtual int ReadSpan(const uint8_t*& data, size_t iMaxSize) { return CACHE_RC_ERROR; }
+
+  /*!
+   \brief Give back data borrowed with ReadSpan().
+   \param iConsumed bytes actually used, the read position advances by this amount
+   */
+  virtual void Release(size_t iConsumed) {}
+
   virtual int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) = 0;
 
   virtual int64_t Seek(int64_t iFilePosition) = 0;
@@ -89,6 +106,12 @@ public:
   int64_t  GetAvailableRead();
 
 protected:
+  /*!
+   \brief Get the end of the data that can be read back, writes to the cache file may be queued.
+   */
+  int64_t GetReadableEnd();
+  bool WaitForQueuedWrites();
+
   std::string m_filename;
   IFile*   m_cacheFileRead;
   IFile*   m_cacheFileWrite;
@@ -109,6 +132,8 @@ public:
   size_t GetMaxWriteSize(const size_t& iRequestSize) override;
   int WriteToCache(const char *pBuffer, size_t iSize) override;
   int ReadFromCache(char *pBuffer, size_t iMaxSize) override;
+  int ReadSpan(const uint8_t*& data, size_t iMaxSize) override;
+  void Release(size_t iConsumed) override;
   int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
 
   int64_t Seek(int64_t iFilePosition) override;
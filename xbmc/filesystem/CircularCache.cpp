@@ -175,6 +175,46 @@ int CCircularCache::ReadFromCache(char *buf, size_t len)
   return len;
 }
 
+/**
+ * Lends the data at the read position up till the buffer wrap point.
+ * The writer never overwrites data in front of m_cur, so the data stays
+ * valid as long as m_cur is not advanced by Release().
+ */
+int CCircularCache::ReadSpan(const uint8_t*& data, size_t len)
+{
+  std::unique_lock lock(m_sync);
+
+  size_t pos   = m_cur % m_size;
+  size_t front = (size_t)(m_end - m_cur);
+  size_t avail = std::min(m_size - pos, front);
+
+  if(avail == 0)
+  {
+    if(IsEndOfInput())
+      return 0;
+    else
+      return CACHE_RC_WOULD_BLOCK;
+  }
+
+  if (m_buf == NULL)
+    return CACHE_RC_ERROR;
+
+  data = m_buf + pos;
+  m_borrowed = std::min(len, avail);
+
+  return m_borrowed;
+}
+
+void CCircularCache::Release(size_t consumed)
+{
+  std::unique_lock lock(m_sync);
+
+  m_cur += std::min(consumed, m_borrowed);
+  m_borrowed = 0;
+
+  m_space.Set();
+}
+
 /* Wait "millis" milliseconds for "minimum" amount of data to come in.
  * Note that caller needs to make sure there's sufficient space in the forward
  * buffer for "minimum" bytes else we may block the full timeout time
@@ -246,6 +286,7 @@ bool CCircularCache::Reset(int64_t pos)
   m_end = pos;
   m_beg = pos;
   m_cur = pos;
+  m_borrowed = 0;
 
   return true;
 }
@@ -26,6 +26,8 @@ public:
     size_t GetMaxWriteSize(const size_t& iRequestSize) override;
     int WriteToCache(const char *buf, size_t len) override;
     int ReadFromCache(char *buf, size_t len) override;
+    int ReadSpan(const uint8_t*& data, size_t len) override;
+    void Release(size_t consumed) override;
     int64_t WaitForData(uint32_t minimum, std::chrono::milliseconds timeout) override;
 
     int64_t Seek(int64_t pos) override;
@@ -41,6 +43,7 @@ protected:
   int64_t m_beg = 0; /**< index in file (not buffer) of beginning of valid data */
   int64_t m_end = 0; /**< index in file (not buffer) of end of valid data */
   int64_t m_cur = 0; /**< current reading index in file */
+  size_t m_borrowed = 0; /**< bytes from m_cur on lent out by ReadSpan() */
     uint8_t          *m_buf;       /**< buffer holding data */
     size_t            m_size;      /**< size of data buffer used (m_buf) */
     size_t            m_size_back; /**< guaranteed size of back buffer (actual size can be smaller, or larger if front buffer doesn't need it) */
@@ -423,6 +423,263 @@ void CCurlFile::CReadState::Disconnect()
 }
 
 
+CCurlFile::CParallelReader::CParallelReader(CCurlFile& file,
+                                            int64_t position,
+                                            unsigned int connections,
+                                            unsigned int chunkSize)
+  : m_file(file),
+    m_multiHandle(g_curlInterface.multi_init()),
+    m_readPos(position),
+    m_nextPos(position),
+    m_fileSize(file.m_state->m_fileSize),
+    m_connections(connections),
+    m_chunkSize(chunkSize)
+{
+}
+
+CCurlFile::CParallelReader::~CParallelReader()
+{
+  ReleaseAll();
+  m_idleStates.clear();
+  g_curlInterface.multi_cleanup(m_multiHandle);
+}
+
+ssize_t CCurlFile::CParallelReader::Read(void* lpBuf, size_t uiBufSize)
+{
+  if (m_readPos >= m_fileSize)
+    return 0;
+
+  Schedule();
+  while (!m_ranges.empty())
+  {
+    if (m_file.m_state->m_cancelled)
+      return 0;
+
+    Range& range = m_ranges.front();
+    const unsigned int want = std::min<unsigned int>(
+        range.state->m_buffer.getMaxReadSize(), std::min<size_t>(uiBufSize, UINT_MAX));
+    if (want > 0 && range.state->m_buffer.ReadData(static_cast<char*>(lpBuf), want))
+    {
+      range.pos += want;
+      m_readPos = range.pos;
+      if (range.pos >= range.end)
+      {
+        Release(range);
+        m_ranges.pop_front();
+        Schedule();
+      }
+      return want;
+    }
+
+    if (!Perform())
+      return -1;
+
+    if (m_ranges.front().state->m_buffer.getMaxReadSize() == 0)
+    {
+      int numfds = 0;
+      g_curlInterface.multi_wait(m_multiHandle, 200, &numfds);
+    }
+  }
+  return -1;
+}
+
+void CCurlFile::CParallelReader::Seek(int64_t position)
+{
+  if (position == m_readPos)
+    return;
+
+  if (position > m_readPos)
+  {
+    // drop the chunks that are skipped entirely
+    while (!m_ranges.empty() && m_ranges.front().end <= position)
+    {
+      Release(m_ranges.front());
+      m_ranges.pop_front();
+    }
+
+    if (!m_ranges.empty() && m_ranges.front().pos <= position)
+    {
+      Range& range = m_ranges.front();
+      const int64_t skip = position - range.pos;
+      if (skip <= range.state->m_buffer.getMaxReadSize() &&
+          range.state->m_buffer.SkipBytes(static_cast<int>(skip)))
+        range.pos = position;
+      else
+      {
+        g_curlInterface.multi_remove_handle(m_multiHandle, range.state->m_easyHandle);
+        range.pos = position;
+        if (!Request(range, position))
+        {
+          Release(range);
+          m_ranges.pop_front();
+        }
+      }
+      m_readPos = position;
+      return;
+    }
+  }
+
+  // nothing requested is of use anymore
+  ReleaseAll();
+  m_readPos = position;
+  m_nextPos = position;
+}
+
+double CCurlFile::CParallelReader::GetDownloadSpeed() const
+{
+  double speed = 0.0;
+  for (double connectionSpeed : GetConnectionSpeeds())
+    speed += connectionSpeed;
+  return speed;
+}
+
+std::vector<double> CCurlFile::CParallelReader::GetConnectionSpeeds() const
+{
+  std::vector<double> speeds;
+  speeds.reserve(m_ranges.size());
+  for (const auto& range : m_ranges)
+  {
+#if LIBCURL_VERSION_NUM >= 0x073a00 // 0.7.58.0
+    curl_off_t speed = 0;
+    g_curlInterface.easy_getinfo(range.state->m_easyHandle, CURLINFO_SPEED_DOWNLOAD_T, &speed);
+#else
+    double speed = 0.0;
+    g_curlInterface.easy_getinfo(range.state->m_easyHandle, CURLINFO_SPEED_DOWNLOAD, &speed);
+#endif
+    speeds.emplace_back(static_cast<double>(speed));
+  }
+  return speeds;
+}
+
+void CCurlFile::CParallelReader::Schedule()
+{
+  while (m_ranges.size() < m_connections && m_nextPos < m_fileSize)
+  {
+    Range range;
+    if (!m_idleStates.empty())
+    {
+      range.state = std::move(m_idleStates.back());
+      m_idleStates.pop_back();
+    }
+    else
+    {
+      CURL url(m_file.m_url);
+      range.state = std::make_unique<CReadState>();
+      g_curlInterface.easy_acquire(url.GetProtocol().c_str(), url.GetHostName().c_str(),
+                                   &range.state->m_easyHandle, &range.state->m_multiHandle);
+    }
+    range.pos = m_nextPos;
+    range.end = std::min(m_nextPos + m_chunkSize, m_fileSize);
+    if (!Request(range, m_nextPos))
+    {
+      m_idleStates.emplace_back(std::move(range.state));
+      return;
+    }
+
+    m_nextPos = range.end;
+    m_ranges.emplace_back(std::move(range));
+  }
+}
+
+bool CCurlFile::CParallelReader::Request(Range& range, int64_t from)
+{
+  CReadState* state = range.state.get();
+
+  m_file.SetCommonOptions(state);
+  m_file.SetRequestHeaders(state);
+  g_curlInterface.easy_setopt(state->m_easyHandle, CURLOPT_URL, m_file.m_url.c_str());
+
+  const std::string bytes = StringUtils::Format("{}-{}", from, range.end - 1);
+  g_curlInterface.easy_setopt(state->m_easyHandle, CURLOPT_RANGE, bytes.c_str());
+
+  // a retried request continues behind the data that was not handed out yet
+  if (from == range.pos)
+  {
+    state->m_buffer.Destroy();
+    if (!state->m_buffer.Create(static_cast<unsigned int>(range.end - from)))
+      return false;
+  }
+  state->m_httpheader.Clear();
+  range.requestStart = from;
+
+  return g_curlInterface.multi_add_handle(m_multiHandle, state->m_easyHandle) == CURLM_OK;
+}
+
+bool CCurlFile::CParallelReader::Perform()
+{
+  int running = 0;
+  const CURLMcode result = g_curlInterface.multi_perform(m_multiHandle, &running);
+  if (result != CURLM_OK && result != CURLM_CALL_MULTI_PERFORM)
+  {
+    CLog::Log(LOGERROR, "CCurlFile::CParallelReader::{} - ({}) Multi perform failed with code {}",
+              __FUNCTION__, fmt::ptr(this), result);
+    return false;
+  }
+
+  int msgs;
+  CURLMsg* msg;
+  while ((msg = g_curlInterface.multi_info_read(m_multiHandle, &msgs)))
+  {
+    if (msg->msg != CURLMSG_DONE)
+      continue;
+
+    const auto it = std::ranges::find_if(m_ranges, [msg](const Range& range)
+                                         { return range.state->m_easyHandle == msg->easy_handle; });
+    if (it == m_ranges.end())
+      continue;
+
+    long httpCode = 0;
+    curl_off_t size = 0;
+    g_curlInterface.easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &httpCode);
+    g_curlInterface.easy_getinfo(msg->easy_handle, CURLINFO_SIZE_DOWNLOAD_T, &size);
+    g_curlInterface.multi_remove_handle(m_multiHandle, msg->easy_handle);
+
+    if (msg->data.result == CURLE_OK && httpCode == 206 && size == it->end - it->requestStart)
+      continue;
+
+    if (msg->data.result == CURLE_OK && httpCode != 206)
+      return false; // the server ignored the range, parallel requests won't work at all
+
+    CLog::Log(LOGWARNING,
+              "CCurlFile::CParallelReader::{} - ({}) Range {}-{} failed: {}({}), got {} bytes",
+              __FUNCTION__, fmt::ptr(this), it->requestStart, it->end,
+              g_curlInterface.easy_strerror(msg->data.result), msg->data.result, size);
+
+    if (it->retries++ >= CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_curlretries)
+      return false;
+
+    if (!Request(*it, it->pos + it->state->m_buffer.getMaxReadSize()))
+      return false;
+  }
+
+  // stop early when a range is answered with the whole file
+  for (const auto& range : m_ranges)
+  {
+    long httpCode = 0;
+    g_curlInterface.easy_getinfo(range.state->m_easyHandle, CURLINFO_RESPONSE_CODE, &httpCode);
+    if (httpCode != 0 && httpCode != 206)
+    {
+      CLog::Log(LOGWARNING, "CCurlFile::CParallelReader::{} - ({}) Range request returned code {}",
+                __FUNCTION__, fmt::ptr(this), httpCode);
+      return false;
+    }
+  }
+  return true;
+}
+
+void CCurlFile::CParallelReader::Release(Range& range)
+{
+  g_curlInterface.multi_remove_handle(m_multiHandle, range.state->m_easyHandle);
+  m_idleStates.emplace_back(std::move(range.state));
+}
+
+void CCurlFile::CParallelReader::ReleaseAll()
+{
+  for (auto& range : m_ranges)
+    Release(range);
+  m_ranges.clear();
+}
+
 CCurlFile::~CCurlFile()
 {
   Close();
@@ -459,11 +716,82 @@ void CCurlFile::SetBufferSize(unsigned int size)
   m_bufferSize = size;
 }
 
+void CCurlFile::SetParallelRanges(unsigned int connections, unsigned int chunkSize)
+{
+  m_parallelConnections = connections;
+  m_parallelChunkSize = chunkSize;
+}
+
+bool CCurlFile::StartParallelReader()
+{
+  if (m_parallelReader)
+    return true;
+
+  unsigned int connections = m_parallelConnections;
+  if (connections == 0)
+    connections = CServiceBroker::GetSettingsComponent()
+                      ->GetAdvancedSettings()
+                      ->m_curlParallelConnections;
+
+  if (connections < 2 || !m_opened || m_forWrite || !m_seekable || !m_multisession ||
+      !m_postdata.empty() || m_state->m_fileSize <= m_parallelChunkSize)
+    return false;
+
+  const CURL url(m_url);
+  if (!url.IsProtocol("http") && !url.IsProtocol("https"))
+    return false;
+
+  if (!StringUtils::EqualsNoCase(m_state->m_httpheader.GetValue("accept-ranges"), "bytes"))
+    return false;
+
+  CLog::Log(LOGDEBUG, "CCurlFile::{} - <{}> Fetching with {} connections", __FUNCTION__,
+            CURL::GetRedacted(m_url), connections);
+
+  m_parallelReader = std::make_unique<CParallelReader>(*this, m_state->m_filePos, connections,
+                                                       m_parallelChunkSize);
+
+  // the single connection is only needed again if the server doesn't play along
+  const int64_t fileSize = m_state->m_fileSize;
+  m_state->Disconnect();
+  m_state->m_fileSize = fileSize;
+  delete m_oldState;
+  m_oldState = nullptr;
+  return true;
+}
+
+ssize_t CCurlFile::Read(void* lpBuf, size_t uiBufSize)
+{
+  if (!m_parallelReader)
+    return m_state->Read(lpBuf, uiBufSize);
+
+  const ssize_t read = m_parallelReader->Read(lpBuf, uiBufSize);
+  if (read >= 0)
+    return read;
+
+  CLog::Log(LOGWARNING, "CCurlFile::{} - <{}> Parallel ranges failed, using a single connection",
+            __FUNCTION__, CURL::GetRedacted(m_url));
+
+  const int64_t position = m_parallelReader->GetPosition();
+  m_parallelReader.reset();
+
+  SetCommonOptions(m_state);
+  SetRequestHeaders(m_state);
+  m_state->m_filePos = position;
+  m_state->m_sendRange = true;
+  m_state->m_bRetry = m_allowRetry;
+  if (m_state->Connect(m_bufferSize) < 0)
+    return -1;
+
+  SetCorrectHeaders(m_state);
+  return m_state->Read(lpBuf, uiBufSize);
+}
+
 void CCurlFile::Close()
 {
   if (m_opened && m_forWrite && !m_inError)
       Write(NULL, 0);
 
+  m_parallelReader.reset();
   m_state->Disconnect();
   delete m_oldState;
   m_oldState = NULL;
@@ -489,6 +817,10 @@ void CCurlFile::SetCommonOptions(CReadState* state, bool failOnError /* = true *
 
   g_curlInterface.easy_setopt(h, CURLOPT_DEBUGFUNCTION, debug_callback);
 
+  // share DNS cache and TLS sessions with all other transfers
+  if (CURLSH* share = g_curlInterface.GetShare())
+    g_curlInterface.easy_setopt(h, CURLOPT_SHARE, share);
+
   if( CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_logLevel >= LOG_LEVEL_DEBUG )
     g_curlInterface.easy_setopt(h, CURLOPT_VERBOSE, CURL_ON);
   else
@@ -1433,7 +1765,7 @@ bool CCurlFile::Exists(const CURL& url)
 
 int64_t CCurlFile::Seek(int64_t iFilePosition, int iWhence)
 {
-  int64_t nextPos = m_state->m_filePos;
+  int64_t nextPos = m_parallelReader ? m_parallelReader->GetPosition() : m_state->m_filePos;
 
   if(!m_seekable)
     return -1;
@@ -1459,6 +1791,12 @@ int64_t CCurlFile::Seek(int64_t iFilePosition, int iWhence)
   // We can't seek beyond EOF
   if (m_state->m_fileSize && nextPos > m_state->m_fileSize) return -1;
 
+  if (m_parallelReader)
+  {
+    m_parallelReader->Seek(nextPos);
+    return nextPos;
+  }
+
   if(m_state->Seek(nextPos))
     return nextPos;
 
@@ -1538,6 +1876,8 @@ int64_t CCurlFile::GetLength()
 int64_t CCurlFile::GetPosition()
 {
   if (!m_opened) return 0;
+  if (m_parallelReader)
+    return m_parallelReader->GetPosition();
   return m_state->m_filePos;
 }
 
@@ -2131,6 +2471,9 @@ int CCurlFile::IoControl(IOControl request, void* param)
     return 0;
   }
 
+  if (request == IOControl::SET_CACHE)
+    return StartParallelReader() ? 0 : -1;
+
   return -1;
 }
 
@@ -2175,6 +2518,9 @@ const std::vector<std::string> CCurlFile::GetPropertyValues(XFILE::FileProperty
 
 double CCurlFile::GetDownloadSpeed()
 {
+  if (m_parallelReader)
+    return m_parallelReader->GetDownloadSpeed();
+
 #if LIBCURL_VERSION_NUM >= 0x073a00 // 0.7.58.0
   curl_off_t speed = 0;
   if (g_curlInterface.easy_getinfo(m_state->m_easyHandle, CURLINFO_SPEED_DOWNLOAD_T, &speed) ==
@@ -12,8 +12,11 @@
 #include "utils/HttpHeader.h"
 #include "utils/RingBuffer.h"
 
+#include <deque>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 typedef void CURL_HANDLE;
 typedef void CURLM;
@@ -50,7 +53,7 @@ namespace XFILE
       {
         return m_state->ReadLine(buffer, bufferSize);
       }
-      ssize_t Read(void* lpBuf, size_t uiBufSize) override { return m_state->Read(lpBuf, uiBufSize); }
+      ssize_t Read(void* lpBuf, size_t uiBufSize) override;
       ssize_t Write(const void* lpBuf, size_t uiBufSize) override;
       const std::string GetProperty(XFILE::FileProperty type, const std::string &name = "") const override;
       const std::vector<std::string> GetPropertyValues(XFILE::FileProperty type, const std::string &name = "") const override;
@@ -82,6 +85,17 @@ namespace XFILE
       void ClearRequestHeaders();
       void SetBufferSize(unsigned int size);
 
+      static constexpr unsigned int DEFAULT_RANGE_CHUNK_SIZE = 1024 * 1024;
+
+      /*!
+       \brief Fetch ahead with parallel range requests once the file is read through a CFileCache.
+       Has to be called before Open(). Without it the advanced setting is used.
+       \param connections number of range requests in flight, 1 disables parallel fetching
+       \param chunkSize size of a single range request
+       */
+      void SetParallelRanges(unsigned int connections,
+                             unsigned int chunkSize = DEFAULT_RANGE_CHUNK_SIZE);
+
       const CHttpHeader& GetHttpHeader() const { return m_state->m_httpheader; }
       const std::string& GetURL() const { return m_url; }
       std::string GetRedirectURL();
@@ -144,6 +158,63 @@ namespace XFILE
           void Disconnect();
       };
 
+      /*!
+       \brief Reads a range capable source through several connections at once.
+
+       The file is split in chunks that are requested with separate range requests. Up to the
+       configured number of chunks are in flight ahead of the read position, they are handed out
+       in file order.
+       */
+      class CParallelReader
+      {
+      public:
+        CParallelReader(CCurlFile& file,
+                        int64_t position,
+                        unsigned int connections,
+                        unsigned int chunkSize);
+        ~CParallelReader();
+
+        /*!
+         \brief Read data in file order.
+         \return number of bytes read, 0 at end of file, -1 if the ranges can't be fetched
+         */
+        ssize_t Read(void* lpBuf, size_t uiBufSize);
+        void Seek(int64_t position);
+        int64_t GetPosition() const { return m_readPos; }
+
+        /*!
+         \brief Sum of the download speeds of all connections.
+         */
+        double GetDownloadSpeed() const;
+        std::vector<double> GetConnectionSpeeds() const;
+
+      private:
+        struct Range
+        {
+          std::unique_ptr<CReadState> state;
+          int64_t requestStart; //!< first byte of the current request
+          int64_t pos; //!< next byte to hand out
+          int64_t end; //!< end of the chunk, exclusive
+          int retries = 0;
+        };
+
+        void Schedule();
+        bool Request(Range& range, int64_t from);
+        bool Perform();
+        void Release(Range& range);
+        void ReleaseAll();
+
+        CCurlFile& m_file;
+        CURLM* m_multiHandle;
+        std::deque<Range> m_ranges; //!< in file order, the first one holds the read position
+        std::vector<std::unique_ptr<CReadState>> m_idleStates;
+        int64_t m_readPos;
+        int64_t m_nextPos; //!< start of the next chunk to request
+        const int64_t m_fileSize;
+        const unsigned int m_connections;
+        const unsigned int m_chunkSize;
+      };
+
     protected:
       void ParseAndCorrectUrl(CURL &url);
       void SetCommonOptions(CReadState* state, bool failOnError = true);
@@ -151,10 +222,14 @@ namespace XFILE
       void SetCorrectHeaders(CReadState* state);
       bool Service(const std::string& strURL, std::string& strHTML);
       std::string GetInfoString(int infoType);
+      bool StartParallelReader();
 
     protected:
       CReadState* m_state;
       CReadState* m_oldState;
+      std::unique_ptr<CParallelReader> m_parallelReader;
+      unsigned int m_parallelConnections = 0;
+      unsigned int m_parallelChunkSize = DEFAULT_RANGE_CHUNK_SIZE;
       unsigned int m_bufferSize;
       int64_t m_writeOffset = 0;
 
@@ -9,6 +9,7 @@
 #include "Directory.h"
 
 #include "DirectoryCache.h"
+#include "DirectoryCacheStore.h"
 #include "DirectoryFactory.h"
 #include "FileDirectoryFactory.h"
 #include "FileItem.h"
@@ -24,6 +25,7 @@
 #include "messaging/ApplicationMessenger.h"
 #include "music/MusicFileItemClassify.h"
 #include "playlists/PlayListFileItemClassify.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/URIUtils.h"
@@ -113,6 +115,63 @@ public:
 };
 
 
+namespace
+{
+/*!
+ \brief Wrap the items callback of the caller, filtering the preview batches like the final list.
+ Credentials are always hidden as the preview is only shown, never used to access the items.
+ */
+DirectoryItemsCallback CreatePreviewCallback(const CURL& url,
+                                             const CURL& realURL,
+                                             const IDirectory& directory,
+                                             const CDirectory::CHints& hints)
+{
+  const bool filterMask = !directory.AllowAll();
+  const bool filterHidden = !CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+                                CSettings::SETTING_FILELISTS_SHOWHIDDEN) &&
+                            !(hints.flags & DIR_FLAG_GET_HIDDEN);
+  const bool hideCredentials = CPasswordManager::GetInstance().IsURLSupported(realURL);
+  const bool substitute = url.Get() != realURL.Get();
+
+  return [callback = hints.itemsCallback, mask = IDirectory::NormalizeMask(hints.mask), filterMask,
+          filterHidden, hideCredentials, substitute](const CFileItemList& batch)
+  {
+    CFileItemList items;
+    for (const auto& item : batch)
+    {
+      if (filterMask && !item->IsFolder() && !IDirectory::IsAllowed(item->GetURL(), mask))
+        continue;
+      if (filterHidden && item->GetProperty("file:hidden").asBoolean())
+        continue;
+
+      if (hideCredentials)
+      {
+        CURL itemUrl = item->GetURL();
+        itemUrl.SetDomain("");
+        itemUrl.SetUserName("");
+        itemUrl.SetPassword("");
+        item->SetPath(itemUrl.Get());
+      }
+      if (substitute)
+        item->SetPath(URIUtils::SubstitutePath(item->GetPath(), true));
+      items.Add(item);
+    }
+
+    if (!items.IsEmpty())
+      callback(items);
+  };
+}
+
+CDirectoryCacheStore& GetDirectoryCacheStore()
+{
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  CDirectoryCacheStore& store = CDirectoryCacheStore::GetInstance();
+  store.Configure(URIUtils::AddFileToFolder(advancedSettings->m_cachePath, "directories"),
+                  advancedSettings->m_directoryCacheSize);
+  return store;
+}
+} // unnamed namespace
+
 CDirectory::CDirectory() = default;
 
 CDirectory::~CDirectory() = default;
@@ -171,10 +230,20 @@ bool CDirectory::GetDirectory(const CURL& url,
     if (!pDirectory)
       return false;
 
-    // check our cache for this path
-    if (g_directoryCache.GetDirectory(realURL, items,
-                                      (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE))
+    CDirectoryCacheStore& store = GetDirectoryCacheStore();
+    const bool persist = !(hints.flags & DIR_FLAG_BYPASS_CACHE) && store.IsEnabled() &&
+                         CDirectoryCacheStore::IsCacheable(realURL) &&
+                         pDirectory->GetCacheType(url) != CacheType::NEVER;
+    const bool readCache = (hints.flags & DIR_FLAG_READ_CACHE) == DIR_FLAG_READ_CACHE;
+
+    // check our caches for this path
+    if (g_directoryCache.GetDirectory(realURL, items, readCache))
       items.SetURL(url);
+    else if (persist && store.GetDirectory(realURL, items, readCache))
+    {
+      items.SetURL(url);
+      g_directoryCache.SetDirectory(realURL, items, pDirectory->GetCacheType(url));
+    }
     else
     {
       // need to clear the cache (in case the directory fetch fails)
@@ -185,6 +254,12 @@ bool CDirectory::GetDirectory(const CURL& url,
       pDirectory->SetFlags(hints.flags);
       items.SetURL(url);
 
+      if (hints.itemsCallback)
+        pDirectory->SetItemsCallback(CreatePreviewCallback(url, realURL, *pDirectory, hints));
+
+      // taken before listing, so changes made meanwhile invalidate the stored listing
+      const int64_t validator = persist ? CDirectoryCacheStore::GetValidator(realURL) : 0;
+
       bool result = false;
       CURL authUrl = realURL;
 
@@ -207,11 +282,16 @@ bool CDirectory::GetDirectory(const CURL& url,
             continue;
           }
 
+          if (hints.itemsCallback)
+            pDirectory->SetItemsCallback(nullptr);
           CLog::Log(LOGERROR, "{} - Error getting {}", __FUNCTION__, url.GetRedacted());
           return false;
         }
       }
 
+      if (hints.itemsCallback)
+        pDirectory->SetItemsCallback(nullptr);
+
       // hide credentials if necessary
       if (CPasswordManager::GetInstance().IsURLSupported(realURL))
       {
@@ -252,6 +332,8 @@ bool CDirectory::GetDirectory(const CURL& url,
       // cache the directory, if necessary
       if (!(hints.flags & DIR_FLAG_BYPASS_CACHE))
         g_directoryCache.SetDirectory(realURL, items, pDirectory->GetCacheType(url));
+      if (persist)
+        store.SetDirectory(realURL, items, validator);
     }
 
     // now filter for allowed files
@@ -33,6 +33,12 @@ public:
   public:
     std::string mask;
     int flags = DIR_FLAG_DEFAULTS;
+    /*!
+     \brief Receives the items in batches while the directory is being listed, e.g. to show them
+     before a large listing completed. The batches are filtered like the final list, except for
+     file directories, but not sorted. Not called when the listing comes from the cache.
+     */
+    DirectoryItemsCallback itemsCallback;
   };
 
   static bool GetDirectory(const CURL& url
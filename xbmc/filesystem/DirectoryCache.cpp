@@ -9,6 +9,7 @@
 #include "DirectoryCache.h"
 
 #include "Directory.h"
+#include "DirectoryCacheStore.h"
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "URL.h"
@@ -44,6 +45,16 @@ std::string getDirKey(const CURL& url)
   return dirPath;
 }
 
+void ClearStoredDirectory(const std::string& dirPath)
+{
+  // the stored listing is only checked against the modification time of the directory, which
+  // doesn't change with sub second precision on every filesystem
+  CDirectoryCacheStore& store = CDirectoryCacheStore::GetInstance();
+  const CURL dirUrl(dirPath);
+  if (store.IsEnabled() && CDirectoryCacheStore::IsCacheable(dirUrl))
+    store.Remove(dirUrl);
+}
+
 } // Unnamed namespace
 
 CDirectoryCache::CDir::CDir(CacheType cacheType) : m_Items(std::make_unique<CFileItemList>())
@@ -128,6 +139,8 @@ void CDirectoryCache::ClearFile(const CURL& url)
 {
   const std::string dirPath = getDirKey(url);
   m_cache.erase(dirPath);
+
+  ClearStoredDirectory(dirPath);
 }
 
 void CDirectoryCache::ClearDirectory(const CURL& url)
@@ -149,17 +162,22 @@ void CDirectoryCache::ClearSubPaths(const CURL& url)
 
 void CDirectoryCache::AddFile(const CURL& url)
 {
-  std::unique_lock lock(m_cs);
-
   const std::string dirPath = getDirKey(url);
-
-  const auto i{m_cache.find(dirPath)};
-  if (i != m_cache.cend())
   {
-    CDir& dir{i->second};
-    dir.m_Items->Add(std::make_shared<CFileItem>(url.Get(), false));
-    dir.SetLastAccess(m_accessCounter);
+    std::unique_lock lock(m_cs);
+
+    const auto i{m_cache.find(dirPath)};
+    if (i != m_cache.cend())
+    {
+      CDir& dir{i->second};
+      dir.m_Items->Add(std::make_shared<CFileItem>(url.Get(), false));
+      dir.SetLastAccess(m_accessCounter);
+    }
   }
+
+  // the store lists its own directory through CDirectory while holding its lock, so it must not
+  // be called with m_cs held
+  ClearStoredDirectory(dirPath);
 }
 
 bool CDirectoryCache::FileExists(const CURL& url, bool& foundInCache)
@@ -250,5 +268,12 @@ void CDirectoryCache::PrintStats() const
   }
   CLog::Log(LOGDEBUG, "{} - {} folders cached, with {} items total.  Oldest is {}, current is {}",
             __FUNCTION__, numDirs, numItems, oldest, m_accessCounter);
+
+  const CDirectoryCacheStore::Stats stats = CDirectoryCacheStore::GetInstance().GetStats();
+  CLog::Log(LOGDEBUG,
+            "{} - persistent cache: {} hits, {} misses, {} stale, {} revalidations ({} refreshed), "
+            "{} writes",
+            __FUNCTION__, stats.hits, stats.misses, stats.stale, stats.revalidations,
+            stats.refreshes, stats.writes);
 }
 #endif
@@ -0,0 +1,471 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DirectoryCacheStore.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/DirectoryCache.h"
+#include "filesystem/File.h"
+#include "jobs/JobManager.h"
+#include "utils/Archive.h"
+#include "utils/Digest.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace XFILE;
+
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr int STORE_VERSION = 1;
+
+// changes within the same second as the stat can't be told apart by the modification time
+constexpr int64_t MIN_VALIDATOR_AGE = 2; // seconds
+} // unnamed namespace
+
+CDirectoryCacheStore::CDirectoryCacheStore(std::string path, unsigned int maxDirectories)
+  : m_path(std::move(path)), m_maxDirectories(maxDirectories)
+{
+  URIUtils::AddSlashAtEnd(m_path);
+}
+
+CDirectoryCacheStore& CDirectoryCacheStore::GetInstance()
+{
+  static CDirectoryCacheStore store("special://temp/directories/", 0);
+  return store;
+}
+
+void CDirectoryCacheStore::Configure(const std::string& path, unsigned int maxDirectories)
+{
+  std::vector<std::string> evicted;
+  std::unique_lock lock(m_section);
+  m_maxDirectories = maxDirectories;
+
+  std::string newPath(path);
+  URIUtils::AddSlashAtEnd(newPath);
+  if (newPath != m_path)
+  {
+    m_path = std::move(newPath);
+    m_loaded = false;
+    m_lru.clear();
+    m_entries.clear();
+  }
+
+  if (m_loaded)
+    evicted = Evict();
+  lock.unlock();
+
+  DeleteFiles(evicted);
+}
+
+bool CDirectoryCacheStore::IsCacheable(const CURL& url)
+{
+  if (url.GetHostName().empty() || !url.GetUserName().empty() || !url.GetPassWord().empty())
+    return false;
+
+  return url.IsProtocol("smb") || url.IsProtocol("nfs") || url.IsProtocol("ftp") ||
+         url.IsProtocol("ftps") || url.IsProtocol("dav") || url.IsProtocol("davs");
+}
+
+int64_t CDirectoryCacheStore::GetValidator(const CURL& url)
+{
+  struct __stat64 st = {};
+  if (CFile::Stat(url, &st) != 0 || st.st_mtime <= 0)
+    return 0;
+
+  if (st.st_mtime > static_cast<int64_t>(std::time(nullptr)) - MIN_VALIDATOR_AGE)
+    return 0;
+
+  return st.st_mtime;
+}
+
+bool CDirectoryCacheStore::GetDirectory(const CURL& url, CFileItemList& items, bool allowStale)
+{
+  if (!IsEnabled())
+    return false;
+
+  Load();
+
+  const std::string path = GetPath(url);
+  const std::string key = GetKey(path);
+  std::string file;
+  {
+    std::unique_lock lock(m_section);
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+      ++m_stats.misses;
+      return false;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+    file = GetFile(key);
+  }
+
+  int64_t validator = 0;
+  if (!Read(file, path, items, validator))
+  {
+    items.Clear();
+    bool erased = false;
+    {
+      std::unique_lock lock(m_section);
+      ++m_stats.misses;
+      erased = Erase(key);
+    }
+    if (erased)
+      CFile::Delete(file);
+    return false;
+  }
+
+  if (!allowStale)
+  {
+    const bool valid = validator != 0 && GetValidator(url) == validator;
+
+    std::unique_lock lock(m_section);
+    if (!valid)
+    {
+      items.Clear();
+      ++m_stats.stale;
+      return false;
+    }
+
+    ++m_stats.hits;
+    const auto it = m_entries.find(key);
+    if (it != m_entries.end())
+      it->second.revalidated = true;
+    return true;
+  }
+
+  bool revalidate = false;
+  {
+    std::unique_lock lock(m_section);
+    ++m_stats.hits;
+    const auto it = m_entries.find(key);
+    if (it != m_entries.end() && !it->second.revalidated)
+    {
+      it->second.revalidated = true;
+      revalidate = true;
+    }
+  }
+
+  const auto jobManager = CServiceBroker::GetJobManager();
+  if (revalidate && jobManager)
+  {
+    jobManager->Submit([this, url, key, validator]() { Revalidate(url, key, validator); },
+                       CJob::PRIORITY_LOW);
+  }
+
+  return true;
+}
+
+void CDirectoryCacheStore::SetDirectory(const CURL& url,
+                                        const CFileItemList& items,
+                                        int64_t validator)
+{
+  if (!IsEnabled())
+    return;
+
+  // the listing is handed to the caller, which may still alter the items
+  auto copy = std::make_shared<CFileItemList>();
+  copy->Copy(items);
+
+  const auto jobManager = CServiceBroker::GetJobManager();
+  if (!jobManager)
+  {
+    Store(url, *copy, validator);
+    return;
+  }
+
+  jobManager->Submit([this, url, copy, validator]() { Store(url, *copy, validator); },
+                     CJob::PRIORITY_LOW);
+}
+
+bool CDirectoryCacheStore::Store(const CURL& url, const CFileItemList& items, int64_t validator)
+{
+  Load();
+
+  const std::string path = GetPath(url);
+  const std::string key = GetKey(path);
+  std::string file;
+  std::string tmpFile;
+  {
+    std::unique_lock lock(m_section);
+    if (!IsEnabled())
+      return false;
+
+    file = GetFile(key);
+    tmpFile = StringUtils::Format("{}.{}.tmp", file, ++m_tmpSerial);
+  }
+
+  // write to a temporary file first so a partially written listing is never picked up
+  CFile stream;
+  if (!stream.OpenForWrite(tmpFile, true))
+  {
+    CLog::Log(LOGERROR, "CDirectoryCacheStore::{} - Failed to write listing \"{}\"", __FUNCTION__,
+              tmpFile);
+    return false;
+  }
+  {
+    CArchive ar(&stream, CArchive::store);
+    // archiving only reads the list, it just shares the method with loading
+    ar << STORE_VERSION << path << validator << const_cast<CFileItemList&>(items);
+    ar.Close();
+  }
+  stream.Close();
+
+  if (!CFile::Rename(tmpFile, file))
+  {
+    CLog::Log(LOGERROR, "CDirectoryCacheStore::{} - Failed to rename listing \"{}\"", __FUNCTION__,
+              tmpFile);
+    CFile::Delete(tmpFile);
+    return false;
+  }
+
+  std::vector<std::string> evicted;
+  std::unique_lock lock(m_section);
+  ++m_stats.writes;
+  const auto it = m_entries.find(key);
+  if (it != m_entries.end())
+  {
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+    it->second.revalidated = true;
+    return true;
+  }
+
+  m_lru.emplace_front(key);
+  m_entries.emplace(key, Entry{m_lru.begin(), true});
+  evicted = Evict();
+  const bool stored = m_entries.contains(key);
+  lock.unlock();
+
+  DeleteFiles(evicted);
+  return stored;
+}
+
+void CDirectoryCacheStore::Remove(const CURL& url)
+{
+  if (!IsEnabled())
+    return;
+
+  Load();
+
+  const std::string key = GetKey(GetPath(url));
+  std::string file;
+  {
+    std::unique_lock lock(m_section);
+    if (!Erase(key))
+      return;
+    file = GetFile(key);
+  }
+
+  CFile::Delete(file);
+}
+
+CDirectoryCacheStore::Stats CDirectoryCacheStore::GetStats() const
+{
+  std::unique_lock lock(m_section);
+  return m_stats;
+}
+
+std::string CDirectoryCacheStore::GetPath(const CURL& url)
+{
+  // same normalization as the memory cache
+  std::string path = url.GetWithoutOptions();
+  URIUtils::RemoveSlashAtEnd(path);
+  return path;
+}
+
+std::string CDirectoryCacheStore::GetKey(const std::string& path)
+{
+  return CDigest::Calculate(CDigest::Type::MD5, path);
+}
+
+std::string CDirectoryCacheStore::GetFile(const std::string& key) const
+{
+  return m_path + key + ".dir";
+}
+
+bool CDirectoryCacheStore::Read(const std::string& file,
+                                const std::string& path,
+                                CFileItemList& items,
+                                int64_t& validator) const
+{
+  CFile stream;
+  if (!stream.Open(file))
+    return false;
+
+  try
+  {
+    CArchive ar(&stream, CArchive::load);
+    int version = 0;
+    std::string storedPath;
+    ar >> version;
+    if (version != STORE_VERSION)
+      return false;
+
+    // guards against hash collisions
+    ar >> storedPath;
+    if (storedPath != path)
+      return false;
+
+    ar >> validator;
+    ar >> items;
+    ar.Close();
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CDirectoryCacheStore::{} - Corrupt listing \"{}\"", __FUNCTION__, file);
+    return false;
+  }
+
+  return true;
+}
+
+void CDirectoryCacheStore::Revalidate(const CURL& url, const std::string& key, int64_t validator)
+{
+  {
+    std::unique_lock lock(m_section);
+    ++m_stats.revalidations;
+  }
+
+  // stat before listing, changes made while listing then show up as a different validator later
+  const int64_t current = GetValidator(url);
+  if (validator != 0 && current == validator)
+    return;
+
+  // an unreachable share keeps its listing, it's dropped once the directory is listed again
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(url, items, "",
+                                DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_GET_HIDDEN |
+                                    DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  {
+    std::unique_lock lock(m_section);
+    ++m_stats.refreshes;
+  }
+
+  CLog::Log(LOGDEBUG, "CDirectoryCacheStore::{} - Refreshing changed listing of {}", __FUNCTION__,
+            url.GetRedacted());
+
+  if (Store(url, items, current))
+    g_directoryCache.ClearDirectory(url);
+}
+
+void CDirectoryCacheStore::Load()
+{
+  std::string path;
+  {
+    std::unique_lock lock(m_section);
+    if (m_loaded || !IsEnabled())
+      return;
+    path = m_path;
+  }
+
+  // the directory is listed without holding the lock, if several threads get here the first one
+  // to finish fills the index
+  std::vector<std::string> keys;
+  std::vector<std::string> tmpFiles;
+  if (!CDirectory::Exists(path) && !CDirectory::Create(path))
+  {
+    CLog::Log(LOGERROR, "CDirectoryCacheStore::{} - Failed to create cache directory \"{}\"",
+              __FUNCTION__, path);
+  }
+  else
+  {
+    CFileItemList items;
+    if (CDirectory::GetDirectory(path, items, "", DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    {
+      // there is no access time to restore, so the modification time orders the listings initially
+      std::vector<std::shared_ptr<CFileItem>> files;
+      for (const auto& item : items)
+      {
+        if (!item->IsFolder())
+          files.emplace_back(item);
+      }
+      std::ranges::sort(files, [](const auto& a, const auto& b)
+                        { return a->GetDateTime() < b->GetDateTime(); });
+
+      for (const auto& item : files)
+      {
+        const std::string name = URIUtils::GetFileName(item->GetPath());
+        if (name.ends_with(".tmp"))
+          tmpFiles.emplace_back(item->GetPath());
+        else if (name.ends_with(".dir"))
+          keys.emplace_back(name.substr(0, name.size() - 4));
+      }
+    }
+  }
+
+  std::vector<std::string> evicted;
+  {
+    std::unique_lock lock(m_section);
+    if (m_loaded || m_path != path)
+      return;
+
+    m_loaded = true;
+    for (auto& key : keys)
+    {
+      if (m_entries.contains(key))
+        continue;
+
+      m_lru.emplace_front(key);
+      m_entries.emplace(std::move(key), Entry{m_lru.begin()});
+    }
+
+    CLog::Log(LOGDEBUG, "CDirectoryCacheStore::{} - Found {} listings in \"{}\"", __FUNCTION__,
+              m_entries.size(), m_path);
+
+    evicted = Evict();
+  }
+
+  // left over from interrupted writes, listings are only written once the index is loaded
+  DeleteFiles(tmpFiles);
+  DeleteFiles(evicted);
+}
+
+std::vector<std::string> CDirectoryCacheStore::Evict()
+{
+  std::vector<std::string> files;
+  while (m_lru.size() > m_maxDirectories)
+  {
+    const std::string key = m_lru.back();
+    files.emplace_back(GetFile(key));
+    Erase(key);
+  }
+  return files;
+}
+
+bool CDirectoryCacheStore::Erase(const std::string& key)
+{
+  const auto it = m_entries.find(key);
+  if (it == m_entries.end())
+    return false;
+
+  m_lru.erase(it->second.lru);
+  m_entries.erase(it);
+  return true;
+}
+
+void CDirectoryCacheStore::DeleteFiles(const std::vector<std::string>& files)
+{
+  for (const std::string& file : files)
+    CFile::Delete(file);
+}
@@ -0,0 +1,138 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <list>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class CFileItemList;
+class CURL;
+
+namespace XFILE
+{
+
+/*!
+ \brief Persistent tier of the directory cache, keeping listings of network shares across restarts.
+
+ Each listing is stored in its own file together with the modification time of the directory as
+ validator. Callers accepting cached listings get a stored listing right away and it's revalidated
+ in the background, all others only get it if the validator still matches, which costs a single
+ stat instead of enumerating the directory. The number of stored listings is bounded, the least
+ recently used ones are evicted.
+ */
+class CDirectoryCacheStore
+{
+public:
+  struct Stats
+  {
+    uint64_t hits = 0; //!< listings served from the store
+    uint64_t misses = 0; //!< lookups of directories not in the store
+    uint64_t stale = 0; //!< stored listings not served as the validator didn't match
+    uint64_t revalidations = 0; //!< background checks of listings served without validation
+    uint64_t refreshes = 0; //!< background checks which found the directory changed
+    uint64_t writes = 0; //!< listings written to the store
+  };
+
+  CDirectoryCacheStore(std::string path, unsigned int maxDirectories);
+
+  static CDirectoryCacheStore& GetInstance();
+
+  /*!
+   \brief Change location and size limit of the store. Changing the location drops the index.
+   \param maxDirectories maximum number of stored listings, 0 disables the store
+   */
+  void Configure(const std::string& path, unsigned int maxDirectories);
+
+  bool IsEnabled() const { return m_maxDirectories > 0; }
+
+  /*!
+   \brief Whether listings of the given directory are worth and safe to store.
+   Only network shares are slow enough to list, and listings are never stored with credentials.
+   */
+  static bool IsCacheable(const CURL& url);
+
+  /*!
+   \brief Get the modification time of a directory to validate its listing with.
+   \return the modification time or 0 if it's unknown or too recent to detect further changes
+   */
+  static int64_t GetValidator(const CURL& url);
+
+  /*!
+   \brief Get a stored listing.
+   \param allowStale return the listing without validating it first. It's revalidated in the
+   background then, once per session, and replaced if the directory changed.
+   \return true if the listing was found (and valid)
+   */
+  bool GetDirectory(const CURL& url, CFileItemList& items, bool allowStale);
+
+  /*!
+   \brief Store a listing in the background.
+   \param validator validator of the directory taken before it was listed
+   \sa GetValidator
+   */
+  void SetDirectory(const CURL& url, const CFileItemList& items, int64_t validator);
+
+  /*!
+   \brief Store a listing with the given validator.
+   \sa GetValidator
+   */
+  bool Store(const CURL& url, const CFileItemList& items, int64_t validator);
+
+  void Remove(const CURL& url);
+
+  Stats GetStats() const;
+
+private:
+  struct Entry
+  {
+    std::list<std::string>::iterator lru;
+    bool revalidated = false;
+  };
+
+  static std::string GetPath(const CURL& url);
+  static std::string GetKey(const std::string& path);
+  std::string GetFile(const std::string& key) const;
+
+  bool Read(const std::string& file,
+            const std::string& path,
+            CFileItemList& items,
+            int64_t& validator) const;
+  void Revalidate(const CURL& url, const std::string& key, int64_t validator);
+
+  /*!
+   \brief Fill the index from the listings in the store directory, once. Must be called without
+   holding the lock, the directory is listed outside of it.
+   */
+  void Load();
+
+  /*!
+   \brief Drop the least recently used listings over the limit from the index.
+   \return the listing files to delete once the lock is released
+   */
+  std::vector<std::string> Evict();
+  bool Erase(const std::string& key);
+  static void DeleteFiles(const std::vector<std::string>& files);
+
+  mutable CCriticalSection m_section;
+  std::string m_path;
+  std::atomic<unsigned int> m_maxDirectories;
+  bool m_loaded = false;
+  uint64_t m_tmpSerial = 0;
+  std::list<std::string> m_lru; //!< keys, most recently used first
+  std::unordered_map<std::string, Entry> m_entries;
+  Stats m_stats;
+};
+
+} // namespace XFILE
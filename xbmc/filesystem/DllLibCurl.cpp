@@ -87,6 +87,11 @@ CURLMcode DllLibCurl::multi_timeout(CURLM* multi_handle, long* timeout)
   return curl_multi_timeout(multi_handle, timeout);
 }
 
+CURLMcode DllLibCurl::multi_wait(CURLM* multi_handle, int timeout_ms, int* numfds)
+{
+  return curl_multi_wait(multi_handle, nullptr, 0, timeout_ms, numfds);
+}
+
 CURLMsg* DllLibCurl::multi_info_read(CURLM* multi_handle, int* msgs_in_queue)
 {
   return curl_multi_info_read(multi_handle, msgs_in_queue);
@@ -112,13 +117,37 @@ const char* DllLibCurl::easy_strerror(CURLcode code)
   return curl_easy_strerror(code);
 }
 
+CURLSH* DllLibCurl::share_init()
+{
+  return curl_share_init();
+}
+
+CURLSHcode DllLibCurl::share_cleanup(CURLSH* share)
+{
+  return curl_share_cleanup(share);
+}
+
 DllLibCurlGlobal::DllLibCurlGlobal()
 {
   /* we handle this ourself */
   if (curl_global_init(CURL_GLOBAL_ALL))
   {
     CLog::Log(LOGERROR, "Error initializing libcurl");
+    return;
   }
+
+  m_share = share_init();
+  if (!m_share)
+    return;
+
+  share_setopt(m_share, CURLSHOPT_LOCKFUNC, share_lock);
+  share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, share_unlock);
+  share_setopt(m_share, CURLSHOPT_USERDATA, this);
+  share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+  share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073d00 // 0.7.61.0
+  share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_PSL);
+#endif
 }
 
 DllLibCurlGlobal::~DllLibCurlGlobal()
@@ -132,10 +161,26 @@ DllLibCurlGlobal::~DllLibCurlGlobal()
     if (session.m_multi)
       multi_cleanup(session.m_multi);
   }
+  // transfers still alive at exit keep the share in use, it's leaked then
+  if (m_share && share_cleanup(m_share) == CURLSHE_IN_USE)
+    m_share = nullptr;
   // close libcurl
   curl_global_cleanup();
 }
 
+void DllLibCurlGlobal::share_lock(CURL_HANDLE* handle,
+                                  curl_lock_data data,
+                                  curl_lock_access access,
+                                  void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].lock();
+}
+
+void DllLibCurlGlobal::share_unlock(CURL_HANDLE* handle, curl_lock_data data, void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].unlock();
+}
+
 void DllLibCurlGlobal::CheckIdle()
 {
   std::unique_lock lock(m_critSection);
@@ -10,6 +10,8 @@
 
 #include "threads/CriticalSection.h"
 
+#include <array>
+#include <mutex>
 #include <stdio.h>
 #include <string>
 #include <sys/time.h>
@@ -57,11 +59,19 @@ public:
                         fd_set* exc_fd_set,
                         int* max_fd);
   CURLMcode multi_timeout(CURLM* multi_handle, long* timeout);
+  CURLMcode multi_wait(CURLM* multi_handle, int timeout_ms, int* numfds);
   CURLMsg* multi_info_read(CURLM* multi_handle, int* msgs_in_queue);
   CURLMcode multi_cleanup(CURLM* handle);
   curl_slist* slist_append(curl_slist* list, const char* to_append);
   void slist_free_all(curl_slist* list);
   const char* easy_strerror(CURLcode code);
+  CURLSH* share_init();
+  template<typename... Args>
+  CURLSHcode share_setopt(CURLSH* share, CURLSHoption option, Args... args)
+  {
+    return curl_share_setopt(share, option, std::forward<Args>(args)...);
+  }
+  CURLSHcode share_cleanup(CURLSH* share);
 };
 
 class DllLibCurlGlobal : public DllLibCurl
@@ -82,6 +92,14 @@ public:
   CURL_HANDLE* easy_duphandle(CURL_HANDLE* easy_handle) override;
   void CheckIdle();
 
+  /*!
+   \brief Share handle to attach to all transfers, nullptr if it couldn't be created.
+   It holds the DNS cache and the TLS sessions, so concurrent requests to the same hosts, e.g. of
+   scrapers and artwork downloads, skip the lookup and resume the TLS session instead of doing a
+   full handshake each. Connections are not shared, libcurl doesn't support that across threads.
+   */
+  CURLSH* GetShare() const { return m_share; }
+
   /* overloaded load and unload with reference counter */
 
   /* structure holding a session info */
@@ -100,6 +118,16 @@ public:
 
   VEC_CURLSESSIONS m_sessions;
   CCriticalSection m_critSection;
+
+private:
+  static void share_lock(CURL_HANDLE* handle,
+                         curl_lock_data data,
+                         curl_lock_access access,
+                         void* userptr);
+  static void share_unlock(CURL_HANDLE* handle, curl_lock_data data, void* userptr);
+
+  CURLSH* m_share = nullptr;
+  std::array<std::mutex, CURL_LOCK_DATA_LAST> m_shareLocks;
 };
 } // namespace XCURL
 
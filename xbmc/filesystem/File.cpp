@@ -19,6 +19,9 @@
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationPowerHandling.h"
 #include "commons/Exception.h"
+#if defined(HAVE_LINUX_IO_URING)
+#include "platform/linux/filesystem/UringFile.h"
+#endif
 #ifdef TARGET_WINDOWS
 #include "platform/win32/dirent.h" // For S_ISDIR compatability macro
 #endif
@@ -322,7 +325,12 @@ bool CFile::Open(const CURL& file, const unsigned int flags)
       }
     }
 
-    m_pFile.reset(CFileFactory::CreateLoader(url));
+#if defined(HAVE_LINUX_IO_URING)
+    if ((m_flags & READ_QUEUED) && (url.IsProtocol("file") || url.GetProtocol().empty()))
+      m_pFile = std::make_unique<CUringFile>();
+    else
+#endif
+      m_pFile.reset(CFileFactory::CreateLoader(url));
 
     if (!m_pFile)
       return false;
@@ -666,6 +674,42 @@ ssize_t CFile::Read(void *lpBuf, size_t uiBufSize)
   return 0;
 }
 
+ssize_t CFile::ReadSpan(const uint8_t*& data, size_t size)
+{
+  if (!m_pFile)
+    return -1;
+
+  if (size > SSIZE_MAX)
+    size = SSIZE_MAX;
+
+  try
+  {
+    if (m_pBuffer)
+      return m_pBuffer->ReadSpan(data, static_cast<std::streamsize>(size));
+
+    return m_pFile->ReadSpan(data, size);
+  }
+  XBMCCOMMONS_HANDLE_UNCHECKED
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{} - Unhandled exception", __FUNCTION__);
+  }
+  return -1;
+}
+
+void CFile::ReleaseSpan(size_t consumed)
+{
+  if (!m_pFile)
+    return;
+
+  if (m_pBuffer)
+    m_pBuffer->ReleaseSpan(static_cast<std::streamsize>(consumed));
+  else
+    m_pFile->ReleaseSpan(consumed);
+  if (m_bitStreamStats && consumed > 0)
+    m_bitStreamStats->AddSampleBytes(consumed);
+}
+
 //*********************************************************************************************
 void CFile::Close()
 {
@@ -1168,6 +1212,35 @@ CFileStreamBuffer::int_type CFileStreamBuffer::underflow()
   return traits_type::to_int_type(*gptr());
 }
 
+std::streamsize CFileStreamBuffer::ReadSpan(const uint8_t*& data, std::streamsize size)
+{
+  m_spanFromFile = false;
+  if (gptr() < egptr())
+  {
+    data = reinterpret_cast<const uint8_t*>(gptr());
+    return std::min<std::streamsize>(size, egptr() - gptr());
+  }
+
+  if (!m_file)
+    return -1;
+
+  // nothing buffered, the file position is the read position
+  const ssize_t ret = m_file->ReadSpan(data, static_cast<size_t>(size));
+  m_spanFromFile = ret > 0;
+  return ret;
+}
+
+void CFileStreamBuffer::ReleaseSpan(std::streamsize consumed)
+{
+  if (m_spanFromFile)
+  {
+    m_spanFromFile = false;
+    m_file->ReleaseSpan(static_cast<size_t>(consumed));
+  }
+  else
+    gbump(static_cast<int>(consumed));
+}
+
 CFileStreamBuffer::pos_type CFileStreamBuffer::seekoff(
   off_type offset,
   std::ios_base::seekdir way,
@@ -73,6 +73,13 @@ public:
    */
   ssize_t Read(void* bufPtr, size_t bufSize);
 
+  /*!
+   * \brief Borrow data at the current position without copying it, see IFile::ReadSpan().
+   * \return number of bytes available at data, 0 at EOF, -1 if not supported, -2 on error
+   */
+  ssize_t ReadSpan(const uint8_t*& data, size_t size);
+  void ReleaseSpan(size_t consumed);
+
   /*!
    * \brief String reading by line
    * \param line[OUT] The line read
@@ -223,6 +230,14 @@ public:
   void Attach(IFile *file);
   void Detach();
 
+  /*!
+   * \brief Borrow data at the read position, see IFile::ReadSpan().
+   * Data already buffered is lent from the buffer. Once it's used up, data is lent from the file
+   * itself without being copied into the buffer first.
+   */
+  std::streamsize ReadSpan(const uint8_t*& data, std::streamsize size);
+  void ReleaseSpan(std::streamsize consumed);
+
 private:
   int_type underflow() override;
   std::streamsize showmanyc() override;
@@ -233,6 +248,7 @@ private:
   char*  m_buffer;
   int    m_backsize;
   int    m_frontsize = 0;
+  bool m_spanFromFile = false;
 };
 
 // very basic file input stream
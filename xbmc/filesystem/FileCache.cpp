@@ -9,11 +9,15 @@
 #include "FileCache.h"
 
 #include "CircularCache.h"
+#include "ReadAheadController.h"
+#include "SegmentCache.h"
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
+#include "utils/URIUtils.h"
 #include "utils/log.h"
 
 #include <mutex>
@@ -81,6 +85,11 @@ CFileCache::CFileCache(const unsigned int flags)
 {
 }
 
+CFileCache::CFileCache(const unsigned int flags, std::unique_ptr<CCacheStrategy> cache)
+  : CThread("FileCache"), m_pCache(std::move(cache)), m_fileSize(0), m_flags(flags)
+{
+}
+
 CFileCache::~CFileCache()
 {
   Close();
@@ -137,7 +146,31 @@ bool CFileCache::Open(const CURL& url)
 
   if (!m_pCache)
   {
-    if (cacheMemSize == 0)
+    const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    CSegmentCacheStore& segmentStore = CSegmentCacheStore::GetInstance();
+    segmentStore.Configure(URIUtils::AddFileToFolder(advancedSettings->m_cachePath, "segments"),
+                           static_cast<uint64_t>(advancedSettings->m_segmentCacheSize) * 1024 * 1024);
+
+    // Size and modification time are part of the segment key, without them cached data can't be
+    // validated. Local files gain nothing from a copy on local disk.
+    struct __stat64 st = {};
+    if (segmentStore.IsEnabled() && m_fileSize > 0 && !URIUtils::IsHD(url.Get()) &&
+        m_source.Stat(&st) == 0 && st.st_mtime > 0)
+    {
+      // Use persistent segment cache on disk, fetching at most half of it ahead
+      const int64_t maxForward =
+          std::max(static_cast<int64_t>(segmentStore.GetMaxSize() / 2),
+                   static_cast<int64_t>(segmentStore.GetSegmentSize() * 2));
+      m_pCache = std::make_unique<CSegmentCache>(
+          segmentStore, CSegmentCacheStore::GetKey(url, m_fileSize, st.st_mtime), m_fileSize,
+          maxForward);
+      m_forwardCacheSize = 0;
+      m_maxForward = maxForward;
+
+      CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using persistent segment cache", __FUNCTION__,
+                m_sourcePath);
+    }
+    else if (cacheMemSize == 0)
     {
       // Use cache on disk
       m_pCache = std::make_unique<CSimpleFileCache>();
@@ -208,10 +241,29 @@ bool CFileCache::Open(const CURL& url)
   m_writeRate = 1024 * 1024;
   m_writeRateActual = 0;
   m_writeRateLowSpeed = 0;
+  m_rateHint = 0;
+  m_targetForward = 0;
+  m_consumeRate = 0;
   m_bFilling = true;
   m_seekEvent.Reset();
   m_seekEnded.Reset();
 
+  // Start reading the source behind data that is already cached, e.g. by a persistent cache. This
+  // is done before the thread starts, so the reader can't see the cache being repositioned.
+  const int64_t cachedEnd = m_pCache->CachedDataEndPosIfSeekTo(0);
+  if (cachedEnd > 0)
+  {
+    if (cachedEnd != m_fileSize && m_source.Seek(cachedEnd, SEEK_SET) != cachedEnd)
+    {
+      CLog::Log(LOGERROR, "CFileCache::{} - <{}> failed to seek behind cached data to {}",
+                __FUNCTION__, m_sourcePath, cachedEnd);
+      Close();
+      return false;
+    }
+    m_pCache->Reset(0);
+    m_writePos = m_pCache->CachedDataEndPos();
+  }
+
   CThread::Create(false);
 
   return true;
@@ -239,12 +291,17 @@ void CFileCache::Process()
   if (!settings)
     return;
 
-  float readFactor = settings->GetInt(CSettings::SETTING_FILECACHE_READFACTOR) / 100.0f;
+  const float readFactor = settings->GetInt(CSettings::SETTING_FILECACHE_READFACTOR) / 100.0f;
 
-  const bool useAdaptativeReadFactor = (readFactor < 1.0f);
+  // Adaptive read factor: forward cache and read rate follow the measured consumption
+  std::unique_ptr<CReadAheadController> readAhead;
+  if (readFactor < 1.0f)
+    readAhead = std::make_unique<CReadAheadController>(m_maxForward, m_chunkSize);
 
   CWriteRate limiter;
   CWriteRate average;
+  limiter.Reset(m_writePos);
+  average.Reset(m_writePos);
 
   while (!m_bStop)
   {
@@ -280,6 +337,8 @@ void CFileCache::Process()
         average.Reset(m_writePos, bCompleteReset); // Can only recalculate new average from scratch after a full reset (empty cache)
         limiter.Reset(m_writePos);
         m_nSeekResult = m_seekPos;
+        if (readAhead)
+          readAhead->Seek(m_readPos, std::chrono::steady_clock::now());
         if (bCompleteReset)
         {
           CLog::Log(LOGDEBUG,
@@ -293,23 +352,28 @@ void CFileCache::Process()
       m_seekEnded.Set();
     }
 
-    // variable read factor based on cache level
-    if (useAdaptativeReadFactor)
-    {
-      // cache level [0.0 - 1.0]
-      const double level = static_cast<double>(m_writePos - m_readPos) / m_maxForward;
-      readFactor = static_cast<float>(level * -2.5 + 4.0); // read factor [4.0x - 1.5x]
-    }
-
     while (m_writeRate)
     {
-      if (m_writePos - m_readPos < m_writeRate * readFactor)
+      // read freely below the minimum forward data, then limit the read rate
+      double minForward = m_writeRate * readFactor;
+      double maxRate = minForward;
+      if (readAhead)
+      {
+        readAhead->SetRateHint(m_rateHint);
+        readAhead->Update(m_readPos, m_writePos - m_readPos, std::chrono::steady_clock::now());
+        m_targetForward = readAhead->GetTargetForward();
+        m_consumeRate = readAhead->GetConsumeRate();
+        minForward = readAhead->GetMinForward();
+        maxRate = readAhead->GetReadRate();
+      }
+
+      if (m_writePos - m_readPos < minForward)
       {
         limiter.Reset(m_writePos);
         break;
       }
 
-      if (limiter.Rate(m_writePos) < m_writeRate * readFactor)
+      if (limiter.Rate(m_writePos) < maxRate)
         break;
 
       if (m_seekEvent.Wait(m_processWait))
@@ -338,7 +402,12 @@ void CFileCache::Process()
 
     ssize_t iRead = 0;
     if (maxSourceRead > 0)
+    {
+      const auto start = std::chrono::steady_clock::now();
       iRead = m_source.Read(buffer.get(), maxSourceRead);
+      if (readAhead && iRead > 0)
+        readAhead->OnSourceRead(iRead, std::chrono::steady_clock::now() - start);
+    }
     if (iRead <= 0)
     {
       // Check for actual EOF and retry as long as we still have data in our cache
@@ -433,7 +502,9 @@ void CFileCache::Process()
     if (m_bFilling && m_forwardCacheSize != 0)
     {
       const int64_t forward = m_pCache->WaitForData(0, 0ms);
-      if (forward + m_chunkSize >= m_forwardCacheSize)
+      const int64_t fillTarget =
+          readAhead && m_targetForward > 0 ? m_targetForward : m_forwardCacheSize;
+      if (forward + m_chunkSize >= fillTarget)
       {
         if (m_writeRateActual < m_writeRate)
           m_writeRateLowSpeed = m_writeRateActual;
@@ -513,6 +584,49 @@ retry:
   return -1;
 }
 
+ssize_t CFileCache::ReadSpan(const uint8_t*& data, size_t size)
+{
+  std::unique_lock lock(m_sync);
+  if (!m_pCache)
+    return -1;
+
+  if (size > SSIZE_MAX)
+    size = SSIZE_MAX;
+
+  while (true)
+  {
+    const int iRc = m_pCache->ReadSpan(data, size);
+    if (iRc >= 0)
+      return iRc;
+
+    // strategies that can't lend their memory are read with Read()
+    if (iRc != CACHE_RC_WOULD_BLOCK)
+      return -1;
+
+    const int64_t avail = m_pCache->WaitForData(1, 10s);
+    if (avail == 0)
+      return 0;
+
+    if (avail < 0)
+    {
+      // not -1, Read() would wait for the same data again
+      CLog::Log(LOGWARNING, "CFileCache::{} - <{}> timeout waiting for data", __FUNCTION__,
+                m_sourcePath);
+      return -2;
+    }
+  }
+}
+
+void CFileCache::ReleaseSpan(size_t consumed)
+{
+  std::unique_lock lock(m_sync);
+  if (!m_pCache)
+    return;
+
+  m_pCache->Release(consumed);
+  m_readPos += consumed;
+}
+
 int64_t CFileCache::Seek(int64_t iFilePosition, int iWhence)
 {
   std::unique_lock lock(m_sync);
@@ -544,6 +658,7 @@ int64_t CFileCache::Seek(int64_t iFilePosition, int iWhence)
     // Never request closer to end than one chunk. Speeds up tag reading
     m_seekPos = std::min(iTarget, std::max((int64_t)0, m_fileSize - m_chunkSize));
 
+    m_seekEnded.Reset();
     m_seekEvent.Set();
     while (!m_seekEnded.Wait(100ms))
     {
@@ -622,6 +737,8 @@ int CFileCache::IoControl(IOControl request, void* param)
     status->maxrate = m_writeRate;
     status->currate = m_writeRateActual;
     status->lowrate = m_writeRateLowSpeed;
+    status->targetforward = m_targetForward;
+    status->consumerate = m_consumeRate;
     m_writeRateLowSpeed = 0; // Reset low speed condition
     return 0;
   }
@@ -629,6 +746,7 @@ int CFileCache::IoControl(IOControl request, void* param)
   if (request == IOControl::CACHE_SETRATE)
   {
     m_writeRate = *static_cast<uint32_t*>(param);
+    m_rateHint = m_writeRate;
 
     const double mBits = m_writeRate / 1024.0 / 1024.0 * 8.0; // Mbit/s
 
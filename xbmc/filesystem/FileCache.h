@@ -27,6 +27,11 @@ namespace XFILE
   {
   public:
     explicit CFileCache(const unsigned int flags);
+
+    /*!
+     \brief Cache into the given strategy instead of picking one from the settings.
+     */
+    CFileCache(const unsigned int flags, std::unique_ptr<CCacheStrategy> cache);
     ~CFileCache() override;
 
     // CThread methods
@@ -41,6 +46,8 @@ namespace XFILE
     int Stat(const CURL& url, struct __stat64* buffer) override;
 
     ssize_t Read(void* lpBuf, size_t uiBufSize) override;
+    ssize_t ReadSpan(const uint8_t*& data, size_t size) override;
+    void ReleaseSpan(size_t consumed) override;
 
     int64_t Seek(int64_t iFilePosition, int iWhence) override;
     int64_t GetPosition() override;
@@ -72,6 +79,9 @@ namespace XFILE
     uint32_t m_writeRate = 0;
     uint32_t m_writeRateActual = 0;
     uint32_t m_writeRateLowSpeed = 0;
+    uint32_t m_rateHint = 0; //!< stream bitrate as set by CACHE_SETRATE
+    int64_t m_targetForward = 0; //!< decision of the adaptive read-ahead
+    uint32_t m_consumeRate = 0;
     int64_t m_forwardCacheSize = 0;
     int64_t m_maxForward = 0;
     bool m_bFilling = false;
@@ -8,6 +8,8 @@
 
 #include "IDirectory.h"
 
+#include "FileItem.h"
+#include "FileItemList.h"
 #include "PasswordManager.h"
 #include "URL.h"
 #include "guilib/GUIKeyboardFactory.h"
@@ -47,11 +49,16 @@ IDirectory::~IDirectory(void) = default;
  */
 bool IDirectory::IsAllowed(const CURL& url) const
 {
-  if (m_strFileMask.empty())
+  return IsAllowed(url, m_strFileMask);
+}
+
+bool IDirectory::IsAllowed(const CURL& url, const std::string& mask)
+{
+  if (mask.empty())
     return true;
 
   // Check if strFile have an allowed extension
-  if (!url.HasExtension(m_strFileMask))
+  if (!url.HasExtension(mask))
     return false;
 
   // We should ignore all non dvd/vcd related ifo and dat files.
@@ -100,11 +107,17 @@ bool IDirectory::IsAllowed(const CURL& url) const
  */
 void IDirectory::SetMask(const std::string& strMask)
 {
-  m_strFileMask = strMask;
+  m_strFileMask = NormalizeMask(strMask);
+}
+
+std::string IDirectory::NormalizeMask(const std::string& strMask)
+{
+  std::string mask = strMask;
   // ensure it's completed with a | so that filtering is easy.
-  StringUtils::ToLower(m_strFileMask);
-  if (!m_strFileMask.empty() && m_strFileMask[m_strFileMask.size() - 1] != '|')
-    m_strFileMask += '|';
+  StringUtils::ToLower(mask);
+  if (!mask.empty() && mask[mask.size() - 1] != '|')
+    mask += '|';
+  return mask;
 }
 
 /*!
@@ -116,6 +129,29 @@ void IDirectory::SetFlags(int flags)
   m_flags = flags;
 }
 
+void IDirectory::SetItemsCallback(DirectoryItemsCallback callback)
+{
+  m_itemsCallback = std::move(callback);
+  m_reportedItems = 0;
+}
+
+void IDirectory::ReportItems(const std::vector<std::shared_ptr<CFileItem>>& items)
+{
+  // batches small enough to show the first items quickly, large enough to not flood the GUI
+  constexpr size_t ITEMS_BATCH_SIZE = 250;
+
+  if (!m_itemsCallback || items.size() < m_reportedItems + ITEMS_BATCH_SIZE)
+    return;
+
+  CFileItemList batch;
+  batch.Reserve(items.size() - m_reportedItems);
+  for (size_t i = m_reportedItems; i < items.size(); ++i)
+    batch.Add(std::make_shared<CFileItem>(*items[i]));
+  m_reportedItems = items.size();
+
+  m_itemsCallback(batch);
+}
+
 bool IDirectory::ProcessRequirements()
 {
   std::string type = m_requirements["type"].asString();
@@ -10,7 +10,10 @@
 
 #include "utils/Variant.h"
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 class CFileItemList;
 class CProfileManager;
@@ -47,6 +50,14 @@ enum DIR_FLAG
   DIR_FLAG_BYPASS_CACHE =
       (2 << 5) ///< Completely bypass the directory cache (no reading, no writing)
 };
+
+/*!
+ \brief Receives a batch of items while a directory is still being listed.
+ The batch holds copies, it may be kept and changed freely. It's called from the listing thread.
+ \sa IDirectory::SetItemsCallback
+ */
+using DirectoryItemsCallback = std::function<void(const CFileItemList& items)>;
+
 /*!
  \ingroup filesystem
  \brief Interface to the directory on a file system.
@@ -124,6 +135,15 @@ public:
   */
   virtual bool IsAllowed(const CURL& url) const;
 
+  /*!
+  \brief Whether a file matches a mask of extensions
+  \param url File to test.
+  \param mask Mask as returned by NormalizeMask(), an empty mask allows all files.
+  \return Returns \e true if the file should be listed
+  \sa SetMask
+  */
+  static bool IsAllowed(const CURL& url, const std::string& mask);
+
   /*! \brief Whether to allow all files/folders to be listed.
    \return Returns \e true if all files/folder should be listed.
    */
@@ -139,6 +159,20 @@ public:
   void SetMask(const std::string& strMask);
   void SetFlags(int flags);
 
+  /*!
+  \brief Bring a mask of extensions into the form used for filtering.
+  \sa SetMask, IsAllowed
+  */
+  static std::string NormalizeMask(const std::string& strMask);
+
+  /*!
+   \brief Set a callback to receive the items of the following fetches progressively.
+   The items are only a preview, the list returned by GetDirectory is authoritative. Implementations
+   which don't report their items while listing never call it. Pass nullptr to remove it.
+   \sa ReportItems
+   */
+  void SetItemsCallback(DirectoryItemsCallback callback);
+
   /*! \brief Process additional requirements before the directory fetch is performed.
    Some directory fetches may require authentication, keyboard input etc.  The IDirectory subclass
    should call GetKeyboardInput, SetErrorDialog or RequireAuthentication and then return false
@@ -187,6 +221,14 @@ protected:
    */
   void RequireAuthentication(const CURL& url);
 
+  /*! \brief Hand the items listed so far to the items callback.
+   Call this method from the GetDirectory method while collecting the items. Only the items added
+   since the last call are passed on, once there are enough of them to be worth a GUI update.
+   \param items all items collected by the current fetch so far
+   \sa SetItemsCallback
+   */
+  void ReportItems(const std::vector<std::shared_ptr<CFileItem>>& items);
+
   static const CProfileManager *m_profileManager;
 
   std::string m_strFileMask;  ///< Holds the file mask specified by SetMask()
@@ -194,5 +236,8 @@ protected:
   int m_flags; ///< Directory flags - see DIR_FLAG
 
   CVariant m_requirements;
+
+  DirectoryItemsCallback m_itemsCallback; ///< Set by SetItemsCallback()
+  size_t m_reportedItems{0}; ///< Number of items of the current fetch already reported
 };
 }
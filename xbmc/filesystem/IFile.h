@@ -85,6 +85,22 @@ public:
    *         or undetectable error occur, -1 in case of any explicit error
    */
   virtual ssize_t Read(void* bufPtr, size_t bufSize) = 0;
+  /**
+   * Attempt to borrow data at the current position from the file's own memory, without copying.
+   * A successful call has to be followed by ReleaseSpan() before any other call on the file.
+   * @param data[OUT] set to the borrowed data
+   * @param size maximum number of bytes to borrow
+   * @return number of bytes available at data, zero at end of file,
+   *         -1 if not supported, the data has to be read with Read() then,
+   *         -2 in case of an explicit error, e.g. a timeout waiting for data, which Read() would
+   *         run into as well
+   */
+  virtual ssize_t ReadSpan(const uint8_t*& data, size_t size) { return -1; }
+  /**
+   * Give back data borrowed with ReadSpan().
+   * @param consumed number of bytes used, the position advances by this amount
+   */
+  virtual void ReleaseSpan(size_t consumed) {}
   /**
    * Attempt to write bufSize bytes from buffer bufPtr into currently opened file.
    * @param bufPtr  pointer to buffer
@@ -42,6 +42,9 @@ static const unsigned int READ_REOPEN = 0x100;
 /* indicate that caller want open a file without intermediate buffer regardless to file type */
 static const unsigned int READ_NO_BUFFER = 0x200;
 
+/* indicate that the file is read sequentially in large blocks, so local files may queue reads ahead */
+static const unsigned int READ_QUEUED = 0x400;
+
 struct SNativeIoControl
 {
   unsigned long int request;
@@ -55,6 +58,8 @@ struct SCacheStatus
   uint32_t maxrate; /**< maximum allowed read(fill) rate (bytes/second) */
   uint32_t currate; /**< average read rate (bytes/second) since last position change */
   uint32_t lowrate; /**< low speed read rate (bytes/second) (if any, else 0) */
+  uint64_t targetforward = 0; /**< forward bytes the adaptive read-ahead aims for (if any, else 0) */
+  uint32_t consumerate = 0; /**< measured consumption rate (bytes/second) (if known, else 0) */
 };
 
 enum class CacheBufferMode
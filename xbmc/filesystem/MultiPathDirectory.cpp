@@ -9,6 +9,7 @@
 #include "MultiPathDirectory.h"
 
 #include "Directory.h"
+#include "DirectoryFactory.h"
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "ServiceBroker.h"
@@ -17,12 +18,21 @@
 #include "dialogs/GUIDialogProgress.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
+#include "jobs/JobManager.h"
+#include "messaging/ApplicationMessenger.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
 #include "threads/SystemClock.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 using namespace XFILE;
 
 using namespace std::chrono_literals;
@@ -38,6 +48,90 @@ CMultiPathDirectory::CMultiPathDirectory() = default;
 
 CMultiPathDirectory::~CMultiPathDirectory() = default;
 
+namespace
+{
+// sub-paths listed at the same time, besides the calling thread
+constexpr size_t MAX_PARALLEL_FETCHES = 3;
+// time without a finished listing after which the calling thread lists unclaimed paths itself, in
+// case the jobs were cancelled or are stuck behind others
+constexpr auto STALL_TIMEOUT = 5s;
+
+/*!
+ \brief Sub-path listings shared by the calling thread and the jobs helping it.
+ The paths are claimed in order by whoever is idle, so the caller never waits for a job which
+ didn't start yet, e.g. because all workers of the job manager are busy.
+ */
+struct CFetchState
+{
+  CFetchState(std::vector<std::string> paths, std::string mask, int flags)
+    : paths(std::move(paths)),
+      mask(std::move(mask)),
+      flags(flags),
+      listings(this->paths.size())
+  {
+  }
+
+  // fetch paths until there are none left
+  void Fetch()
+  {
+    for (size_t i = next++; i < paths.size(); i = next++)
+    {
+      CLog::Log(LOGDEBUG, "Getting Directory ({})", CURL::GetRedacted(paths[i]));
+      FetchPath(i);
+
+      {
+        std::unique_lock lock(section);
+        ++done;
+        lastDone = i;
+      }
+      doneEvent.Set();
+    }
+  }
+
+  void FetchPath(size_t i)
+  {
+    CDirectory::CHints hints;
+    hints.mask = mask;
+    hints.flags = flags;
+    if (itemsCallback)
+      hints.itemsCallback = [this](const CFileItemList& batch)
+      {
+        std::unique_lock lock(callbackSection);
+        itemsCallback(batch);
+      };
+
+    const CURL url(paths[i]);
+    CListing& listing = listings[i];
+    if (!listing.directory)
+      listing.directory.reset(CDirectoryFactory::Create(URIUtils::SubstitutePath(url)));
+    listing.items.Clear();
+    listing.result = CDirectory::GetDirectory(url, listing.directory, listing.items, hints);
+    if (!listing.result)
+      CLog::Log(LOGERROR, "Error Getting Directory ({})", CURL::GetRedacted(paths[i]));
+  }
+
+  const std::vector<std::string> paths;
+  const std::string mask;
+  const int flags;
+  DirectoryItemsCallback itemsCallback;
+  CCriticalSection callbackSection;
+
+  struct CListing
+  {
+    std::shared_ptr<IDirectory> directory; // kept for its requirements, e.g. credentials
+    CFileItemList items;
+    bool result{false};
+  };
+  std::vector<CListing> listings;
+  std::atomic<size_t> next{0};
+
+  CCriticalSection section;
+  size_t done{0};
+  size_t lastDone{0};
+  CEvent doneEvent;
+};
+} // unnamed namespace
+
 bool CMultiPathDirectory::GetDirectory(const CURL& url, CFileItemList &items)
 {
   CLog::Log(LOGDEBUG, "CMultiPathDirectory::GetDirectory({})", url.GetRedacted());
@@ -46,14 +140,62 @@ bool CMultiPathDirectory::GetDirectory(const CURL& url, CFileItemList &items)
   if (!GetPaths(url, vecPaths))
     return false;
 
+  auto state = std::make_shared<CFetchState>(std::move(vecPaths), m_strFileMask, m_flags);
+  state->itemsCallback = m_itemsCallback;
+  const size_t count = state->paths.size();
+
+  // let the job manager list the other paths while this thread lists the first one. The process
+  // thread leaves all of them to the jobs, so that it keeps rendering while waiting
+  const auto jobManager = CServiceBroker::GetJobManager();
+  const bool processThread = CServiceBroker::GetAppMessenger()->IsProcessThread();
+  size_t queued = 0;
+  if (jobManager)
+  {
+    const size_t jobs = processThread ? std::min(count, MAX_PARALLEL_FETCHES + 1)
+                                      : std::min(count - 1, MAX_PARALLEL_FETCHES);
+    const auto fetch = [state] { state->Fetch(); };
+    for (size_t i = 0; i < jobs; ++i)
+    {
+      // the job manager refuses jobs once it's stopped
+      if (jobManager->AddJob(new CLambdaJob<decltype(fetch)>(fetch), nullptr,
+                             CJob::PRIORITY_HIGH) != 0)
+        ++queued;
+    }
+  }
+  if (!processThread || queued == 0)
+    state->Fetch();
+
   XbmcThreads::EndTime<> progressTime(3000ms); // 3 seconds before showing progress bar
+  XbmcThreads::EndTime<> stallTime(STALL_TIMEOUT);
   CGUIDialogProgress* dlgProgress = NULL;
 
-  unsigned int iFailures = 0;
-  for (unsigned int i = 0; i < vecPaths.size(); ++i)
+  size_t done = 0;
+  while (done < count)
   {
+    state->doneEvent.Wait(100ms);
+
+    size_t lastDone = 0;
+    {
+      std::unique_lock lock(state->section);
+      if (state->done != done)
+        stallTime.Set(STALL_TIMEOUT);
+      done = state->done;
+      lastDone = state->lastDone;
+    }
+
+    // jobs cancelled before they started never claim their paths, nor do jobs which don't get to
+    // run. Paths claimed by running jobs are left to them
+    if (done < count && stallTime.IsTimePast() && state->next < count)
+    {
+      CLog::Log(LOGDEBUG, "CMultiPathDirectory::{} - no progress, listing remaining paths",
+                __FUNCTION__);
+      state->Fetch();
+      stallTime.Set(STALL_TIMEOUT);
+      continue;
+    }
+
     // show the progress dialog if we have passed our time limit
-    if (progressTime.IsTimePast() && !dlgProgress)
+    if (progressTime.IsTimePast() && !dlgProgress && done < count)
     {
       dlgProgress = CServiceBroker::GetGUI()->GetWindowManager().GetWindow<CGUIDialogProgress>(WINDOW_DIALOG_PROGRESS);
       if (dlgProgress)
@@ -64,39 +206,43 @@ bool CMultiPathDirectory::GetDirectory(const CURL& url, CFileItemList &items)
         dlgProgress->SetLine(2, CVariant{""});
         dlgProgress->Open();
         dlgProgress->ShowProgressBar(true);
-        dlgProgress->SetProgressMax((int)vecPaths.size()*2);
         dlgProgress->Progress();
       }
     }
     if (dlgProgress)
     {
-      CURL url(vecPaths[i]);
+      CURL url(state->paths[lastDone]);
       dlgProgress->SetLine(1, CVariant{url.GetWithoutUserDetails()});
-      dlgProgress->SetProgressAdvance();
+      dlgProgress->SetPercentage(static_cast<int>(done * 100 / count));
       dlgProgress->Progress();
     }
+  }
 
-    CFileItemList tempItems;
-    CLog::Log(LOGDEBUG, "Getting Directory ({})", CURL::GetRedacted(vecPaths[i]));
-    if (CDirectory::GetDirectory(vecPaths[i], tempItems, m_strFileMask, m_flags))
-      items.Append(tempItems);
-    else
-    {
-      CLog::Log(LOGERROR, "Error Getting Directory ({})", CURL::GetRedacted(vecPaths[i]));
-      iFailures++;
-    }
-
-    if (dlgProgress)
+  // only the process thread can prompt for credentials or other input a sub-path requires
+  if (jobManager && processThread)
+  {
+    for (size_t i = 0; i < count; ++i)
     {
-      dlgProgress->SetProgressAdvance();
-      dlgProgress->Progress();
+      CFetchState::CListing& listing = state->listings[i];
+      if (!listing.result && listing.directory && listing.directory->ProcessRequirements())
+        state->FetchPath(i);
     }
   }
 
   if (dlgProgress)
     dlgProgress->Close();
 
-  if (iFailures == vecPaths.size())
+  // keep the order of the paths, no matter which listing finished first
+  unsigned int iFailures = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (state->listings[i].result)
+      items.Append(state->listings[i].items);
+    else
+      iFailures++;
+  }
+
+  if (iFailures == count)
     return false;
 
   // merge like-named folders into a sub multipath:// style url
@@ -59,49 +59,53 @@ KODI::TIME::FileTime GetDirEntryTime(const struct nfsdirent* dirent)
   return localTime;
 }
 
-bool ResolveSymlink(const std::string& dirName, struct nfsdirent* dirent, std::string& resolvedPath)
+bool ResolveSymlink(const CNfsContext& context,
+                    const std::string& dirName,
+                    struct nfsdirent* dirent,
+                    std::string& resolvedPath)
 {
-  std::unique_lock lock(gNfsConnection);
-
   bool retVal{true};
   std::string fullpath{dirName + dirent->name};
 
   char resolvedLink[NFS_MAX_PATH];
-  int ret{
-      nfs_readlink(gNfsConnection.GetNfsContext(), fullpath.c_str(), resolvedLink, NFS_MAX_PATH)};
+  int ret{nfs_readlink(context.Get(), fullpath.c_str(), resolvedLink, NFS_MAX_PATH)};
 
   if (ret == 0)
   {
     nfs_stat_64 tmpBuffer{};
+    std::string error;
 
     CURL resolvedUrl;
     resolvedUrl.SetPort(2049);
     resolvedUrl.SetProtocol("nfs");
-    resolvedUrl.SetHostName(gNfsConnection.GetConnectedIp());
+    resolvedUrl.SetHostName(context.GetResolvedHostName());
 
     // special case - if link target is absolute it could be even another export
     // intervolume symlinks baby ...
     if (resolvedLink[0] == '/')
     {
-      // use the special stat function for using an extra context
-      // because we are inside of a dir traversal
-      // and just can't change the global nfs context here
-      // without destroying something...
+      // stat with a context of the export of the link target, which is a different one than the
+      // context of the dir traversal
       fullpath = resolvedLink;
       resolvedUrl.SetFileName(fullpath);
-      ret = gNfsConnection.stat(resolvedUrl, &tmpBuffer);
+      std::string relativePath;
+      const CNfsConnection::CLease target = gNfsConnection.Acquire(resolvedUrl, relativePath);
+      ret = target ? nfs_stat64(target->Get(), relativePath.c_str(), &tmpBuffer) : -1;
+      if (ret != 0 && target)
+        error = nfs_get_error(target->Get());
     }
     else
     {
       fullpath = dirName + resolvedLink;
-      ret = nfs_stat64(gNfsConnection.GetNfsContext(), fullpath.c_str(), &tmpBuffer);
-      resolvedUrl.SetFileName(gNfsConnection.GetConnectedExport() + fullpath);
+      ret = nfs_stat64(context.Get(), fullpath.c_str(), &tmpBuffer);
+      resolvedUrl.SetFileName(context.GetExportPath() + fullpath);
+      if (ret != 0)
+        error = nfs_get_error(context.Get());
     }
 
     if (ret != 0)
     {
-      CLog::LogF(LOGERROR, "Failed to stat '{}' on link resolve ({})", fullpath,
-                 nfs_get_error(gNfsConnection.GetNfsContext()));
+      CLog::LogF(LOGERROR, "Failed to stat '{}' on link resolve ({})", fullpath, error);
       retVal = false;
     }
     else
@@ -148,8 +152,7 @@ bool ResolveSymlink(const std::string& dirName, struct nfsdirent* dirent, std::s
   }
   else
   {
-    CLog::LogF(LOGERROR, "Failed to readlink '{}' ({})", fullpath,
-               nfs_get_error(gNfsConnection.GetNfsContext()));
+    CLog::LogF(LOGERROR, "Failed to readlink '{}' ({})", fullpath, nfs_get_error(context.Get()));
     retVal = false;
   }
   return retVal;
@@ -218,10 +221,9 @@ std::vector<std::shared_ptr<CFileItem>> CNFSDirectory::GetServerList() const
 bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
 {
   // We accept nfs://server/path[/file]]]]
-  std::unique_lock lock(gNfsConnection);
-
   std::string strDirName = "";
-  if (!gNfsConnection.Connect(url, strDirName))
+  const CNfsConnection::CLease context = gNfsConnection.Acquire(url, strDirName);
+  if (!context)
   {
     //connect has failed - so try to get the exported filesystems if no path is given to the url
     if (url.GetShareName().empty())
@@ -236,13 +238,11 @@ bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
   }
 
   struct nfsdir* nfsdir = nullptr;
-  if (nfs_opendir(gNfsConnection.GetNfsContext(), strDirName.c_str(), &nfsdir) != 0)
+  if (nfs_opendir(context->Get(), strDirName.c_str(), &nfsdir) != 0)
   {
-    CLog::LogF(LOGERROR, "Failed to open '{}' ({})", strDirName,
-               nfs_get_error(gNfsConnection.GetNfsContext()));
+    CLog::LogF(LOGERROR, "Failed to open '{}' ({})", strDirName, nfs_get_error(context->Get()));
     return false;
   }
-  lock.unlock();
 
   std::string myStrPath(url.Get());
   URIUtils::AddSlashAtEnd(myStrPath);
@@ -251,14 +251,14 @@ bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
   std::string resolvedPath;
   std::vector<std::shared_ptr<CFileItem>> fileItems;
   struct nfsdirent* dirent = nullptr;
-  while ((dirent = nfs_readdir(gNfsConnection.GetNfsContext(), nfsdir)) != nullptr)
+  while ((dirent = nfs_readdir(context->Get(), nfsdir)) != nullptr)
   {
     const std::string& name = dirent->name;
 
     //resolve symlinks
     //resolve symlink changes dirent and name
     const bool isSymLink = dirent->type == NF3LNK;
-    if (isSymLink && !ResolveSymlink(strDirName, dirent, resolvedPath))
+    if (isSymLink && !ResolveSymlink(*context, strDirName, dirent, resolvedPath))
       continue;
 
     if (name == "." || name == ".." || name == "lost+found")
@@ -278,12 +278,12 @@ bool CNFSDirectory::GetDirectory(const CURL& url, CFileItemList &items)
 
     if (name[0] == '.')
       item->SetProperty("file:hidden", true);
+
+    ReportItems(fileItems);
   }
   items.AddItems(std::move(fileItems));
 
-  lock.lock();
-  nfs_closedir(gNfsConnection.GetNfsContext(), nfsdir); //close the dir
-  lock.unlock();
+  nfs_closedir(context->Get(), nfsdir); //close the dir
   return true;
 }
 
@@ -292,21 +292,21 @@ bool CNFSDirectory::Create(const CURL& url2)
   int ret = 0;
   bool success=true;
 
-  std::unique_lock lock(gNfsConnection);
   std::string folderName(url2.Get());
   URIUtils::RemoveSlashAtEnd(folderName);//mkdir fails if a slash is at the end!!!
   CURL url(folderName);
   folderName = "";
 
-  if(!gNfsConnection.Connect(url,folderName))
+  const CNfsConnection::CLease context = gNfsConnection.Acquire(url, folderName);
+  if (!context)
     return false;
 
-  ret = nfs_mkdir(gNfsConnection.GetNfsContext(), folderName.c_str());
+  ret = nfs_mkdir(context->Get(), folderName.c_str());
 
   success = (ret == 0 || -EEXIST == ret);
   if (!success)
     CLog::LogF(LOGERROR, "Failed to create '{}' ({})", folderName,
-               nfs_get_error(gNfsConnection.GetNfsContext()));
+               nfs_get_error(context->Get()));
   return success;
 }
 
@@ -314,21 +314,21 @@ bool CNFSDirectory::Remove(const CURL& url2)
 {
   int ret = 0;
 
-  std::unique_lock lock(gNfsConnection);
   std::string folderName(url2.Get());
   URIUtils::RemoveSlashAtEnd(folderName);//rmdir fails if a slash is at the end!!!
   CURL url(folderName);
   folderName = "";
 
-  if(!gNfsConnection.Connect(url,folderName))
+  const CNfsConnection::CLease context = gNfsConnection.Acquire(url, folderName);
+  if (!context)
     return false;
 
-  ret = nfs_rmdir(gNfsConnection.GetNfsContext(), folderName.c_str());
+  ret = nfs_rmdir(context->Get(), folderName.c_str());
 
   if (ret != 0 && errno != ENOENT)
   {
     CLog::LogF(LOGERROR, "Failed to remove '{}' ({})", folderName,
-               nfs_get_error(gNfsConnection.GetNfsContext()));
+               nfs_get_error(context->Get()));
     return false;
   }
   return true;
@@ -338,17 +338,17 @@ bool CNFSDirectory::Exists(const CURL& url2)
 {
   int ret = 0;
 
-  std::unique_lock lock(gNfsConnection);
   std::string folderName(url2.Get());
   URIUtils::RemoveSlashAtEnd(folderName);//remove slash at end or URIUtils::GetFileName won't return what we want...
   CURL url(folderName);
   folderName = "";
 
-  if(!gNfsConnection.Connect(url,folderName))
+  const CNfsConnection::CLease context = gNfsConnection.Acquire(url, folderName);
+  if (!context)
     return false;
 
   nfs_stat_64 info;
-  ret = nfs_stat64(gNfsConnection.GetNfsContext(), folderName.c_str(), &info);
+  ret = nfs_stat64(context->Get(), folderName.c_str(), &info);
 
   if (ret != 0)
   {
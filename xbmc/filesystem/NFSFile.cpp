@@ -21,6 +21,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <inttypes.h>
 #include <mutex>
 
@@ -55,6 +56,9 @@ namespace
 constexpr auto CONTEXT_TIMEOUT = 60s; // 2/3 parts of lease_time
 constexpr auto KEEP_ALIVE_TIMEOUT = 45s; // half of lease_time
 constexpr auto IDLE_TIMEOUT = 30s; // close fast unused contexts when no active connections
+constexpr auto POOL_WAIT_TIMEOUT = 5s; // wait for a busy context before opening one more
+
+constexpr unsigned int DEFAULT_MAX_CONTEXTS = 4; // per export
 
 constexpr int NFS4ERR_EXPIRED = -11; // client session expired due idle time greater than lease_time
 
@@ -62,37 +66,84 @@ constexpr auto SETTING_NFS_VERSION = "nfs.version";
 constexpr auto SETTING_NFS_CHUNKSIZE = "nfs.chunksize";
 } // unnamed namespace
 
-CNfsConnection::CNfsConnection()
-  : m_pNfsContext(NULL),
-    m_exportPath(""),
-    m_hostName(""),
-    m_resolvedHostName(""),
-    m_IdleTimeout(std::chrono::steady_clock::now() + IDLE_TIMEOUT)
+CNfsContext::CNfsContext(struct nfs_context* context,
+                         std::string id,
+                         std::string resolvedHostName,
+                         std::string exportPath)
+  : m_context(context),
+    m_id(std::move(id)),
+    m_resolvedHostName(std::move(resolvedHostName)),
+    m_exportPath(std::move(exportPath)),
+    m_lastAccessedTime(std::chrono::steady_clock::now())
+{
+}
+
+CNfsContext::~CNfsContext()
+{
+  if (m_context)
+    nfs_destroy_context(m_context);
+}
+
+CNfsConnection::CLease::CLease(CNfsConnection& pool,
+                               std::shared_ptr<CNfsContext> context,
+                               bool shared /* = false */)
+  : m_pool(&pool), m_context(std::move(context)), m_shared(shared)
+{
+}
+
+CNfsConnection::CLease::CLease(CLease&& other) noexcept
+  : m_pool(other.m_pool), m_context(std::move(other.m_context)), m_shared(other.m_shared)
+{
+  other.m_pool = nullptr;
+}
+
+CNfsConnection::CLease& CNfsConnection::CLease::operator=(CLease&& other) noexcept
+{
+  if (this != &other)
+  {
+    Release();
+    m_pool = other.m_pool;
+    m_context = std::move(other.m_context);
+    m_shared = other.m_shared;
+    other.m_pool = nullptr;
+  }
+  return *this;
+}
+
+void CNfsConnection::CLease::Release(bool reuse /* = true */)
 {
+  if (m_pool && m_context)
+    m_pool->Release(std::move(m_context), reuse, m_shared);
+  m_pool = nullptr;
+  m_context.reset();
 }
 
+CNfsConnection::CNfsConnection() = default;
+
 CNfsConnection::~CNfsConnection()
 {
   Deinit();
 }
 
-void CNfsConnection::resolveHost(const CURL& url)
+std::string CNfsConnection::resolveHost(const CURL& url)
 {
-  // resolve if hostname has changed
-  CServiceBroker::GetDNSNameCache()->Lookup(url.GetHostName(), m_resolvedHostName);
+  std::string resolvedHostName;
+  CServiceBroker::GetDNSNameCache()->Lookup(url.GetHostName(), resolvedHostName);
+  return resolvedHostName;
 }
 
 std::list<std::string> CNfsConnection::GetExportList(const CURL& url)
 {
   std::list<std::string> retList;
+  const std::string resolvedHostName = resolveHost(url);
 
   struct exportnode *exportlist, *tmp;
 #ifdef HAS_NFS_MOUNT_GETEXPORTS_TIMEOUT
   exportlist = mount_getexports_timeout(
-      m_resolvedHostName.c_str(),
+      resolvedHostName.c_str(),
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_nfsTimeout * 1000);
 #else
-  exportlist = mount_getexports(m_resolvedHostName.c_str());
+  exportlist = mount_getexports(resolvedHostName.c_str());
 #endif
 
   for (tmp = exportlist; tmp != NULL; tmp = tmp->ex_next)
@@ -109,137 +160,46 @@ std::list<std::string> CNfsConnection::GetExportList(const CURL& url)
   return retList;
 }
 
-void CNfsConnection::clearMembers()
-{
-    // NOTE - DON'T CLEAR m_exportList HERE!
-    // splitUrlIntoExportAndPath checks for m_exportList.empty()
-    // and would query the server in an excessive unwanted fashion
-    // also don't clear m_KeepAliveTimeouts here because we
-    // would loose any "paused" file handles during export change
-    m_exportPath.clear();
-    m_hostName.clear();
-    m_writeChunkSize = 0;
-    m_readChunkSize = 0;
-    m_pNfsContext = NULL;
-}
-
-void CNfsConnection::destroyOpenContexts()
-{
-  std::unique_lock lock(openContextLock);
-  for (auto& it : m_openContextMap)
-  {
-    nfs_destroy_context(it.second.pContext);
-  }
-  m_openContextMap.clear();
-}
-
-void CNfsConnection::destroyContext(const std::string &exportName)
-{
-  std::unique_lock lock(openContextLock);
-  tOpenContextMap::iterator it = m_openContextMap.find(exportName.c_str());
-  if (it != m_openContextMap.end())
-  {
-    nfs_destroy_context(it->second.pContext);
-    m_openContextMap.erase(it);
-  }
-}
-
-struct nfs_context *CNfsConnection::getContextFromMap(const std::string &exportname, bool forceCacheHit/* = false*/)
+bool CNfsConnection::splitUrlIntoExportAndPath(const CURL& url, std::string &exportPath, std::string &relativePath)
 {
-  struct nfs_context *pRet = NULL;
-  std::unique_lock lock(openContextLock);
+  const std::string hostName = StringUtils::ToLower(url.GetHostName());
 
-  tOpenContextMap::iterator it = m_openContextMap.find(exportname.c_str());
-  if (it != m_openContextMap.end())
+  std::list<std::string> exportList;
   {
-    //check if context has timed out already
-    auto now = std::chrono::steady_clock::now();
-    auto duration =
-        std::chrono::duration_cast<std::chrono::milliseconds>(now - it->second.lastAccessedTime);
-    if (duration < CONTEXT_TIMEOUT || forceCacheHit)
-    {
-      //its not timedout yet or caller wants the cached entry regardless of timeout
-      //refresh access time of that
-      //context and return it
-      if (!forceCacheHit) // only log it if this isn't the resetkeepalive on each read ;)
-        CLog::Log(LOGDEBUG, "NFS: Refreshing context for {}, old: {}, new: {}", exportname,
-                  it->second.lastAccessedTime.time_since_epoch().count(),
-                  now.time_since_epoch().count());
-      it->second.lastAccessedTime = now;
-      pRet = it->second.pContext;
-    }
-    else
-    {
-      //context is timed out
-      //destroy it and return NULL
-      CLog::Log(LOGDEBUG, "NFS: Old context timed out - destroying it");
-      nfs_destroy_context(it->second.pContext);
-      m_openContextMap.erase(it);
-    }
+    std::unique_lock lock(*this);
+    const auto it = m_exportLists.find(hostName);
+    if (it != m_exportLists.end())
+      exportList = it->second;
   }
-  return pRet;
-}
 
-CNfsConnection::ContextStatus CNfsConnection::getContextForExport(const std::string& exportname)
-{
-  CNfsConnection::ContextStatus ret = CNfsConnection::ContextStatus::INVALID;
-
-  clearMembers();
-
-  m_pNfsContext = getContextFromMap(exportname);
-
-  if(!m_pNfsContext)
+  //query the exportlist once per host, not while holding the pool lock
+  if (exportList.empty())
   {
-    CLog::Log(LOGDEBUG, "NFS: Context for {} not open - get a new context.", exportname);
-    m_pNfsContext = nfs_init_context();
-
-    if(!m_pNfsContext)
-    {
-      CLog::Log(LOGERROR,"NFS: Error initcontext in getContextForExport.");
-    }
-    else
+    exportList = QueryExportList(url);
+    if (!exportList.empty())
     {
-      struct contextTimeout tmp;
-      std::unique_lock lock(openContextLock);
-      setOptions(m_pNfsContext);
-      tmp.pContext = m_pNfsContext;
-      tmp.lastAccessedTime = std::chrono::steady_clock::now();
-      m_openContextMap[exportname] = tmp; //add context to list of all contexts
-      ret = CNfsConnection::ContextStatus::NEW;
+      std::unique_lock lock(*this);
+      m_exportLists[hostName] = exportList;
     }
   }
-  else
-  {
-    ret = CNfsConnection::ContextStatus::CACHED;
-    CLog::Log(LOGDEBUG,"NFS: Using cached context.");
-  }
-  m_lastAccessedTime = std::chrono::steady_clock::now();
 
-  return ret;
+  return splitUrlIntoExportAndPath(url, exportPath, relativePath, exportList);
 }
 
-bool CNfsConnection::splitUrlIntoExportAndPath(const CURL& url, std::string &exportPath, std::string &relativePath)
+std::list<std::string> CNfsConnection::QueryExportList(const CURL& url)
 {
-  //refresh exportlist if empty or hostname change
-  if(m_exportList.empty() || !StringUtils::EqualsNoCase(url.GetHostName(), m_hostName))
-  {
-    const auto settingsComponent = CServiceBroker::GetSettingsComponent();
-    if (!settingsComponent)
-      return false;
-
-    const auto settings = settingsComponent->GetSettings();
-    if (!settings)
-      return false;
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (!settingsComponent)
+    return {};
 
-    const int nfsVersion = settings->GetInt(SETTING_NFS_VERSION);
+  const auto settings = settingsComponent->GetSettings();
+  if (!settings)
+    return {};
 
-    if (nfsVersion == 4)
-      m_exportList = {"/"};
-    else
-      m_exportList = GetExportList(url);
-  }
+  if (settings->GetInt(SETTING_NFS_VERSION) == 4)
+    return {"/"};
 
-  return splitUrlIntoExportAndPath(url, exportPath, relativePath, m_exportList);
+  return GetExportList(url);
 }
 
 bool CNfsConnection::splitUrlIntoExportAndPath(const CURL& url,std::string &exportPath, std::string &relativePath, std::list<std::string> &exportList)
@@ -291,142 +251,319 @@ bool CNfsConnection::splitUrlIntoExportAndPath(const CURL& url,std::string &expo
     return ret;
 }
 
-bool CNfsConnection::Connect(const CURL& url, std::string &relativePath)
+CNfsConnection::CLease CNfsConnection::Acquire(const CURL& url, std::string& relativePath)
 {
-  std::unique_lock lock(*this);
-  int nfsRet = 0;
   std::string exportPath;
+  if (!splitUrlIntoExportAndPath(url, exportPath, relativePath))
+    return {};
 
-  resolveHost(url);
-  bool ret = splitUrlIntoExportAndPath(url, exportPath, relativePath);
+  const std::string id = url.GetHostName() + exportPath;
+  const unsigned int maxContexts = GetMaxContexts();
 
-  auto now = std::chrono::steady_clock::now();
-  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastAccessedTime);
+  std::unique_lock<CCriticalSection> lock(*this);
+  Pool& pool = m_pools[id];
 
-  if ((ret && (exportPath != m_exportPath || url.GetHostName() != m_hostName)) ||
-      duration > CONTEXT_TIMEOUT)
+  // a thread holding a context already mustn't wait for others, they may wait for it
+  if (pool.idle.empty() && pool.inUse >= maxContexts && !IsHeldByCurrentThread(id))
   {
-    CNfsConnection::ContextStatus contextRet = getContextForExport(url.GetHostName() + exportPath);
-
-    // we need a new context because sharename or hostname has changed
-    if (contextRet == CNfsConnection::ContextStatus::INVALID)
+    ++m_stats.waits;
+    if (!m_released.wait(lock, POOL_WAIT_TIMEOUT, [&pool, maxContexts]()
+                         { return !pool.idle.empty() || pool.inUse < maxContexts; }))
     {
-      return false;
+      ++m_stats.overflows;
+      CLog::Log(LOGDEBUG, "NFS: All {} contexts for {} are busy - get another one", pool.inUse,
+                id);
     }
+  }
 
-    // new context was created - we need to mount it
-    if (contextRet == CNfsConnection::ContextStatus::NEW)
-    {
-      //we connect to the directory of the path. This will be the "root" path of this connection then.
-      //So all fileoperations are relative to this mountpoint...
-      nfsRet = nfs_mount(m_pNfsContext, m_resolvedHostName.c_str(), exportPath.c_str());
+  const auto now = std::chrono::steady_clock::now();
+  while (!pool.idle.empty())
+  {
+    std::shared_ptr<CNfsContext> context = std::move(pool.idle.front());
+    pool.idle.pop_front();
 
-      if(nfsRet != 0)
-      {
-        CLog::Log(LOGERROR, "NFS: Failed to mount nfs share: {} ({})", exportPath,
-                  nfs_get_error(m_pNfsContext));
-        destroyContext(url.GetHostName() + exportPath);
-        return false;
-      }
-      CLog::Log(LOGDEBUG, "NFS: Connected to server {} and export {}", url.GetHostName(),
-                exportPath);
+    // the server may have dropped the session of a context idle for too long
+    if (now - context->m_lastAccessedTime >= CONTEXT_TIMEOUT)
+    {
+      CLog::Log(LOGDEBUG, "NFS: Old context for {} timed out - destroying it", id);
+      ++m_stats.evicted;
+      continue;
     }
-    m_exportPath = exportPath;
-    m_hostName = url.GetHostName();
 
-    // read chunksize only works after mount
-    m_readChunkSize = nfs_get_readmax(m_pNfsContext);
-    m_writeChunkSize = nfs_get_writemax(m_pNfsContext);
+    ++m_stats.reused;
+    ++pool.inUse;
+    context->m_owner = std::this_thread::get_id();
+    m_leased.emplace_back(context);
+    return CLease(*this, std::move(context));
+  }
 
-    const auto settings = CServiceBroker::GetSettingsComponent()->GetSettings();
-    const uint64_t chunkSize =
-        settings ? (settings->GetInt(SETTING_NFS_CHUNKSIZE) * 1024) : (128 * 1024);
+  // reserve the slot while mounting, which is done without holding the lock
+  ++pool.inUse;
+  const unsigned int generation = m_generation;
+  lock.unlock();
 
-    if (m_readChunkSize == 0)
-    {
-      CLog::Log(LOGDEBUG, "NFS Server did not return max read chunksize - Using setting value {}",
-                chunkSize);
-      m_readChunkSize = chunkSize;
-    }
-    else if (chunkSize < m_readChunkSize)
-    {
-      CLog::Log(LOGDEBUG,
-                "NFS Server max read chunksize ({}) is bigger than client setting - Using client "
-                "value {}",
-                m_readChunkSize, chunkSize);
-      m_readChunkSize = chunkSize;
-    }
+  std::shared_ptr<CNfsContext> context = CreateContext(id, url, exportPath);
 
-    if (m_writeChunkSize == 0)
-    {
-      CLog::Log(LOGDEBUG, "NFS Server did not return max write chunksize - Using setting value {}",
-                chunkSize);
-      m_writeChunkSize = chunkSize;
-    }
-    else if (chunkSize < m_writeChunkSize)
+  lock.lock();
+  if (!context)
+  {
+    ++m_stats.failures;
+    --pool.inUse;
+    m_released.notifyAll();
+    return {};
+  }
+
+  ++m_stats.created;
+  context->m_generation = generation;
+  context->m_owner = std::this_thread::get_id();
+  m_leased.emplace_back(context);
+  return CLease(*this, std::move(context));
+}
+
+CNfsConnection::CLease CNfsConnection::AcquireShared(const CURL& url, std::string& relativePath)
+{
+  std::string exportPath;
+  if (!splitUrlIntoExportAndPath(url, exportPath, relativePath))
+    return {};
+
+  const std::string id = url.GetHostName() + exportPath;
+
+  std::unique_lock<CCriticalSection> lock(*this);
+  Pool& pool = m_pools[id];
+
+  // files keep their context alive, the server may have dropped the session of an unused one
+  const std::shared_ptr<CNfsContext> current = pool.shared;
+  const auto now = std::chrono::steady_clock::now();
+  if (current && (current.use_count() > 2 || now - current->m_lastAccessedTime < CONTEXT_TIMEOUT))
+  {
+    ++m_stats.reused;
+    return CLease(*this, current, true);
+  }
+
+  const unsigned int generation = m_generation;
+  lock.unlock();
+
+  std::shared_ptr<CNfsContext> context = CreateContext(id, url, exportPath);
+
+  lock.lock();
+  if (!context)
+  {
+    ++m_stats.failures;
+    return {};
+  }
+
+  ++m_stats.created;
+  context->m_generation = generation;
+
+  // another file may have mounted one meanwhile
+  if (pool.shared != current && pool.shared)
+    return CLease(*this, pool.shared, true);
+
+  if (generation == m_generation)
+    pool.shared = context;
+
+  return CLease(*this, std::move(context), true);
+}
+
+void CNfsConnection::Release(std::shared_ptr<CNfsContext> context, bool reuse, bool shared)
+{
+  std::unique_lock lock(*this);
+
+  if (shared)
+  {
+    // the context is destroyed with the last file using it
+    Pool& pool = m_pools[context->GetId()];
+    if (pool.shared == context)
     {
-      CLog::Log(LOGDEBUG,
-                "NFS Server max write chunksize ({}) is bigger than client setting - Using client "
-                "value {}",
-                m_writeChunkSize, chunkSize);
-      m_writeChunkSize = chunkSize;
+      if (reuse)
+        context->m_lastAccessedTime = std::chrono::steady_clock::now();
+      else
+        pool.shared.reset();
     }
+    return;
+  }
+
+  const auto it = std::ranges::find(m_leased, context);
+  if (it != m_leased.end())
+    m_leased.erase(it);
+
+  Pool& pool = m_pools[context->GetId()];
+  --pool.inUse;
+  context->m_owner = {};
+
+  // contexts beyond the limit, e.g. of waits which timed out, aren't kept
+  if (reuse && context->m_generation == m_generation &&
+      pool.inUse + pool.idle.size() < GetMaxContexts())
+  {
+    context->m_lastAccessedTime = std::chrono::steady_clock::now();
+    pool.idle.emplace_front(std::move(context));
+  }
+  m_released.notifyAll();
+}
+
+std::shared_ptr<CNfsContext> CNfsConnection::CreateContext(const std::string& id,
+                                                           const CURL& url,
+                                                           const std::string& exportPath)
+{
+  CLog::Log(LOGDEBUG, "NFS: Context for {} not open - get a new context.", id);
+
+  const std::string resolvedHostName = resolveHost(url);
+
+  struct nfs_context* nfsContext = nfs_init_context();
+  if (!nfsContext)
+  {
+    CLog::Log(LOGERROR, "NFS: Error initcontext in CreateContext.");
+    return nullptr;
+  }
+  setOptions(nfsContext);
+
+  //we connect to the directory of the path. This will be the "root" path of this connection then.
+  //So all fileoperations are relative to this mountpoint...
+  const int nfsRet = nfs_mount(nfsContext, resolvedHostName.c_str(), exportPath.c_str());
+  if (nfsRet != 0)
+  {
+    CLog::Log(LOGERROR, "NFS: Failed to mount nfs share: {} ({})", exportPath,
+              nfs_get_error(nfsContext));
+    nfs_destroy_context(nfsContext);
+    return nullptr;
+  }
+  CLog::Log(LOGDEBUG, "NFS: Connected to {}", id);
+
+  auto context = std::make_shared<CNfsContext>(nfsContext, id, resolvedHostName, exportPath);
+
+  // read chunksize only works after mount
+  context->m_readChunkSize = nfs_get_readmax(nfsContext);
+  context->m_writeChunkSize = nfs_get_writemax(nfsContext);
+
+  const auto settings = CServiceBroker::GetSettingsComponent()->GetSettings();
+  const uint64_t chunkSize =
+      settings ? (settings->GetInt(SETTING_NFS_CHUNKSIZE) * 1024) : (128 * 1024);
+
+  if (context->m_readChunkSize == 0)
+  {
+    CLog::Log(LOGDEBUG, "NFS Server did not return max read chunksize - Using setting value {}",
+              chunkSize);
+    context->m_readChunkSize = chunkSize;
+  }
+  else if (chunkSize < context->m_readChunkSize)
+  {
+    CLog::Log(LOGDEBUG,
+              "NFS Server max read chunksize ({}) is bigger than client setting - Using client "
+              "value {}",
+              context->m_readChunkSize, chunkSize);
+    context->m_readChunkSize = chunkSize;
+  }
+
+  if (context->m_writeChunkSize == 0)
+  {
+    CLog::Log(LOGDEBUG, "NFS Server did not return max write chunksize - Using setting value {}",
+              chunkSize);
+    context->m_writeChunkSize = chunkSize;
+  }
+  else if (chunkSize < context->m_writeChunkSize)
+  {
+    CLog::Log(LOGDEBUG,
+              "NFS Server max write chunksize ({}) is bigger than client setting - Using client "
+              "value {}",
+              context->m_writeChunkSize, chunkSize);
+    context->m_writeChunkSize = chunkSize;
+  }
+
+  CLog::Log(LOGDEBUG, "NFS: chunks: r/w {}/{}", context->m_readChunkSize,
+            context->m_writeChunkSize);
+
+  return context;
+}
+
+bool CNfsConnection::IsHeldByCurrentThread(const std::string& id) const
+{
+  const std::thread::id thread = std::this_thread::get_id();
+  return std::ranges::any_of(m_leased, [&id, thread](const auto& context)
+                             { return context->m_owner == thread && context->GetId() == id; });
+}
+
+unsigned int CNfsConnection::GetMaxContexts() const
+{
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (!settingsComponent || !settingsComponent->GetAdvancedSettings())
+    return DEFAULT_MAX_CONTEXTS;
+
+  return std::max(settingsComponent->GetAdvancedSettings()->m_nfsMaxConnections, 1u);
+}
+
+void CNfsConnection::EvictIdle(std::chrono::steady_clock::duration maxIdle)
+{
+  const auto now = std::chrono::steady_clock::now();
+  size_t evicted = 0;
+  for (auto& [id, pool] : m_pools)
+  {
+    evicted += std::erase_if(pool.idle, [now, maxIdle](const auto& context)
+                             { return now - context->m_lastAccessedTime >= maxIdle; });
 
-    if (contextRet == CNfsConnection::ContextStatus::NEW)
+    // a shared context no file uses anymore
+    if (pool.shared && pool.shared.use_count() == 1 &&
+        now - pool.shared->m_lastAccessedTime >= maxIdle)
     {
-      CLog::Log(LOGDEBUG, "NFS: chunks: r/w {}/{}", (int)m_readChunkSize, (int)m_writeChunkSize);
+      pool.shared.reset();
+      ++evicted;
     }
   }
-  return ret;
+
+  if (evicted > 0)
+  {
+    m_stats.evicted += evicted;
+    CLog::Log(LOGDEBUG,
+              "NFS: Closed {} idle contexts - {} created, {} reused, {} waits, {} overflows, {} "
+              "failed mounts so far",
+              evicted, m_stats.created, m_stats.reused, m_stats.waits, m_stats.overflows,
+              m_stats.failures);
+  }
 }
 
 void CNfsConnection::Deinit()
 {
-  if(m_pNfsContext)
   {
-    destroyOpenContexts();
-    m_pNfsContext = NULL;
+    std::unique_lock lock(*this);
+    // contexts still in use are destroyed once released
+    ++m_generation;
+    for (auto& [id, pool] : m_pools)
+    {
+      m_stats.evicted += pool.idle.size();
+      pool.idle.clear();
+      pool.shared.reset();
+    }
   }
-  clearMembers();
+
   // clear any keep alive timeouts on deinit
+  std::unique_lock lock(keepAliveLock);
   m_KeepAliveTimeouts.clear();
 }
 
 /* This is called from CApplication::ProcessSlow() and is used to tell if nfs have been idle for too long */
 void CNfsConnection::CheckIfIdle()
 {
-  /* We check if there are open connections. This is done without a lock to not halt the mainthread. It should be thread safe as
-   worst case scenario is that m_OpenConnections could read 0 and then changed to 1 if this happens it will enter the if which will lead to another check, which is locked.  */
-  if (m_OpenConnections == 0 && m_pNfsContext != NULL)
-  { /* I've set the the maximum IDLE time to be 1 min and 30 sec. */
+  {
     std::unique_lock lock(*this);
-    if (m_OpenConnections == 0 /* check again - when locked */)
-    {
-      const auto now = std::chrono::steady_clock::now();
-
-      if (m_IdleTimeout < now)
-      {
-        CLog::Log(LOGINFO, "NFS is idle. Closing the remaining connections.");
-        gNfsConnection.Deinit();
-      }
-    }
+    // close unused contexts fast when nothing is open anymore, otherwise before the server expires
+    // their session
+    if (m_OpenConnections == 0)
+      EvictIdle(IDLE_TIMEOUT);
+    else
+      EvictIdle(CONTEXT_TIMEOUT);
   }
 
-  if( m_pNfsContext != NULL )
-  {
-    std::unique_lock lock(keepAliveLock);
+  std::unique_lock lock(keepAliveLock);
 
-    const auto now = std::chrono::steady_clock::now();
+  const auto now = std::chrono::steady_clock::now();
 
-    //handle keep alive on opened files
-    for (auto& it : m_KeepAliveTimeouts)
+  //handle keep alive on opened files
+  for (auto& it : m_KeepAliveTimeouts)
+  {
+    if (it.second.refreshTime < now)
     {
-      if (it.second.refreshTime < now)
-      {
-        keepAlive(it.second.exportPath, it.first);
-        //reset timeout
-        resetKeepAlive(it.second.exportPath, it.first);
-      }
+      keepAlive(it.second.context, it.first);
+      //reset timeout
+      it.second.refreshTime = now + KEEP_ALIVE_TIMEOUT;
     }
   }
 }
@@ -439,45 +576,35 @@ void CNfsConnection::removeFromKeepAliveList(struct nfsfh  *_pFileHandle)
 }
 
 //reset timeouts on read
-void CNfsConnection::resetKeepAlive(const std::string& _exportPath, struct nfsfh* _pFileHandle)
+void CNfsConnection::resetKeepAlive(const std::shared_ptr<CNfsContext>& context,
+                                    struct nfsfh* _pFileHandle)
 {
   std::unique_lock lock(keepAliveLock);
-  //refresh last access time of the context aswell
-  struct nfs_context *pContext = getContextFromMap(_exportPath, true);
-
-  // if we keep alive using m_pNfsContext we need to mark
-  // its last access time too here
-  if (m_pNfsContext == pContext)
-  {
-    m_lastAccessedTime = std::chrono::steady_clock::now();
-  }
 
   //adds new keys - refreshes existing ones
-  m_KeepAliveTimeouts[_pFileHandle].exportPath = _exportPath;
-  m_KeepAliveTimeouts[_pFileHandle].refreshTime = m_lastAccessedTime + KEEP_ALIVE_TIMEOUT;
+  m_KeepAliveTimeouts[_pFileHandle].context = context;
+  m_KeepAliveTimeouts[_pFileHandle].refreshTime =
+      std::chrono::steady_clock::now() + KEEP_ALIVE_TIMEOUT;
 }
 
 //keep alive the filehandles nfs connection
 //by blindly doing a read 32bytes - seek back to where
 //we were before
-void CNfsConnection::keepAlive(const std::string& _exportPath, struct nfsfh* _pFileHandle)
+void CNfsConnection::keepAlive(const std::shared_ptr<CNfsContext>& context,
+                               struct nfsfh* _pFileHandle)
 {
+  // a file busy with an operation keeps its connection alive itself
+  std::unique_lock lock(*context, std::try_to_lock);
+  if (!lock.owns_lock())
+    return;
+
   uint64_t offset = 0;
   char buffer[32];
-  // this also refreshes the last accessed time for the context
-  // true forces a cachehit regardless the context is timedout
-  // on this call we are sure its not timedout even if the last accessed
-  // time suggests it.
-  struct nfs_context *pContext = getContextFromMap(_exportPath, true);
-
-  if (!pContext)// this should normally never happen - paranoia
-    pContext = m_pNfsContext;
+  struct nfs_context* pContext = context->Get();
 
   CLog::LogF(LOGDEBUG, "sending keep alive after {}s.",
              std::chrono::duration_cast<std::chrono::seconds>(KEEP_ALIVE_TIMEOUT).count());
 
-  std::unique_lock lock(*this);
-
   nfs_lseek(pContext, _pFileHandle, 0, SEEK_CUR, &offset);
 
 #ifdef LIBNFS_API_V2
@@ -494,45 +621,6 @@ void CNfsConnection::keepAlive(const std::string& _exportPath, struct nfsfh* _pF
   nfs_lseek(pContext, _pFileHandle, offset, SEEK_SET, &offset);
 }
 
-int CNfsConnection::stat(const CURL& url, nfs_stat_64* statbuff)
-{
-  std::unique_lock lock(*this);
-  int nfsRet = 0;
-  std::string exportPath;
-  std::string relativePath;
-  struct nfs_context *pTmpContext = NULL;
-
-  resolveHost(url);
-
-  if(splitUrlIntoExportAndPath(url, exportPath, relativePath))
-  {
-    pTmpContext = nfs_init_context();
-
-    if(pTmpContext)
-    {
-      setOptions(pTmpContext);
-      //we connect to the directory of the path. This will be the "root" path of this connection then.
-      //So all fileoperations are relative to this mountpoint...
-      nfsRet = nfs_mount(pTmpContext, m_resolvedHostName.c_str(), exportPath.c_str());
-
-      if(nfsRet == 0)
-      {
-        nfsRet = nfs_stat64(pTmpContext, relativePath.c_str(), statbuff);
-      }
-      else
-      {
-        CLog::Log(LOGERROR, "NFS: Failed to mount nfs share: {} ({})", exportPath,
-                  nfs_get_error(m_pNfsContext));
-      }
-
-      nfs_destroy_context(pTmpContext);
-      CLog::Log(LOGDEBUG, "NFS: Connected to server {} and export {} in tmpContext",
-                url.GetHostName(), exportPath);
-    }
-  }
-  return nfsRet;
-}
-
 /* The following two function is used to keep track on how many Opened files/directories there are.
 needed for unloading the dylib*/
 void CNfsConnection::AddActiveConnection()
@@ -545,12 +633,21 @@ void CNfsConnection::AddIdleConnection()
 {
   std::unique_lock lock(*this);
   m_OpenConnections--;
-  /* If we close a file we reset the idle timer so that we don't have any weird behaviours if a user
-   leaves the movie paused for a long while and then press stop */
-  const auto now = std::chrono::steady_clock::now();
-  m_IdleTimeout = now + IDLE_TIMEOUT;
 }
 
+CNfsConnection::PoolStats CNfsConnection::GetPoolStats()
+{
+  std::unique_lock lock(*this);
+  PoolStats stats = m_stats;
+  for (const auto& [id, pool] : m_pools)
+  {
+    stats.inUse += pool.inUse;
+    stats.idle += static_cast<unsigned int>(pool.idle.size());
+    if (pool.shared)
+      ++stats.shared;
+  }
+  return stats;
+}
 
 void CNfsConnection::setOptions(struct nfs_context* context)
 {
@@ -589,7 +686,6 @@ CNfsConnection gNfsConnection;
 
 CNFSFile::CNFSFile()
 : m_pFileHandle(NULL)
-, m_pNfsContext(NULL)
 {
   gNfsConnection.AddActiveConnection();
 }
@@ -604,15 +700,15 @@ int64_t CNFSFile::GetPosition()
 {
   int ret = 0;
   uint64_t offset = 0;
-  std::unique_lock lock(gNfsConnection);
 
-  if (gNfsConnection.GetNfsContext() == NULL || m_pFileHandle == NULL) return 0;
+  if (!m_context || m_pFileHandle == NULL) return 0;
 
-  ret = nfs_lseek(gNfsConnection.GetNfsContext(), m_pFileHandle, 0, SEEK_CUR, &offset);
+  std::unique_lock lock(*m_context);
+  ret = nfs_lseek(m_context->Get(), m_pFileHandle, 0, SEEK_CUR, &offset);
 
   if (ret < 0)
   {
-    CLog::Log(LOGERROR, "NFS: Failed to lseek({})", nfs_get_error(gNfsConnection.GetNfsContext()));
+    CLog::Log(LOGERROR, "NFS: Failed to lseek({})", nfs_get_error(m_context->Get()));
   }
   return offset;
 }
@@ -623,6 +719,11 @@ int64_t CNFSFile::GetLength()
   return m_fileSize;
 }
 
+int CNFSFile::GetChunkSize()
+{
+  return m_context ? static_cast<int>(m_context->GetMaxReadChunkSize()) : 0;
+}
+
 bool CNFSFile::Open(const CURL& url)
 {
   Close();
@@ -636,37 +737,40 @@ bool CNFSFile::Open(const CURL& url)
 
   std::string filename;
 
-  std::unique_lock lock(gNfsConnection);
-
-  if (!gNfsConnection.Connect(url, filename))
+  m_context = gNfsConnection.AcquireShared(url, filename);
+  if (!m_context)
     return false;
 
-  m_pNfsContext = gNfsConnection.GetNfsContext();
-  m_exportPath = gNfsConnection.GetContextMapId();
-
-  int ret = nfs_open(m_pNfsContext, filename.c_str(), O_RDONLY, &m_pFileHandle);
+  std::unique_lock lock(*m_context);
+  int ret = nfs_open(m_context->Get(), filename.c_str(), O_RDONLY, &m_pFileHandle);
 
   if (ret == NFS4ERR_EXPIRED) // client session expired due no activity/keep alive
   {
     CLog::Log(LOGERROR,
               "CNFSFile::Open: Unable to open file - trying again with a new context: error: '{}'",
-              nfs_get_error(m_pNfsContext));
+              nfs_get_error(m_context->Get()));
+
+    lock.unlock();
+    m_context.Release(false);
+    m_context = gNfsConnection.AcquireShared(url, filename);
+    if (!m_context)
+      return false;
 
-    gNfsConnection.Deinit();
-    m_pNfsContext = gNfsConnection.GetNfsContext();
-    m_exportPath = gNfsConnection.GetContextMapId();
-    ret = nfs_open(m_pNfsContext, filename.c_str(), O_RDONLY, &m_pFileHandle);
+    lock = std::unique_lock(*m_context);
+    ret = nfs_open(m_context->Get(), filename.c_str(), O_RDONLY, &m_pFileHandle);
   }
 
   if (ret != 0)
   {
     CLog::Log(LOGERROR, "CNFSFile::Open: Unable to open file: '{}' error: '{}'", url.GetFileName(),
-              nfs_get_error(m_pNfsContext));
+              nfs_get_error(m_context->Get()));
 
-    m_pNfsContext = nullptr;
-    m_exportPath.clear();
+    lock.unlock();
+    m_pFileHandle = NULL;
+    m_context.Release();
     return false;
   }
+  lock.unlock();
 
   CLog::Log(LOGDEBUG, "CNFSFile::Open - opened {}", url.GetFileName());
   m_url=url;
@@ -695,49 +799,69 @@ bool CNFSFile::Exists(const CURL& url)
   return Stat(url,NULL) == 0;
 }
 
-int CNFSFile::Stat(struct __stat64* buffer)
+namespace
 {
-  return Stat(m_url,buffer);
+void ToStat(const nfs_stat_64& nfsBuffer, struct __stat64* buffer)
+{
+  *buffer = {};
+  buffer->st_dev = nfsBuffer.nfs_dev;
+  buffer->st_ino = nfsBuffer.nfs_ino;
+  buffer->st_mode = nfsBuffer.nfs_mode;
+  buffer->st_nlink = nfsBuffer.nfs_nlink;
+  buffer->st_uid = nfsBuffer.nfs_uid;
+  buffer->st_gid = nfsBuffer.nfs_gid;
+  buffer->st_rdev = nfsBuffer.nfs_rdev;
+  buffer->st_size = nfsBuffer.nfs_size;
+  buffer->st_atime = nfsBuffer.nfs_atime;
+  buffer->st_mtime = nfsBuffer.nfs_mtime;
+  buffer->st_ctime = nfsBuffer.nfs_ctime;
 }
+} // unnamed namespace
+
+int CNFSFile::Stat(struct __stat64* buffer)
+{
+  if (m_pFileHandle == NULL || !m_context)
+    return Stat(m_url, buffer);
+
+  // stat the open file with its own context instead of leasing another one
+  nfs_stat_64 tmpBuffer = {};
+  std::unique_lock lock(*m_context);
+  if (nfs_fstat64(m_context->Get(), m_pFileHandle, &tmpBuffer) != 0)
+  {
+    CLog::Log(LOGERROR, "NFS: Failed to stat({}) {}", m_url.GetFileName(),
+              nfs_get_error(m_context->Get()));
+    return -1;
+  }
 
+  if (buffer)
+    ToStat(tmpBuffer, buffer);
+  return 0;
+}
 
 int CNFSFile::Stat(const CURL& url, struct __stat64* buffer)
 {
   int ret = 0;
-  std::unique_lock lock(gNfsConnection);
   std::string filename;
 
-  if(!gNfsConnection.Connect(url,filename))
+  CNfsConnection::CLease context = gNfsConnection.Acquire(url, filename);
+  if (!context)
     return -1;
 
   nfs_stat_64 tmpBuffer = {};
 
-  ret = nfs_stat64(gNfsConnection.GetNfsContext(), filename.c_str(), &tmpBuffer);
+  ret = nfs_stat64(context->Get(), filename.c_str(), &tmpBuffer);
 
   //if buffer == NULL we where called from Exists - in that case don't spam the log with errors
   if (ret != 0 && buffer != NULL)
   {
     CLog::Log(LOGERROR, "NFS: Failed to stat({}) {}", url.GetFileName(),
-              nfs_get_error(gNfsConnection.GetNfsContext()));
+              nfs_get_error(context->Get()));
     ret = -1;
   }
   else
   {
     if (buffer)
-    {
-      *buffer = {};
-      buffer->st_dev = tmpBuffer.nfs_dev;
-      buffer->st_ino = tmpBuffer.nfs_ino;
-      buffer->st_mode = tmpBuffer.nfs_mode;
-      buffer->st_nlink = tmpBuffer.nfs_nlink;
-      buffer->st_uid = tmpBuffer.nfs_uid;
-      buffer->st_gid = tmpBuffer.nfs_gid;
-      buffer->st_rdev = tmpBuffer.nfs_rdev;
-      buffer->st_size = tmpBuffer.nfs_size;
-      buffer->st_atime = tmpBuffer.nfs_atime;
-      buffer->st_mtime = tmpBuffer.nfs_mtime;
-      buffer->st_ctime = tmpBuffer.nfs_ctime;
-    }
+      ToStat(tmpBuffer, buffer);
   }
   return ret;
 }
@@ -748,24 +872,25 @@ ssize_t CNFSFile::Read(void *lpBuf, size_t uiBufSize)
     uiBufSize = SSIZE_MAX;
 
   ssize_t numberOfBytesRead = 0;
-  std::unique_lock lock(gNfsConnection);
 
-  if (m_pFileHandle == NULL || m_pNfsContext == NULL )
+  if (m_pFileHandle == NULL || !m_context)
     return -1;
+
+  std::unique_lock lock(*m_context);
 #ifdef LIBNFS_API_V2
-  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, lpBuf, uiBufSize);
+  numberOfBytesRead = nfs_read(m_context->Get(), m_pFileHandle, lpBuf, uiBufSize);
 #else
-  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, uiBufSize, (char *)lpBuf);
+  numberOfBytesRead = nfs_read(m_context->Get(), m_pFileHandle, uiBufSize, (char *)lpBuf);
 #endif
 
-  lock.unlock(); //no need to keep the connection lock after that
-
-  gNfsConnection.resetKeepAlive(m_exportPath, m_pFileHandle);//triggers keep alive timer reset for this filehandle
-
   //something went wrong ...
   if (numberOfBytesRead < 0)
     CLog::Log(LOGERROR, "{} - Error( {}, {} )", __FUNCTION__, (int64_t)numberOfBytesRead,
-              nfs_get_error(m_pNfsContext));
+              nfs_get_error(m_context->Get()));
+
+  lock.unlock(); //no need to keep the context lock after that
+
+  gNfsConnection.resetKeepAlive(m_context.Get(), m_pFileHandle);//triggers keep alive timer reset for this filehandle
 
   return numberOfBytesRead;
 }
@@ -775,15 +900,14 @@ int64_t CNFSFile::Seek(int64_t iFilePosition, int iWhence)
   int ret = 0;
   uint64_t offset = 0;
 
-  std::unique_lock lock(gNfsConnection);
-  if (m_pFileHandle == NULL || m_pNfsContext == NULL) return -1;
+  if (m_pFileHandle == NULL || !m_context) return -1;
 
-
-  ret = nfs_lseek(m_pNfsContext, m_pFileHandle, iFilePosition, iWhence, &offset);
+  std::unique_lock lock(*m_context);
+  ret = nfs_lseek(m_context->Get(), m_pFileHandle, iFilePosition, iWhence, &offset);
   if (ret < 0)
   {
     CLog::Log(LOGERROR, "{} - Error( seekpos: {}, whence: {}, fsize: {}, {})", __FUNCTION__,
-              iFilePosition, iWhence, m_fileSize, nfs_get_error(m_pNfsContext));
+              iFilePosition, iWhence, m_fileSize, nfs_get_error(m_context->Get()));
     return -1;
   }
   return (int64_t)offset;
@@ -793,15 +917,14 @@ int CNFSFile::Truncate(int64_t iSize)
 {
   int ret = 0;
 
-  std::unique_lock lock(gNfsConnection);
-  if (m_pFileHandle == NULL || m_pNfsContext == NULL) return -1;
-
+  if (m_pFileHandle == NULL || !m_context) return -1;
 
-  ret = nfs_ftruncate(m_pNfsContext, m_pFileHandle, iSize);
+  std::unique_lock lock(*m_context);
+  ret = nfs_ftruncate(m_context->Get(), m_pFileHandle, iSize);
   if (ret < 0)
   {
     CLog::Log(LOGERROR, "{} - Error( ftruncate: {}, fsize: {}, {})", __FUNCTION__, iSize,
-              m_fileSize, nfs_get_error(m_pNfsContext));
+              m_fileSize, nfs_get_error(m_context->Get()));
     return -1;
   }
   return ret;
@@ -809,27 +932,28 @@ int CNFSFile::Truncate(int64_t iSize)
 
 void CNFSFile::Close()
 {
-  std::unique_lock lock(gNfsConnection);
-
-  if (m_pFileHandle != NULL && m_pNfsContext != NULL)
+  if (m_pFileHandle != NULL && m_context)
   {
     int ret = 0;
     CLog::Log(LOGDEBUG, "CNFSFile::Close closing file {}", m_url.GetFileName());
     // remove it from keep alive list before closing
     // so keep alive code doesn't process it anymore
     gNfsConnection.removeFromKeepAliveList(m_pFileHandle);
-    ret = nfs_close(m_pNfsContext, m_pFileHandle);
+
+    std::unique_lock lock(*m_context);
+    ret = nfs_close(m_context->Get(), m_pFileHandle);
 
 	  if (ret < 0)
     {
       CLog::Log(LOGERROR, "Failed to close({}) - {}", m_url.GetFileName(),
-                nfs_get_error(m_pNfsContext));
+                nfs_get_error(m_context->Get()));
     }
     m_pFileHandle = NULL;
-    m_pNfsContext = NULL;
     m_fileSize = 0;
-    m_exportPath.clear();
   }
+
+  // the context is free for other files and operations now
+  m_context.Release();
 }
 
 //this was a bitch!
@@ -840,12 +964,13 @@ ssize_t CNFSFile::Write(const void* lpBuf, size_t uiBufSize)
   size_t numberOfBytesWritten = 0;
   int writtenBytes = 0;
   size_t leftBytes = uiBufSize;
-  //clamp max write chunksize to 32kb - fixme - this might be superfluous with future libnfs versions
-  size_t chunkSize = gNfsConnection.GetMaxWriteChunkSize() > 32768 ? 32768 : (size_t)gNfsConnection.GetMaxWriteChunkSize();
 
-  std::unique_lock lock(gNfsConnection);
+  if (m_pFileHandle == NULL || !m_context) return -1;
 
-  if (m_pFileHandle == NULL || m_pNfsContext == NULL) return -1;
+  //clamp max write chunksize to 32kb - fixme - this might be superfluous with future libnfs versions
+  size_t chunkSize = m_context->GetMaxWriteChunkSize() > 32768 ? 32768 : (size_t)m_context->GetMaxWriteChunkSize();
+
+  std::unique_lock lock(*m_context);
 
   //write as long as some bytes are left to be written
   while( leftBytes )
@@ -856,12 +981,12 @@ ssize_t CNFSFile::Write(const void* lpBuf, size_t uiBufSize)
       chunkSize = leftBytes;//write last chunk with correct size
     }
 #ifdef LIBNFS_API_V2
-    writtenBytes = nfs_write(m_pNfsContext, m_pFileHandle,
+    writtenBytes = nfs_write(m_context->Get(), m_pFileHandle,
                              static_cast<const char*>(lpBuf) + numberOfBytesWritten, chunkSize);
 #else
     //write chunk
     //! @bug libnfs < 2.0.0 isn't const correct
-    writtenBytes = nfs_write(m_pNfsContext,
+    writtenBytes = nfs_write(m_context->Get(),
                                   m_pFileHandle,
                                   chunkSize,
                                   const_cast<char*>((const char *)lpBuf) + numberOfBytesWritten);
@@ -875,7 +1000,7 @@ ssize_t CNFSFile::Write(const void* lpBuf, size_t uiBufSize)
     if (writtenBytes < 0)
     {
       CLog::Log(LOGERROR, "Failed to pwrite({}) {}", m_url.GetFileName(),
-                nfs_get_error(m_pNfsContext));
+                nfs_get_error(m_context->Get()));
       if (numberOfBytesWritten == 0)
         return -1;
 
@@ -889,19 +1014,17 @@ ssize_t CNFSFile::Write(const void* lpBuf, size_t uiBufSize)
 bool CNFSFile::Delete(const CURL& url)
 {
   int ret = 0;
-  std::unique_lock lock(gNfsConnection);
   std::string filename;
 
-  if(!gNfsConnection.Connect(url, filename))
+  CNfsConnection::CLease context = gNfsConnection.Acquire(url, filename);
+  if (!context)
     return false;
 
-
-  ret = nfs_unlink(gNfsConnection.GetNfsContext(), filename.c_str());
+  ret = nfs_unlink(context->Get(), filename.c_str());
 
   if(ret != 0)
   {
-    CLog::Log(LOGERROR, "{} - Error( {} )", __FUNCTION__,
-              nfs_get_error(gNfsConnection.GetNfsContext()));
+    CLog::Log(LOGERROR, "{} - Error( {} )", __FUNCTION__, nfs_get_error(context->Get()));
   }
   return (ret == 0);
 }
@@ -909,22 +1032,21 @@ bool CNFSFile::Delete(const CURL& url)
 bool CNFSFile::Rename(const CURL& url, const CURL& urlnew)
 {
   int ret = 0;
-  std::unique_lock lock(gNfsConnection);
   std::string strFile;
 
-  if(!gNfsConnection.Connect(url,strFile))
+  CNfsConnection::CLease context = gNfsConnection.Acquire(url, strFile);
+  if (!context)
     return false;
 
   std::string strFileNew;
   std::string strDummy;
   gNfsConnection.splitUrlIntoExportAndPath(urlnew, strDummy, strFileNew);
 
-  ret = nfs_rename(gNfsConnection.GetNfsContext() , strFile.c_str(), strFileNew.c_str());
+  ret = nfs_rename(context->Get(), strFile.c_str(), strFileNew.c_str());
 
   if(ret != 0)
   {
-    CLog::Log(LOGERROR, "{} - Error( {} )", __FUNCTION__,
-              nfs_get_error(gNfsConnection.GetNfsContext()));
+    CLog::Log(LOGERROR, "{} - Error( {} )", __FUNCTION__, nfs_get_error(context->Get()));
   }
   return (ret == 0);
 }
@@ -937,15 +1059,12 @@ bool CNFSFile::OpenForWrite(const CURL& url, bool bOverWrite)
   if (!IsValidFile(url.GetFileName())) return false;
 
   Close();
-  std::unique_lock lock(gNfsConnection);
   std::string filename;
 
-  if(!gNfsConnection.Connect(url,filename))
+  m_context = gNfsConnection.AcquireShared(url, filename);
+  if (!m_context)
     return false;
 
-  m_pNfsContext = gNfsConnection.GetNfsContext();
-  m_exportPath = gNfsConnection.GetContextMapId();
-
   if (bOverWrite)
   {
     CLog::Log(LOGWARNING, "FileNFS::OpenForWrite() called with overwriting enabled! - {}",
@@ -955,15 +1074,18 @@ bool CNFSFile::OpenForWrite(const CURL& url, bool bOverWrite)
   // nfs_open2 handles both creation and open atomically;
   const int flags = bOverWrite ? O_CREAT | O_RDWR | O_EXCL : O_RDWR;
   const int mode = bOverWrite ? S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH : 0;
-  ret = nfs_open2(m_pNfsContext, filename.c_str(), flags, mode, &m_pFileHandle);
+  {
+    std::unique_lock lock(*m_context);
+    ret = nfs_open2(m_context->Get(), filename.c_str(), flags, mode, &m_pFileHandle);
+  }
 
   if (ret || m_pFileHandle == NULL)
   {
     // write error to logfile
     CLog::Log(LOGERROR, "CNFSFile::Open: Unable to open file : '{}' error : '{}'", filename,
-              nfs_get_error(gNfsConnection.GetNfsContext()));
-    m_pNfsContext = NULL;
-    m_exportPath.clear();
+              nfs_get_error(m_context->Get()));
+    m_pFileHandle = NULL;
+    m_context.Release();
     return false;
   }
   m_url=url;
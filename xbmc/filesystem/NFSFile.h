@@ -12,95 +12,189 @@
 
 #include "IFile.h"
 #include "URL.h"
+#include "threads/Condition.h"
 #include "threads/CriticalSection.h"
 
 #include <chrono>
 #include <list>
 #include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
+struct nfs_context;
 struct nfs_stat_64;
+struct nfsfh;
 
+/*!
+ \brief Mounted NFS context, used by one file or operation at a time.
+ Open files hold the lock while calling into libnfs, as their keep alive runs on another thread.
+ */
+class CNfsContext : public CCriticalSection
+{
+public:
+  CNfsContext(struct nfs_context* context, std::string id, std::string resolvedHostName,
+              std::string exportPath);
+  ~CNfsContext();
+
+  struct nfs_context* Get() const { return m_context; }
+  const std::string& GetId() const { return m_id; }
+  const std::string& GetResolvedHostName() const { return m_resolvedHostName; }
+  const std::string& GetExportPath() const { return m_exportPath; }
+  uint64_t GetMaxReadChunkSize() const { return m_readChunkSize; }
+  uint64_t GetMaxWriteChunkSize() const { return m_writeChunkSize; }
+
+private:
+  friend class CNfsConnection;
+
+  struct nfs_context* m_context;
+  const std::string m_id; // host name + export path
+  const std::string m_resolvedHostName;
+  const std::string m_exportPath;
+  uint64_t m_readChunkSize = 0;
+  uint64_t m_writeChunkSize = 0;
+  std::chrono::time_point<std::chrono::steady_clock> m_lastAccessedTime;
+  std::thread::id m_owner;
+  unsigned int m_generation = 0;
+};
+
+/*!
+ \brief Pool of mounted contexts per server and export.
+
+ Contexts are leased for exclusive use, so directory operations of different threads don't
+ serialize on a single context. Released contexts are kept mounted for reuse until they're idle for
+ too long, and the number of contexts in use per export is bounded to avoid flooding the server
+ with mounts when many threads access it at once.
+
+ Open files share a context per export instead, locking it for each call. They stay open for long,
+ so they'd hold the leases other operations wait for.
+ */
 class CNfsConnection : public CCriticalSection
 {
 public:
   struct keepAliveStruct
   {
-    std::string exportPath;
+    std::shared_ptr<CNfsContext> context;
     std::chrono::time_point<std::chrono::steady_clock> refreshTime;
   };
   typedef std::map<struct nfsfh  *, struct keepAliveStruct> tFileKeepAliveMap;
 
-  struct contextTimeout
+  struct PoolStats
   {
-    struct nfs_context *pContext;
-    std::chrono::time_point<std::chrono::steady_clock> lastAccessedTime;
+    uint64_t created = 0; //!< contexts mounted
+    uint64_t reused = 0; //!< leases served by an idle context
+    uint64_t waits = 0; //!< leases which had to wait for a context to become idle
+    uint64_t overflows = 0; //!< leases exceeding the limit as waiting timed out
+    uint64_t failures = 0; //!< failed mounts
+    uint64_t evicted = 0; //!< idle contexts destroyed
+    unsigned int inUse = 0;
+    unsigned int idle = 0;
+    unsigned int shared = 0; //!< contexts shared by open files
   };
 
-  typedef std::map<std::string, struct contextTimeout> tOpenContextMap;
+  /*!
+   \brief Lease of a context, returned to the pool when released or destroyed.
+   */
+  class CLease
+  {
+  public:
+    CLease() = default;
+    CLease(CNfsConnection& pool, std::shared_ptr<CNfsContext> context, bool shared = false);
+    ~CLease() { Release(); }
+    CLease(CLease&& other) noexcept;
+    CLease& operator=(CLease&& other) noexcept;
+    CLease(const CLease&) = delete;
+    CLease& operator=(const CLease&) = delete;
+
+    explicit operator bool() const { return m_context != nullptr; }
+    CNfsContext* operator->() const { return m_context.get(); }
+    CNfsContext& operator*() const { return *m_context; }
+    const std::shared_ptr<CNfsContext>& Get() const { return m_context; }
+
+    /*!
+     \brief Return the context to the pool.
+     \param reuse false to destroy the context, e.g. after the server dropped the session
+     */
+    void Release(bool reuse = true);
+
+  private:
+    CNfsConnection* m_pool = nullptr;
+    std::shared_ptr<CNfsContext> m_context;
+    bool m_shared = false;
+  };
 
   CNfsConnection();
-  ~CNfsConnection();
-  bool Connect(const CURL &url, std::string &relativePath);
-  struct nfs_context *GetNfsContext() {return m_pNfsContext;}
-  uint64_t GetMaxReadChunkSize() {return m_readChunkSize;}
-  uint64_t GetMaxWriteChunkSize() {return m_writeChunkSize;}
+  virtual ~CNfsConnection();
+
+  /*!
+   \brief Lease a mounted context for the export of the given url.
+   An idle context is reused if possible. If the export already has the maximum number of contexts
+   in use, the call waits for one to be released, unless the calling thread holds one itself.
+   \param relativePath set to the path relative to the export
+   \return the lease, empty if connecting failed
+   */
+  CLease Acquire(const CURL& url, std::string& relativePath);
+
+  /*!
+   \brief Lease the context shared by the open files of the export of the given url.
+   The context has to be locked for each call into libnfs. It doesn't count towards the contexts in
+   use and never waits.
+   \param relativePath set to the path relative to the export
+   \return the lease, empty if connecting failed
+   */
+  CLease AcquireShared(const CURL& url, std::string& relativePath);
+
   std::list<std::string> GetExportList(const CURL &url);
   //this functions splits the url into the exportpath (feed to mount) and the rest of the path
   //relative to the mounted export
   bool splitUrlIntoExportAndPath(const CURL& url, std::string &exportPath, std::string &relativePath, std::list<std::string> &exportList);
   bool splitUrlIntoExportAndPath(const CURL& url, std::string &exportPath, std::string &relativePath);
 
-  //special stat which uses its own context
-  //needed for getting intervolume symlinks to work
-  int stat(const CURL& url, nfs_stat_64* statbuff);
-
   void AddActiveConnection();
   void AddIdleConnection();
   void CheckIfIdle();
   void Deinit();
   //adds the filehandle to the keep alive list or resets
   //the timeout for this filehandle if already in list
-  void resetKeepAlive(const std::string& _exportPath, struct nfsfh* _pFileHandle);
+  void resetKeepAlive(const std::shared_ptr<CNfsContext>& context, struct nfsfh* _pFileHandle);
   //removes file handle from keep alive list
   void removeFromKeepAliveList(struct nfsfh  *_pFileHandle);
 
-  const std::string& GetConnectedIp() const {return m_resolvedHostName;}
-  const std::string& GetConnectedExport() const {return m_exportPath;}
-  const std::string GetContextMapId() const {return m_hostName + m_exportPath;}
+  PoolStats GetPoolStats();
+
+protected:
+  virtual std::shared_ptr<CNfsContext> CreateContext(const std::string& id,
+                                                     const CURL& url,
+                                                     const std::string& exportPath);
+  //! exported paths of the server of the url, queried once per host
+  virtual std::list<std::string> QueryExportList(const CURL& url);
+  virtual unsigned int GetMaxContexts() const;
+  void EvictIdle(std::chrono::steady_clock::duration maxIdle);
 
 private:
-  enum class ContextStatus
+  struct Pool
   {
-    INVALID,
-    NEW,
-    CACHED
+    std::list<std::shared_ptr<CNfsContext>> idle; // most recently used first
+    unsigned int inUse = 0;
+    std::shared_ptr<CNfsContext> shared; // context of the open files
   };
 
-  struct nfs_context *m_pNfsContext;//current nfs context
-  std::string m_exportPath;//current connected export path
-  std::string m_hostName;//current connected host
-  std::string m_resolvedHostName;//current connected host - as ip
-  uint64_t m_readChunkSize = 0;//current read chunksize of connected server
-  uint64_t m_writeChunkSize = 0;//current write chunksize of connected server
+  void Release(std::shared_ptr<CNfsContext> context, bool reuse, bool shared);
+  bool IsHeldByCurrentThread(const std::string& id) const;
+
   int m_OpenConnections = 0; //number of open connections
-  std::chrono::time_point<std::chrono::steady_clock> m_IdleTimeout;
   tFileKeepAliveMap m_KeepAliveTimeouts;//mapping filehandles to its idle timeout
-  tOpenContextMap m_openContextMap;//unique map for tracking all open contexts
-  std::chrono::time_point<std::chrono::steady_clock>
-      m_lastAccessedTime; //last access time for m_pNfsContext
-  std::list<std::string> m_exportList;//list of exported paths of current connected servers
+  std::map<std::string, std::list<std::string>> m_exportLists; // exported paths per host
+  std::map<std::string, Pool> m_pools; // per host name + export path
+  std::vector<std::shared_ptr<CNfsContext>> m_leased; // contexts in use
+  unsigned int m_generation = 0; // contexts of older generations aren't reused
+  PoolStats m_stats;
   CCriticalSection keepAliveLock;
-  CCriticalSection openContextLock;
-
-  void clearMembers();
-  struct nfs_context *getContextFromMap(const std::string &exportname, bool forceCacheHit = false);
+  XbmcThreads::ConditionVariable m_released;
 
-  // get context for given export and add to open contexts map - sets m_pNfsContext (may return an already mounted cached context)
-  ContextStatus getContextForExport(const std::string& exportname);
-  void destroyOpenContexts();
-  void destroyContext(const std::string &exportName);
-  void resolveHost(const CURL &url);//resolve hostname by dnslookup
-  void keepAlive(const std::string& _exportPath, struct nfsfh* _pFileHandle);
+  static std::string resolveHost(const CURL& url); //resolve hostname by dnslookup
+  void keepAlive(const std::shared_ptr<CNfsContext>& context, struct nfsfh* _pFileHandle);
   static void setOptions(struct nfs_context* context);
 };
 
@@ -131,7 +225,7 @@ namespace XFILE
     {
       return request == IOControl::SEEK_POSSIBLE ? 1 : -1;
     }
-    int GetChunkSize() override {return static_cast<int>(gNfsConnection.GetMaxReadChunkSize());}
+    int GetChunkSize() override;
 
     bool OpenForWrite(const CURL& url, bool bOverWrite = false) override;
     bool Delete(const CURL& url) override;
@@ -141,8 +235,7 @@ namespace XFILE
     bool IsValidFile(const std::string& strFileName);
     int64_t m_fileSize = 0;
     struct nfsfh *m_pFileHandle;
-    struct nfs_context *m_pNfsContext;//current nfs context
-    std::string m_exportPath;
+    CNfsConnection::CLease m_context; // context the file is opened with
   };
 }
 
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ReadAheadController.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace XFILE;
+
+CReadAheadController::CReadAheadController(int64_t maxForward, unsigned int chunkSize)
+  : m_maxForward(maxForward),
+    m_minTarget(std::min(maxForward, static_cast<int64_t>(chunkSize) * 2)),
+    m_targetForward(maxForward)
+{
+}
+
+void CReadAheadController::Seek(int64_t readPos, clock::time_point now)
+{
+  m_samplePos = readPos;
+  m_sampleStart = now;
+  m_started = true;
+
+  // the cache is usually empty after a seek, that's not the reader running dry
+  m_starved = true;
+}
+
+void CReadAheadController::OnSourceRead(size_t bytes, clock::duration took)
+{
+  m_sourceBytes += bytes;
+  m_sourceTime += took;
+  if (m_sourceTime < SOURCE_SAMPLE_PERIOD)
+    return;
+
+  const double seconds = std::chrono::duration<double>(m_sourceTime).count();
+  Average(m_sourceRate, m_sourceBytes / seconds, seconds);
+  m_sourceBytes = 0;
+  m_sourceTime = clock::duration::zero();
+}
+
+void CReadAheadController::Update(int64_t readPos, int64_t forward, clock::time_point now)
+{
+  if (!m_started || readPos < m_samplePos)
+    Seek(readPos, now);
+
+  if (forward <= 0 && !m_starved)
+  {
+    if (m_measured)
+      ++m_underruns;
+    m_starved = true;
+  }
+  else if (forward >= m_minTarget)
+    m_starved = false;
+
+  const auto elapsed = now - m_sampleStart;
+  const int64_t consumed = readPos - m_samplePos;
+  if (m_starved)
+  {
+    // the reader waits for the source, that says nothing about its own rate
+    m_samplePos = readPos;
+    m_sampleStart = now;
+  }
+  else if (elapsed >= SAMPLE_PERIOD && consumed > 0)
+  {
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    Average(m_measuredRate, consumed / seconds, seconds);
+    m_measured = true;
+    m_samplePos = readPos;
+    m_sampleStart = now;
+  }
+  else if (elapsed >= IDLE_PERIOD)
+  {
+    // paused, keep the estimate for when the reader continues
+    m_samplePos = readPos;
+    m_sampleStart = now;
+  }
+
+  Decide(forward);
+}
+
+uint32_t CReadAheadController::GetConsumeRate() const
+{
+  if (!m_measured)
+    return m_rateHint;
+  return std::max(static_cast<uint32_t>(m_measuredRate), m_rateHint);
+}
+
+void CReadAheadController::Average(double& average, double sample, double seconds)
+{
+  if (average <= 0.0)
+    average = sample;
+  else
+    average += (sample - average) * seconds / (seconds + RATE_TIME_CONSTANT);
+}
+
+void CReadAheadController::Decide(int64_t forward)
+{
+  const uint32_t consumeRate = GetConsumeRate();
+  if (consumeRate == 0)
+  {
+    // nothing known yet, fill the cache as fast as possible
+    m_targetForward = m_maxForward;
+    m_readRate = forward < m_targetForward ? std::numeric_limits<uint32_t>::max() : 0;
+    return;
+  }
+
+  // the less the source is ahead of the reader, the more seconds it needs to bridge a stall
+  double seconds = MIN_SECONDS;
+  if (m_sourceRate > 0.0)
+    seconds = MIN_SECONDS * MAX_READ_FACTOR / std::max(m_sourceRate / consumeRate, 1.0);
+  seconds = std::clamp(seconds * (1 + m_underruns), MIN_SECONDS, MAX_SECONDS);
+
+  m_targetForward =
+      std::clamp(static_cast<int64_t>(consumeRate * seconds), m_minTarget, m_maxForward);
+
+  if (forward >= m_targetForward)
+  {
+    m_readRate = 0;
+    return;
+  }
+
+  // read factor [4.0x - 1.5x] depending on the level of the cache
+  const double level = std::max(static_cast<double>(forward) / m_targetForward, 0.0);
+  const double factor = MAX_READ_FACTOR - (MAX_READ_FACTOR - MIN_READ_FACTOR) * level;
+  m_readRate = static_cast<uint32_t>(
+      std::min<double>(consumeRate * factor, std::numeric_limits<uint32_t>::max()));
+}
@@ -0,0 +1,127 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace XFILE
+{
+
+/*!
+ \brief Sizes the forward cache and the fill rate of a CFileCache from the measured consumption.
+
+ The consumption rate of the reader is measured from the progress of its read position. The target
+ amount of data to keep ahead of the reader is expressed in seconds of consumption and grows when
+ the source has little headroom over the consumer or when the reader ran dry, so low bitrate
+ streams don't fill the whole cache while high bitrate streams on a slow source get all of it.
+
+ The controller only computes decisions, it is fed by the cache thread with the current state.
+ */
+class CReadAheadController
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  static constexpr double MIN_SECONDS = 10.0; //!< read-ahead with a fast, steady source
+  static constexpr double MAX_SECONDS = 120.0;
+  static constexpr double MAX_READ_FACTOR = 4.0; //!< fill rate multiple of the consumption rate
+  static constexpr double MIN_READ_FACTOR = 1.5;
+
+  /*!
+   \param maxForward capacity of the forward cache in bytes
+   \param chunkSize size of a single source read, the target never drops below two chunks
+   */
+  CReadAheadController(int64_t maxForward, unsigned int chunkSize);
+
+  /*!
+   \brief Provide the expected consumption rate, e.g. the stream bitrate set by the player.
+   Used until the consumption was measured and as lower bound afterwards. 0 clears the hint.
+   */
+  void SetRateHint(uint32_t rate) { m_rateHint = rate; }
+
+  /*!
+   \brief Restart measuring after the reader jumped to a new position.
+   The rate estimate is kept, as it's a property of the stream rather than the position.
+   */
+  void Seek(int64_t readPos, clock::time_point now);
+
+  /*!
+   \brief Account a read from the source.
+   Only the time spent in the read counts, so throttling doesn't make the source look slow.
+   */
+  void OnSourceRead(size_t bytes, clock::duration took);
+
+  /*!
+   \brief Update the decisions with the current cache state.
+   \param readPos read position of the consumer
+   \param forward bytes cached ahead of the read position
+   */
+  void Update(int64_t readPos, int64_t forward, clock::time_point now);
+
+  /*!
+   \brief Estimated consumption rate in bytes/second, 0 while unknown.
+   */
+  uint32_t GetConsumeRate() const;
+
+  /*!
+   \brief Estimated rate the source can deliver in bytes/second, 0 while unknown.
+   */
+  uint32_t GetSourceRate() const { return static_cast<uint32_t>(m_sourceRate); }
+
+  /*!
+   \brief Amount of data to keep cached ahead of the read position.
+   */
+  int64_t GetTargetForward() const { return m_targetForward; }
+
+  /*!
+   \brief Below this amount of forward data the source is read without any rate limit.
+   */
+  int64_t GetMinForward() const { return m_targetForward / 4; }
+
+  /*!
+   \brief Maximum rate to read the source with in bytes/second, 0 if the target is reached.
+   */
+  uint32_t GetReadRate() const { return m_readRate; }
+
+  unsigned int GetUnderruns() const { return m_underruns; }
+
+private:
+  static constexpr std::chrono::milliseconds SAMPLE_PERIOD{1000};
+  static constexpr std::chrono::milliseconds IDLE_PERIOD{10000};
+  static constexpr std::chrono::milliseconds SOURCE_SAMPLE_PERIOD{200};
+  static constexpr double RATE_TIME_CONSTANT = 5.0; // seconds
+
+  static void Average(double& average, double sample, double seconds);
+  void Decide(int64_t forward);
+
+  const int64_t m_maxForward;
+  const int64_t m_minTarget;
+
+  uint32_t m_rateHint = 0;
+  double m_measuredRate = 0.0;
+  bool m_measured = false;
+
+  double m_sourceRate = 0.0;
+  uint64_t m_sourceBytes = 0;
+  clock::duration m_sourceTime{0};
+
+  int64_t m_samplePos = 0;
+  clock::time_point m_sampleStart;
+  bool m_started = false;
+
+  unsigned int m_underruns = 0;
+  bool m_starved = false;
+
+  int64_t m_targetForward;
+  uint32_t m_readRate = 0;
+};
+
+} // namespace XFILE
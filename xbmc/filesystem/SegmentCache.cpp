@@ -0,0 +1,659 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SegmentCache.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "threads/SystemClock.h"
+#include "utils/Digest.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <mutex>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+using KODI::UTILITY::CDigest;
+
+CSegmentCacheStore::CSegmentCacheStore(std::string path, uint64_t maxSize, size_t segmentSize)
+  : m_path(std::move(path)), m_maxSize(maxSize), m_segmentSize(segmentSize)
+{
+  URIUtils::AddSlashAtEnd(m_path);
+}
+
+CSegmentCacheStore& CSegmentCacheStore::GetInstance()
+{
+  static CSegmentCacheStore store("special://temp/segments/", 0);
+  return store;
+}
+
+void CSegmentCacheStore::Configure(const std::string& path, uint64_t maxSize)
+{
+  std::vector<std::string> evicted;
+  std::unique_lock lock(m_section);
+  m_maxSize = maxSize;
+
+  std::string newPath(path);
+  URIUtils::AddSlashAtEnd(newPath);
+  if (newPath != m_path)
+  {
+    m_path = std::move(newPath);
+    m_loaded = false;
+    m_lru.clear();
+    m_segments.clear();
+    m_size = 0;
+  }
+
+  if (m_loaded)
+    evicted = Evict();
+  lock.unlock();
+
+  DeleteFiles(evicted);
+}
+
+uint64_t CSegmentCacheStore::GetSize() const
+{
+  std::unique_lock lock(m_section);
+  return m_size;
+}
+
+std::string CSegmentCacheStore::GetKey(const CURL& url, int64_t size, int64_t mtime)
+{
+  return CDigest::Calculate(CDigest::Type::MD5, StringUtils::Format("{}|{}|{}",
+                                                                    url.GetWithoutUserDetails(),
+                                                                    size, mtime));
+}
+
+std::vector<bool> CSegmentCacheStore::GetSegments(const std::string& key, size_t count)
+{
+  Load();
+
+  std::vector<bool> segments(count, false);
+  std::unique_lock lock(m_section);
+  for (auto it = m_segments.lower_bound({key, 0}); it != m_segments.end() && it->first.first == key;
+       ++it)
+  {
+    if (it->first.second < count)
+      segments[it->first.second] = true;
+  }
+  return segments;
+}
+
+std::string CSegmentCacheStore::GetSegmentPath(const std::string& key, uint64_t index) const
+{
+  std::unique_lock lock(m_section);
+  return m_path + StringUtils::Format("{}-{}.seg", key, index);
+}
+
+bool CSegmentCacheStore::Add(const std::string& key, uint64_t index, const char* data, size_t size)
+{
+  Load();
+
+  std::string path;
+  std::string tmpPath;
+  {
+    std::unique_lock lock(m_section);
+    if (!IsEnabled())
+      return false;
+
+    const auto it = m_segments.find({key, index});
+    if (it != m_segments.end())
+    {
+      m_lru.splice(m_lru.begin(), m_lru, it->second);
+      return true;
+    }
+
+    path = GetSegmentPath(key, index);
+    tmpPath = StringUtils::Format("{}.{}.tmp", path, ++m_tmpSerial);
+  }
+
+  // write to a temporary file first so a partially written segment is never picked up
+  CFile file;
+  if (!file.OpenForWrite(tmpPath, true) || file.Write(data, size) != static_cast<ssize_t>(size))
+  {
+    CLog::Log(LOGERROR, "CSegmentCacheStore::{} - Failed to write segment \"{}\"", __FUNCTION__,
+              tmpPath);
+    file.Close();
+    CFile::Delete(tmpPath);
+    return false;
+  }
+  file.Close();
+
+  if (!CFile::Rename(tmpPath, path))
+  {
+    CLog::Log(LOGERROR, "CSegmentCacheStore::{} - Failed to rename segment \"{}\"", __FUNCTION__,
+              tmpPath);
+    CFile::Delete(tmpPath);
+    return false;
+  }
+
+  std::vector<std::string> evicted;
+  std::unique_lock lock(m_section);
+  if (!m_segments.contains({key, index}))
+  {
+    m_lru.emplace_front(key, index, size);
+    m_segments.emplace(std::make_pair(key, index), m_lru.begin());
+    m_size += size;
+    evicted = Evict();
+  }
+  const bool stored = m_segments.contains({key, index});
+  lock.unlock();
+
+  DeleteFiles(evicted);
+  return stored;
+}
+
+void CSegmentCacheStore::Remove(const std::string& key, uint64_t index)
+{
+  std::string path;
+  {
+    std::unique_lock lock(m_section);
+    const auto it = m_segments.find({key, index});
+    if (it == m_segments.end())
+      return;
+
+    path = GetSegmentPath(key, index);
+    Erase(it->second);
+  }
+
+  CFile::Delete(path);
+}
+
+void CSegmentCacheStore::Touch(const std::string& key, uint64_t index)
+{
+  std::unique_lock lock(m_section);
+  const auto it = m_segments.find({key, index});
+  if (it != m_segments.end())
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+}
+
+void CSegmentCacheStore::Pin(const void* owner, const std::string& key, uint64_t fromIndex)
+{
+  std::unique_lock lock(m_section);
+  m_pins[owner] = {key, fromIndex};
+}
+
+void CSegmentCacheStore::Unpin(const void* owner)
+{
+  std::vector<std::string> evicted;
+  {
+    std::unique_lock lock(m_section);
+    m_pins.erase(owner);
+    if (m_loaded)
+      evicted = Evict();
+  }
+
+  DeleteFiles(evicted);
+}
+
+void CSegmentCacheStore::Load()
+{
+  std::string path;
+  {
+    std::unique_lock lock(m_section);
+    if (m_loaded || !IsEnabled())
+      return;
+    path = m_path;
+  }
+
+  // the directory is listed without holding the lock, if several threads get here the first one
+  // to finish fills the index
+  std::vector<Segment> found;
+  std::vector<std::string> tmpFiles;
+  if (!CDirectory::Exists(path) && !CDirectory::Create(path))
+  {
+    CLog::Log(LOGERROR, "CSegmentCacheStore::{} - Failed to create cache directory \"{}\"",
+              __FUNCTION__, path);
+  }
+  else
+  {
+    CFileItemList items;
+    if (CDirectory::GetDirectory(path, items, "", DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    {
+      // there is no access time to restore, so the modification time orders the segments initially
+      std::vector<std::shared_ptr<CFileItem>> files;
+      for (const auto& item : items)
+      {
+        if (!item->IsFolder())
+          files.emplace_back(item);
+      }
+      std::ranges::sort(files, [](const auto& a, const auto& b)
+                        { return a->GetDateTime() < b->GetDateTime(); });
+
+      for (const auto& item : files)
+      {
+        const std::string name = URIUtils::GetFileName(item->GetPath());
+        if (name.ends_with(".tmp"))
+        {
+          tmpFiles.emplace_back(item->GetPath());
+          continue;
+        }
+
+        const size_t separator = name.rfind('-');
+        if (!name.ends_with(".seg") || separator == std::string::npos)
+          continue;
+
+        uint64_t index = 0;
+        const char* first = name.data() + separator + 1;
+        const char* last = name.data() + name.size() - 4;
+        const auto [ptr, ec] = std::from_chars(first, last, index);
+        if (ec != std::errc() || ptr != last)
+          continue;
+
+        found.push_back({name.substr(0, separator), index, static_cast<uint64_t>(item->GetSize())});
+      }
+    }
+  }
+
+  std::vector<std::string> evicted;
+  {
+    std::unique_lock lock(m_section);
+    if (m_loaded || m_path != path)
+      return;
+
+    m_loaded = true;
+    for (Segment& segment : found)
+    {
+      // segments added while listing are already in the index
+      if (m_segments.contains({segment.key, segment.index}))
+        continue;
+
+      m_size += segment.size;
+      m_lru.emplace_front(std::move(segment));
+      m_segments.emplace(std::make_pair(m_lru.front().key, m_lru.front().index), m_lru.begin());
+    }
+
+    CLog::Log(LOGDEBUG, "CSegmentCacheStore::{} - Found {} segments ({} bytes) in \"{}\"",
+              __FUNCTION__, m_segments.size(), m_size, m_path);
+
+    evicted = Evict();
+  }
+
+  // left over from interrupted writes, segments are only written once the index is loaded
+  DeleteFiles(tmpFiles);
+  DeleteFiles(evicted);
+}
+
+std::vector<std::string> CSegmentCacheStore::Evict()
+{
+  std::vector<std::string> files;
+  for (auto it = m_lru.end(); m_size > m_maxSize && it != m_lru.begin();)
+  {
+    --it;
+    if (IsPinned(*it))
+      continue;
+
+    files.emplace_back(GetSegmentPath(it->key, it->index));
+    it = Erase(it);
+  }
+  return files;
+}
+
+void CSegmentCacheStore::DeleteFiles(const std::vector<std::string>& files)
+{
+  for (const std::string& file : files)
+    CFile::Delete(file);
+}
+
+bool CSegmentCacheStore::IsPinned(const Segment& segment) const
+{
+  return std::ranges::any_of(m_pins,
+                             [&segment](const auto& pin)
+                             {
+                               return pin.second.first == segment.key &&
+                                      segment.index >= pin.second.second;
+                             });
+}
+
+CSegmentCacheStore::SegmentList::iterator CSegmentCacheStore::Erase(SegmentList::iterator it)
+{
+  m_size -= it->size;
+  m_segments.erase({it->key, it->index});
+  return m_lru.erase(it);
+}
+
+CSegmentCache::CSegmentCache(CSegmentCacheStore& store,
+                             std::string key,
+                             int64_t fileSize,
+                             int64_t maxForward)
+  : m_store(store),
+    m_key(std::move(key)),
+    m_fileSize(fileSize),
+    m_maxForward(maxForward),
+    m_segmentSize(store.GetSegmentSize())
+{
+}
+
+CSegmentCache::~CSegmentCache()
+{
+  Close();
+}
+
+int CSegmentCache::Open()
+{
+  Close();
+
+  std::unique_lock lock(m_sync);
+
+  RefreshStored();
+  m_buffer = std::make_unique<char[]>(m_segmentSize);
+  m_bufferStart = 0;
+  m_bufferStored = false;
+  m_writePos = 0;
+  m_readPos = 0;
+  m_dataAvail.Reset();
+  m_store.Pin(this, m_key, 0);
+
+  CLog::Log(LOGDEBUG, "CSegmentCache::{} - <{}> {} of {} segments cached", __FUNCTION__, m_key,
+            std::ranges::count(m_stored, true), m_stored.size());
+
+  return CACHE_RC_OK;
+}
+
+void CSegmentCache::Close()
+{
+  std::unique_lock lock(m_sync);
+
+  m_segmentFile.Close();
+  m_segmentFileIndex = -1;
+  m_buffer.reset();
+  m_stored.clear();
+  m_store.Unpin(this);
+}
+
+size_t CSegmentCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  std::unique_lock lock(m_sync);
+
+  if (m_writePos - m_readPos >= m_maxForward)
+    return 0;
+
+  if (IsBufferFull() && !m_bufferStored && m_readPos < m_writePos)
+    return 0;
+
+  return iRequestSize;
+}
+
+int CSegmentCache::WriteToCache(const char* pBuffer, size_t iSize)
+{
+  size_t written = 0;
+  while (written < iSize)
+  {
+    uint64_t index;
+    size_t length;
+    bool complete;
+    {
+      std::unique_lock lock(m_sync);
+
+      if (IsBufferFull())
+      {
+        // a segment that could not be stored has to stay around until it was read
+        if (!m_bufferStored && m_readPos < m_writePos)
+          break;
+
+        m_bufferStart = m_writePos;
+        m_bufferStored = false;
+      }
+
+      const size_t offset = static_cast<size_t>(m_writePos % m_segmentSize);
+      const size_t size = std::min(iSize - written, m_segmentSize - offset);
+      std::memcpy(m_buffer.get() + offset, pBuffer + written, size);
+      m_writePos += size;
+      written += size;
+
+      // the source grew beyond the size the key was made for
+      if (m_writePos > m_fileSize)
+        m_bufferStored = false;
+
+      complete = !m_bufferStored && m_bufferStart % m_segmentSize == 0 &&
+                 m_writePos <= m_fileSize &&
+                 (m_writePos % m_segmentSize == 0 || m_writePos == m_fileSize);
+      index = m_bufferStart / m_segmentSize;
+      length = static_cast<size_t>(m_writePos - m_bufferStart);
+    }
+
+    // when reader waits for data it will wait on the event.
+    m_dataAvail.Set();
+
+    // the buffer is only modified by the writing thread, so it can be stored without the lock
+    if (complete && m_store.Add(m_key, index, m_buffer.get(), length))
+    {
+      std::unique_lock lock(m_sync);
+      m_bufferStored = true;
+      m_stored[index] = true;
+    }
+  }
+
+  return static_cast<int>(written);
+}
+
+int CSegmentCache::ReadFromCache(char* pBuffer, size_t iMaxSize)
+{
+  std::unique_lock lock(m_sync);
+
+  if (m_readPos >= m_bufferStart && m_readPos < m_writePos)
+  {
+    const size_t size = std::min(iMaxSize, static_cast<size_t>(m_writePos - m_readPos));
+    std::memcpy(pBuffer, m_buffer.get() + m_readPos % m_segmentSize, size);
+    m_readPos += size;
+    m_space.Set();
+    return static_cast<int>(size);
+  }
+
+  if (IsSegmentStored(m_readPos))
+  {
+    const int read = ReadSegment(pBuffer, iMaxSize);
+    if (read > 0)
+      m_space.Set();
+    return read;
+  }
+
+  return m_bEndOfInput ? 0 : CACHE_RC_WOULD_BLOCK;
+}
+
+int CSegmentCache::ReadSegment(char* buffer, size_t size)
+{
+  const int64_t index = m_readPos / m_segmentSize;
+  if (m_segmentFileIndex != index)
+  {
+    m_segmentFile.Close();
+    m_segmentFileIndex = -1;
+
+    if (!m_segmentFile.Open(m_store.GetSegmentPath(m_key, index), READ_NO_CACHE))
+    {
+      CLog::Log(LOGERROR, "CSegmentCache::{} - <{}> Failed to open segment {}", __FUNCTION__,
+                m_key, index);
+      m_stored[index] = false;
+      m_store.Remove(m_key, index);
+      return CACHE_RC_ERROR;
+    }
+
+    m_segmentFileIndex = index;
+    m_store.Touch(m_key, index);
+    m_store.Pin(this, m_key, index);
+  }
+
+  const int64_t offset = m_readPos - index * m_segmentSize;
+  if (m_segmentFile.GetPosition() != offset && m_segmentFile.Seek(offset, SEEK_SET) != offset)
+  {
+    CLog::Log(LOGERROR, "CSegmentCache::{} - <{}> Can't seek segment {} to {}", __FUNCTION__,
+              m_key, index, offset);
+    return CACHE_RC_ERROR;
+  }
+
+  const int64_t end = std::min<int64_t>((index + 1) * m_segmentSize, m_fileSize);
+  const ssize_t read =
+      m_segmentFile.Read(buffer, std::min(size, static_cast<size_t>(end - m_readPos)));
+  if (read <= 0)
+  {
+    CLog::Log(LOGERROR, "CSegmentCache::{} - <{}> Failed to read segment {}", __FUNCTION__, m_key,
+              index);
+    m_segmentFile.Close();
+    m_segmentFileIndex = -1;
+    m_stored[index] = false;
+    m_store.Remove(m_key, index);
+    return CACHE_RC_ERROR;
+  }
+
+  m_readPos += read;
+  return static_cast<int>(read);
+}
+
+int64_t CSegmentCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout)
+{
+  auto available = [this]
+  {
+    std::unique_lock lock(m_sync);
+    return GetContiguousEnd(m_readPos) - m_readPos;
+  };
+
+  if (timeout == 0ms || IsEndOfInput())
+    return available();
+
+  XbmcThreads::EndTime<> endTime{timeout};
+  while (!IsEndOfInput())
+  {
+    const int64_t iAvail = available();
+    if (iAvail >= iMinAvail)
+      return iAvail;
+
+    if (!m_dataAvail.Wait(endTime.GetTimeLeft()))
+      return CACHE_RC_TIMEOUT;
+  }
+  return available();
+}
+
+int64_t CSegmentCache::Seek(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+
+  RefreshStored();
+  if (!IsCachedPositionLocked(iFilePosition))
+    return CACHE_RC_ERROR;
+
+  m_readPos = iFilePosition;
+  m_store.Pin(this, m_key, iFilePosition / m_segmentSize);
+  m_space.Set();
+
+  return iFilePosition;
+}
+
+bool CSegmentCache::Reset(int64_t iSourcePosition)
+{
+  std::unique_lock lock(m_sync);
+
+  const bool cached = IsCachedPositionLocked(iSourcePosition);
+  const int64_t end = GetContiguousEnd(iSourcePosition);
+
+  // continue writing at the end of the cached data, dropping the buffer if that lies elsewhere
+  if (end != m_writePos)
+  {
+    m_bufferStart = end;
+    m_bufferStored = false;
+    m_writePos = end;
+  }
+
+  m_readPos = iSourcePosition;
+  m_store.Pin(this, m_key, iSourcePosition / m_segmentSize);
+  m_space.Set();
+
+  return !cached;
+}
+
+void CSegmentCache::EndOfInput()
+{
+  CCacheStrategy::EndOfInput();
+  m_dataAvail.Set();
+}
+
+int64_t CSegmentCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  RefreshStored();
+  return GetContiguousEnd(iFilePosition);
+}
+
+int64_t CSegmentCache::CachedDataStartPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_bufferStart;
+}
+
+int64_t CSegmentCache::CachedDataEndPos()
+{
+  std::unique_lock lock(m_sync);
+  return m_writePos;
+}
+
+bool CSegmentCache::IsCachedPosition(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+  return IsCachedPositionLocked(iFilePosition);
+}
+
+CCacheStrategy* CSegmentCache::CreateNew()
+{
+  return new CSegmentCache(m_store, m_key, m_fileSize, m_maxForward);
+}
+
+void CSegmentCache::RefreshStored()
+{
+  // segments may have been evicted meanwhile
+  const size_t count = static_cast<size_t>((m_fileSize + m_segmentSize - 1) / m_segmentSize);
+  m_stored = m_store.GetSegments(m_key, count);
+}
+
+int64_t CSegmentCache::GetContiguousEnd(int64_t position) const
+{
+  int64_t end = position;
+  while (true)
+  {
+    if (end >= m_bufferStart && end < m_writePos)
+    {
+      end = m_writePos;
+      // data following a buffer that is not stored can't be used without the buffer
+      if (!m_bufferStored)
+        break;
+    }
+    else if (IsSegmentStored(end))
+    {
+      end = std::min<int64_t>((end / m_segmentSize + 1) * m_segmentSize, m_fileSize);
+    }
+    else
+      break;
+  }
+  return end;
+}
+
+bool CSegmentCache::IsCachedPositionLocked(int64_t position) const
+{
+  return (position >= m_bufferStart && position <= m_writePos) || IsSegmentStored(position) ||
+         (position == m_fileSize && IsSegmentStored(position - 1));
+}
+
+bool CSegmentCache::IsBufferFull() const
+{
+  return m_writePos > m_bufferStart && m_writePos % m_segmentSize == 0;
+}
+
+bool CSegmentCache::IsSegmentStored(int64_t position) const
+{
+  if (position < 0 || position >= m_fileSize)
+    return false;
+
+  const auto index = static_cast<size_t>(position / m_segmentSize);
+  return index < m_stored.size() && m_stored[index];
+}
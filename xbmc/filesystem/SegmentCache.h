@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "File.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+class CURL;
+
+namespace XFILE
+{
+
+/*!
+ \brief Bounded on-disk store of fixed size file segments, shared by all CSegmentCache instances.
+
+ Segments are addressed by a key derived from the source URL, size and modification time, so a
+ changed source never matches stale data. The store is bounded in size and evicts the least
+ recently used segments across all files, skipping segments still ahead of an active reader.
+ */
+class CSegmentCacheStore
+{
+public:
+  static constexpr size_t DEFAULT_SEGMENT_SIZE = 4 * 1024 * 1024;
+
+  CSegmentCacheStore(std::string path, uint64_t maxSize, size_t segmentSize = DEFAULT_SEGMENT_SIZE);
+
+  static CSegmentCacheStore& GetInstance();
+
+  /*!
+   \brief Change location and size limit of the store. Changing the location drops the index.
+   \param maxSize maximum size in bytes, 0 disables the store
+   */
+  void Configure(const std::string& path, uint64_t maxSize);
+
+  bool IsEnabled() const { return m_maxSize > 0; }
+  size_t GetSegmentSize() const { return m_segmentSize; }
+  uint64_t GetMaxSize() const { return m_maxSize; }
+  uint64_t GetSize() const;
+
+  static std::string GetKey(const CURL& url, int64_t size, int64_t mtime);
+
+  /*!
+   \brief Get the segments of the given file that are present on disk.
+   \param count number of segments of the file
+   */
+  std::vector<bool> GetSegments(const std::string& key, size_t count);
+  std::string GetSegmentPath(const std::string& key, uint64_t index) const;
+
+  bool Add(const std::string& key, uint64_t index, const char* data, size_t size);
+  void Remove(const std::string& key, uint64_t index);
+  void Touch(const std::string& key, uint64_t index);
+
+  /*!
+   \brief Protect the segments of a file from the given index onwards from eviction.
+   \param owner opaque identifier of the reader, used to update or release the pin
+   */
+  void Pin(const void* owner, const std::string& key, uint64_t fromIndex);
+  void Unpin(const void* owner);
+
+private:
+  struct Segment
+  {
+    std::string key;
+    uint64_t index;
+    uint64_t size;
+  };
+  using SegmentList = std::list<Segment>;
+
+  /*!
+   \brief Fill the index from the segments in the store directory, once. Must be called without
+   holding the lock, the directory is listed outside of it.
+   */
+  void Load();
+
+  /*!
+   \brief Drop the least recently used segments over the size limit from the index.
+   \return the segment files to delete once the lock is released
+   */
+  std::vector<std::string> Evict();
+  bool IsPinned(const Segment& segment) const;
+  SegmentList::iterator Erase(SegmentList::iterator it);
+  static void DeleteFiles(const std::vector<std::string>& files);
+
+  mutable CCriticalSection m_section;
+  std::string m_path;
+  std::atomic<uint64_t> m_maxSize;
+  size_t m_segmentSize;
+  bool m_loaded = false;
+  uint64_t m_size = 0;
+  uint64_t m_tmpSerial = 0;
+  SegmentList m_lru; //!< most recently used first
+  std::map<std::pair<std::string, uint64_t>, SegmentList::iterator> m_segments;
+  std::map<const void*, std::pair<std::string, uint64_t>> m_pins;
+};
+
+/*!
+ \brief Cache strategy backed by the persistent CSegmentCacheStore.
+
+ Written data is collected in a segment sized buffer and stored as soon as a segment is complete.
+ Segments already stored by an earlier session are read from disk and reported as cached, so the
+ CFileCache only fetches the missing parts from the source.
+ */
+class CSegmentCache : public CCacheStrategy
+{
+public:
+  /*!
+   \param key file key, see CSegmentCacheStore::GetKey()
+   \param fileSize size of the source file, segments beyond it are never stored
+   \param maxForward maximum amount of data fetched ahead of the read position
+   */
+  CSegmentCache(CSegmentCacheStore& store,
+                std::string key,
+                int64_t fileSize,
+                int64_t maxForward);
+  ~CSegmentCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* pBuffer, size_t iSize) override;
+  int ReadFromCache(char* pBuffer, size_t iMaxSize) override;
+  int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t iFilePosition) override;
+  bool Reset(int64_t iSourcePosition) override;
+  void EndOfInput() override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+
+private:
+  void RefreshStored();
+  int64_t GetContiguousEnd(int64_t position) const;
+  bool IsCachedPositionLocked(int64_t position) const;
+  bool IsBufferFull() const;
+  bool IsSegmentStored(int64_t position) const;
+  int ReadSegment(char* buffer, size_t size);
+
+  CSegmentCacheStore& m_store;
+  const std::string m_key;
+  const int64_t m_fileSize;
+  const int64_t m_maxForward;
+  const size_t m_segmentSize;
+
+  mutable CCriticalSection m_sync;
+  CEvent m_dataAvail;
+  std::unique_ptr<char[]> m_buffer; //!< segment being written, indexed by position % segment size
+  int64_t m_bufferStart = 0;
+  bool m_bufferStored = false;
+  int64_t m_writePos = 0;
+  int64_t m_readPos = 0;
+  std::vector<bool> m_stored;
+
+  CFile m_segmentFile;
+  int64_t m_segmentFileIndex = -1;
+};
+
+} // namespace XFILE
@@ -12,17 +12,19 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdint>
 
 #include <sys/stat.h>
 
 static constexpr uint64_t ZIP_CACHE_LIMIT = 4ull * 1024 * 1024;
+// compressed data is read in large blocks, but never more than the entry holds
+static constexpr uint64_t ZIP_READ_BUFFER_SIZE = 256 * 1024;
 
 using namespace XFILE;
 
 CZipFile::CZipFile() : m_szStringBuffer(nullptr), m_szStartOfStringBuffer(nullptr)
 {
-  memset(m_szBuffer, 0, sizeof(m_szBuffer));
 }
 
 CZipFile::~CZipFile()
@@ -88,6 +90,8 @@ bool CZipFile::InitDecompress()
   m_ZStream.zalloc = Z_NULL;
   m_ZStream.zfree = Z_NULL;
   m_ZStream.opaque = Z_NULL;
+  m_szBuffer.resize(static_cast<size_t>(
+      std::max<uint64_t>(std::min(mZipItem.csize, ZIP_READ_BUFFER_SIZE), 1)));
   if( mZipItem.method != 0 )
   {
     if (inflateInit2(&m_ZStream,-MAX_WBITS) != Z_OK)
@@ -96,7 +100,7 @@ bool CZipFile::InitDecompress()
       return false;
     }
   }
-  m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer);
+  m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer.data());
   m_ZStream.avail_in = 0;
   m_ZStream.total_out = 0;
 
@@ -172,7 +176,7 @@ int64_t CZipFile::Seek(int64_t iFilePosition, int iWhence)
         inflateEnd(&m_ZStream);
         inflateInit2(&m_ZStream,-MAX_WBITS); // simply restart zlib
         mFile.Seek(mZipItem.offset,SEEK_SET);
-        m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer);
+        m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer.data());
         m_ZStream.avail_in = 0;
         m_ZStream.total_out = 0;
         while (m_iFilePos < iFilePosition)
@@ -369,17 +373,17 @@ void CZipFile::Close()
 
 bool CZipFile::FillBuffer()
 {
-  ssize_t sToRead = 65535;
-  if (m_iZipFilePos + 65535 > static_cast<int64_t>(mZipItem.csize))
+  ssize_t sToRead = static_cast<ssize_t>(m_szBuffer.size());
+  if (m_iZipFilePos + sToRead > static_cast<int64_t>(mZipItem.csize))
     sToRead = static_cast<ssize_t>(mZipItem.csize - m_iZipFilePos);
 
   if (sToRead <= 0)
     return false; // eof!
 
-  if (mFile.Read(m_szBuffer,sToRead) != sToRead)
+  if (mFile.Read(m_szBuffer.data(), sToRead) != sToRead)
     return false;
   m_ZStream.avail_in = static_cast<unsigned int>(sToRead);
-  m_ZStream.next_in = reinterpret_cast<Byte*>(m_szBuffer);
+  m_ZStream.next_in = reinterpret_cast<Byte*>(m_szBuffer.data());
   m_iZipFilePos += sToRead;
   return true;
 }
@@ -12,6 +12,8 @@
 #include "IFile.h"
 #include "ZipManager.h"
 
+#include <vector>
+
 #include <zlib.h>
 
 namespace XFILE
@@ -49,7 +51,7 @@ namespace XFILE
     int64_t m_iZipFilePos = 0; // position in _compressed_ data
     int m_iAvailBuffer = 0;
     z_stream m_ZStream{};
-    char m_szBuffer[65535]; // 64k buffer for compressed data
+    std::vector<char> m_szBuffer; // buffer for compressed data
     char* m_szStringBuffer;
     char* m_szStartOfStringBuffer; // never allocated!
     size_t m_iDataInStringBuffer = 0;
@@ -10,6 +10,7 @@
 
 #include "File.h"
 #include "URL.h"
+#include "Util.h"
 #if defined(TARGET_POSIX)
 #include "PlatformDefs.h"
 #endif
@@ -22,40 +23,95 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <mutex>
+#include <set>
+#include <string_view>
 #include <utility>
 
+#include <zlib.h>
+
 using namespace XFILE;
 
+static constexpr size_t ZC_FLAG_ENCRYPTED = 1 << 0; // general purpose bit 0 - file is encrypted
 static constexpr size_t ZC_FLAG_EFS = 1 << 11; // general purpose bit 11 - zip holds utf-8 filenames
 
+static constexpr unsigned short ZIP_METHOD_STORED = 0;
+static constexpr unsigned short ZIP_METHOD_DEFLATED = 8;
+
+// large blocks keep the number of reads, writes and inflate calls per entry low
+static constexpr size_t EXTRACT_BUFFER_SIZE = 256 * 1024;
+
 CZipManager::CZipManager() = default;
 
 CZipManager::~CZipManager() = default;
 
 bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
 {
-  struct __stat64 m_StatData = {};
+  const auto index = GetIndex(url, true);
+  if (!index)
+    return false;
+
+  items = index->entries;
+  return true;
+}
 
+bool CZipManager::GetZipEntry(const CURL& url, SZipEntry& item)
+{
+  const auto index = GetIndex(url, false);
+  if (!index)
+    return false;
+
+  const auto it = index->names.find(url.GetFileName());
+  if (it == index->names.end())
+    return false;
+
+  item = index->entries[it->second];
+  return true;
+}
+
+std::shared_ptr<const CZipManager::CIndex> CZipManager::GetIndex(const CURL& url, bool validate)
+{
   const std::string strFile = url.GetHostName();
+
+  if (!validate)
+  {
+    std::unique_lock lock(m_critSection);
+    const auto it = m_indexes.find(strFile);
+    if (it != m_indexes.end())
+      return it->second;
+  }
+
+  struct __stat64 m_StatData = {};
   if (CFile::Stat(strFile, &m_StatData))
   {
     CLog::LogF(LOGERROR, "Failed to stat file {}", url.GetRedacted());
-    return false;
+    return {};
   }
 
-  const auto it = mZipMap.find(strFile);
-  if (it != mZipMap.end()) // already listed, just return it if not changed, else release and reread
   {
-    const auto it2 = mZipDate.find(strFile);
-    if (m_StatData.st_mtime == it2->second)
-    {
-      items = it->second;
-      return true;
-    }
-    mZipMap.erase(it);
-    mZipDate.erase(it2);
+    // already listed, just return it if not changed, else reread
+    std::unique_lock lock(m_critSection);
+    const auto it = m_indexes.find(strFile);
+    if (it != m_indexes.end() && it->second->mtime == m_StatData.st_mtime)
+      return it->second;
   }
 
+  // parsing may take a while on remote archives, it's done without blocking other archives
+  auto index = std::make_shared<CIndex>();
+  index->mtime = m_StatData.st_mtime;
+  if (!ReadIndex(strFile, *index))
+  {
+    release(url.Get());
+    return {};
+  }
+
+  std::unique_lock lock(m_critSection);
+  m_indexes[strFile] = index;
+  return index;
+}
+
+bool CZipManager::ReadIndex(const std::string& strFile, CIndex& index)
+{
   CFile mFile;
   if (!mFile.Open(strFile))
   {
@@ -77,9 +133,6 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     CLog::LogF(LOGWARNING,
                "ZIP split archive header found. Trying to process as a single archive..");
 
-  // push date for update detection
-  mZipDate.insert(make_pair(strFile, m_StatData.st_mtime));
-
   const bool Is64{IsZip64(mFile)};
 
   // Look for end of central directory record
@@ -176,33 +229,44 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     return false;
   }
 
-  // Go to the start of central directory
+  if (cdirOffset64 + cdirSize64 > static_cast<uint64_t>(fileSize))
+  {
+    CLog::LogF(LOGERROR, "Broken file {}!", strFile);
+    return false;
+  }
+
+  // Read the whole central directory at once and parse it in memory
+  std::vector<char> cdir(cdirSize64);
   if (mFile.Seek(static_cast<int64_t>(cdirOffset64), SEEK_SET) == -1)
     return false;
+  if (!cdir.empty() && mFile.Read(cdir.data(), cdir.size()) != static_cast<ssize_t>(cdir.size()))
+    return false;
 
   CRegExp pathTraversal;
   pathTraversal.RegComp(PATH_TRAVERSAL);
 
-  char temp[CHDR_SIZE];
-  while (mFile.GetPosition() < static_cast<int64_t>(cdirOffset64 + cdirSize64))
+  std::vector<SZipEntry>& items = index.entries;
+  size_t pos = 0;
+  while (pos < cdir.size())
   {
     SZipEntry ze;
-    if (mFile.Read(temp, CHDR_SIZE) != CHDR_SIZE)
+    if (pos + CHDR_SIZE > cdir.size())
       return false;
-    readCHeader(temp, ze);
+    readCHeader(cdir.data() + pos, ze);
     if (ze.header != ZIP_CENTRAL_HEADER)
     {
       CLog::LogF(LOGERROR, "Broken file {}!", strFile);
       mFile.Close();
       return false;
     }
+    pos += CHDR_SIZE;
 
-    // Get the filename just after the central file header
-    std::vector<char> bufName(ze.flength);
-    if (mFile.Read(bufName.data(), ze.flength) != ze.flength)
+    if (pos + ze.flength + ze.eclength + ze.clength > cdir.size())
       return false;
-    std::string strName(bufName.data(), bufName.size());
-    bufName.clear();
+
+    // Get the filename just after the central file header
+    std::string strName(cdir.data() + pos, ze.flength);
+    pos += ze.flength;
     if ((ze.flags & ZC_FLAG_EFS) == 0)
     {
       std::string tmp(strName);
@@ -213,117 +277,223 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     std::memcpy(ze.name, strName.data(), copyLen);
     ze.name[copyLen] = '\0';
 
-    // Read central extra field so we can parse ZIP64 extra
-    std::vector<char> extraField;
-    if (ze.eclength > 0)
-    {
-      extraField.resize(ze.eclength);
-      if (mFile.Read(extraField.data(), ze.eclength) != ze.eclength)
-        return false;
-
-      // If any 32-bit fields are maxed, pull real values from ZIP64 extra
-      if (Is64 &&
-          (ze.csize == 0xFFFFFFFFu || ze.usize == 0xFFFFFFFFu || ze.lhdrOffset == 0xFFFFFFFFu))
-        ParseZip64ExtraField(extraField.data(), ze.eclength, ze);
-    }
+    // If any 32-bit fields are maxed, pull real values from ZIP64 extra
+    if (Is64 && ze.eclength > 0 &&
+        (ze.csize == 0xFFFFFFFFu || ze.usize == 0xFFFFFFFFu || ze.lhdrOffset == 0xFFFFFFFFu))
+      ParseZip64ExtraField(cdir.data() + pos, ze.eclength, ze);
 
     // Jump after central file header extra field and file comment
-    if (mFile.Seek(ze.clength, SEEK_CUR) == -1)
-      return false;
+    pos += ze.eclength + ze.clength;
 
     if (pathTraversal.RegFind(strName) < 0)
       items.push_back(ze);
   }
 
+  cdir.clear();
+
   /* go through list and figure out file header lengths */
+  char lhdr[LHDR_SIZE];
   for (auto& ze : items)
   {
-    // Go to the local file header to get the extra field length
+    // Read the local file header to get the extra field length
     // !! local header extra field length != central file header extra field length !!
-    const int64_t localFilenameLengthPos = static_cast<int64_t>(ze.lhdrOffset) + 26;
-    if (localFilenameLengthPos + 2 > mFile.GetLength())
+    if (static_cast<int64_t>(ze.lhdrOffset) + LHDR_SIZE > fileSize)
       return false;
 
-    if (mFile.Seek(localFilenameLengthPos, SEEK_SET) == -1)
-      return false;
-    uint16_t flength;
-    if (mFile.Read(&flength, 2) != 2)
-      return false;
-    flength = Endian_SwapLE16(flength);
-    if (mFile.Read(&ze.elength, 2) != 2)
+    if (mFile.Seek(static_cast<int64_t>(ze.lhdrOffset), SEEK_SET) == -1)
       return false;
-    ze.elength = Endian_SwapLE16(ze.elength);
-
-    mFile.Seek(flength, SEEK_CUR); // Skip filename
-
-    std::vector<char> localExtra(ze.elength);
-    if (ze.elength && mFile.Read(localExtra.data(), ze.elength) != ze.elength)
+    if (mFile.Read(lhdr, LHDR_SIZE) != LHDR_SIZE)
       return false;
+    const uint16_t flength = Endian_SwapLE16(ReadUnaligned<uint16_t>(lhdr + 26));
+    ze.elength = Endian_SwapLE16(ReadUnaligned<uint16_t>(lhdr + 28));
 
-    if (Is64 &&
-        (ze.csize == 0xFFFFFFFFu || ze.usize == 0xFFFFFFFFu || ze.lhdrOffset == 0xFFFFFFFFu) &&
-        !localExtra.empty())
+    if (Is64 && ze.elength &&
+        (ze.csize == 0xFFFFFFFFu || ze.usize == 0xFFFFFFFFu || ze.lhdrOffset == 0xFFFFFFFFu))
+    {
+      std::vector<char> localExtra(ze.elength);
+      mFile.Seek(flength, SEEK_CUR); // Skip filename
+      if (mFile.Read(localExtra.data(), ze.elength) != ze.elength)
+        return false;
       ParseZip64ExtraField(localExtra.data(), ze.elength, ze);
+    }
 
     // Compressed data offset = local header offset + size of local header + filename length + local file header extra field length
-    ze.offset = static_cast<int64_t>(ze.lhdrOffset) + LHDR_SIZE + ze.flength + ze.elength;
+    ze.offset = static_cast<int64_t>(ze.lhdrOffset) + LHDR_SIZE + flength + ze.elength;
   }
 
-  mZipMap.insert(make_pair(strFile, items));
+  // first entry wins for duplicate names
+  index.names.reserve(items.size());
+  for (size_t i = 0; i < items.size(); ++i)
+    index.names.try_emplace(items[i].name, i);
+
   mFile.Close();
   return true;
 }
 
-bool CZipManager::GetZipEntry(const CURL& url, SZipEntry& item)
+bool CZipManager::ExtractArchive(const std::string& strArchive, const std::string& strPath)
+{
+  const CURL pathToUrl(strArchive);
+  return ExtractArchive(pathToUrl, strPath);
+}
+
+bool CZipManager::ExtractArchive(const CURL& archive,
+                                 const std::string& strPath,
+                                 const std::string& strSubPath /* = "" */)
 {
-  const std::string& strFile = url.GetHostName();
+  const auto index = GetIndex(URIUtils::CreateArchivePath("zip", archive), true);
+  if (!index)
+    return false;
+
+  std::string prefix(strSubPath);
+  if (!prefix.empty() && prefix.back() != '/')
+    prefix += '/';
 
-  std::map<std::string, std::vector<SZipEntry> >::iterator it = mZipMap.find(strFile);
-  std::vector<SZipEntry> items;
-  if (it == mZipMap.end()) // we need to list the zip
+  // extract in archive order, so the archive is read front to back
+  std::vector<const SZipEntry*> entries;
+  for (const auto& entry : index->entries)
   {
-    GetZipList(url,items);
+    const std::string_view name(entry.name);
+    if (name.size() > prefix.size() && name.starts_with(prefix))
+      entries.emplace_back(&entry);
   }
-  else
+  std::ranges::sort(entries, {}, &SZipEntry::offset);
+
+  CFile file;
+  if (!file.Open(archive))
   {
-    items = it->second;
+    CLog::LogF(LOGERROR, "Unable to open file {}!", archive.GetRedacted());
+    return false;
   }
 
-  const std::string& strFileName = url.GetFileName();
-  for (const auto& it2 : items)
+  std::vector<char> in(EXTRACT_BUFFER_SIZE);
+  std::vector<char> out(EXTRACT_BUFFER_SIZE);
+  std::set<std::string> folders;
+  for (const SZipEntry* entry : entries)
   {
-    if (std::string(it2.name) == strFileName)
+    const std::string name(entry->name + prefix.size());
+    const std::string destination = URIUtils::AddFileToFolder(strPath, name);
+
+    std::string folder = URIUtils::GetDirectory(destination);
+    if (folders.insert(folder).second && !CUtil::CreateDirectoryEx(folder))
     {
-      item = it2;
-      return true;
+      CLog::LogF(LOGERROR, "Failed to create folder {}", CURL::GetRedacted(folder));
+      return false;
     }
+
+    if (name.back() == '/')
+      continue;
+
+    if (!ExtractEntry(file, *entry, destination, in, out))
+      return false;
   }
-  return false;
-}
 
-bool CZipManager::ExtractArchive(const std::string& strArchive, const std::string& strPath)
-{
-  const CURL pathToUrl(strArchive);
-  return ExtractArchive(pathToUrl, strPath);
+  return true;
 }
 
-bool CZipManager::ExtractArchive(const CURL& archive, const std::string& strPath)
+bool CZipManager::ExtractEntry(CFile& archive,
+                               const SZipEntry& entry,
+                               const std::string& strPath,
+                               std::vector<char>& in,
+                               std::vector<char>& out)
 {
-  std::vector<SZipEntry> entry;
-  CURL url = URIUtils::CreateArchivePath("zip", archive);
-  GetZipList(url, entry);
-  for (const auto& it : entry)
+  if ((entry.flags & ZC_FLAG_ENCRYPTED) != 0)
+  {
+    CLog::LogF(LOGERROR, "Encrypted file {} not supported!", entry.name);
+    return false;
+  }
+
+  if (entry.method != ZIP_METHOD_STORED && entry.method != ZIP_METHOD_DEFLATED)
   {
-    if (it.name[strlen(it.name) - 1] == '/') // skip dirs
+    CLog::LogF(LOGERROR, "Unsupported compression method {} of file {}", entry.method, entry.name);
+    return false;
+  }
+
+  if (archive.Seek(entry.offset, SEEK_SET) != entry.offset)
+    return false;
+
+  CFile dest;
+  if (!dest.OpenForWrite(strPath, true))
+  {
+    CLog::LogF(LOGERROR, "Unable to create file {}", CURL::GetRedacted(strPath));
+    return false;
+  }
+
+  z_stream stream = {};
+  if (entry.method == ZIP_METHOD_DEFLATED && inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+  {
+    CLog::LogF(LOGERROR, "Error initializing zlib!");
+    return false;
+  }
+
+  uLong crc = crc32(0, Z_NULL, 0);
+  uint64_t written = 0;
+  uint64_t remaining = entry.csize;
+  int ret = Z_OK;
+  bool ok = true;
+  while (ok && remaining > 0 && ret != Z_STREAM_END)
+  {
+    const size_t toRead = static_cast<size_t>(std::min<uint64_t>(remaining, in.size()));
+    if (archive.Read(in.data(), toRead) != static_cast<ssize_t>(toRead))
+    {
+      ok = false;
+      break;
+    }
+    remaining -= toRead;
+
+    if (entry.method == ZIP_METHOD_STORED)
+    {
+      crc = crc32(crc, reinterpret_cast<const Bytef*>(in.data()), static_cast<uInt>(toRead));
+      written += toRead;
+      ok = dest.Write(in.data(), toRead) == static_cast<ssize_t>(toRead);
       continue;
-    std::string strFilePath(it.name);
+    }
 
-    CURL zipPath = URIUtils::CreateArchivePath("zip", archive, strFilePath);
-    const CURL pathToUrl(strPath + strFilePath);
-    if (!CFile::Copy(zipPath, pathToUrl))
-      return false;
+    stream.next_in = reinterpret_cast<Bytef*>(in.data());
+    stream.avail_in = static_cast<uInt>(toRead);
+    do
+    {
+      stream.next_out = reinterpret_cast<Bytef*>(out.data());
+      stream.avail_out = static_cast<uInt>(out.size());
+      ret = inflate(&stream, Z_NO_FLUSH);
+      if (ret == Z_BUF_ERROR) // needs more input
+        break;
+      if (ret != Z_OK && ret != Z_STREAM_END)
+      {
+        CLog::LogF(LOGERROR, "Failed to decompress file {}. zlib error {}", entry.name, ret);
+        ok = false;
+        break;
+      }
+
+      const size_t produced = out.size() - stream.avail_out;
+      crc = crc32(crc, reinterpret_cast<const Bytef*>(out.data()), static_cast<uInt>(produced));
+      written += produced;
+      if (produced > 0 && dest.Write(out.data(), produced) != static_cast<ssize_t>(produced))
+        ok = false;
+    } while (ok && ret != Z_STREAM_END && (stream.avail_in > 0 || stream.avail_out == 0));
   }
-  return true;
+
+  if (entry.method == ZIP_METHOD_DEFLATED)
+  {
+    inflateEnd(&stream);
+    ok = ok && (ret == Z_STREAM_END || entry.usize == 0);
+  }
+
+  dest.Close();
+
+  if (ok && (written != entry.usize || crc != entry.crc32))
+  {
+    CLog::LogF(LOGERROR, "Checksum mismatch of file {}", entry.name);
+    ok = false;
+  }
+
+  if (!ok)
+  {
+    CLog::LogF(LOGERROR, "Failed to extract file {} to {}", entry.name,
+               CURL::GetRedacted(strPath));
+    CFile::Delete(strPath);
+  }
+
+  return ok;
 }
 
 // Read local file header
@@ -365,13 +535,8 @@ void CZipManager::readCHeader(const char* buffer, SZipEntry& info)
 void CZipManager::release(const std::string& strPath)
 {
   CURL url(strPath);
-  std::map<std::string, std::vector<SZipEntry> >::iterator it= mZipMap.find(url.GetHostName());
-  if (it != mZipMap.end())
-  {
-    std::map<std::string,int64_t>::iterator it2=mZipDate.find(url.GetHostName());
-    mZipMap.erase(it);
-    mZipDate.erase(it2);
-  }
+  std::unique_lock lock(m_critSection);
+  m_indexes.erase(url.GetHostName());
 }
 
 bool CZipManager::IsZip64(CFile& file)
@@ -8,10 +8,14 @@
 
 #pragma once
 
+#include "threads/CriticalSection.h"
+
 #include <cstdint>
 #include <cstring>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // See http://www.pkware.com/documents/casestudies/APPNOTE.TXT
@@ -71,7 +75,15 @@ public:
   bool GetZipList(const CURL& url, std::vector<SZipEntry>& items);
   bool GetZipEntry(const CURL& url, SZipEntry& item);
   bool ExtractArchive(const std::string& strArchive, const std::string& strPath);
-  bool ExtractArchive(const CURL& archive, const std::string& strPath);
+
+  /*!
+   \brief Extract an archive in a single pass over it, inflating every entry straight to its
+   destination and verifying its checksum.
+   \param strSubPath only extract the entries in this folder of the archive, relative to it
+   */
+  bool ExtractArchive(const CURL& archive,
+                      const std::string& strPath,
+                      const std::string& strSubPath = "");
   void release(const std::string& strPath); // release resources used by list zip
   static void readHeader(const char* buffer, SZipEntry& info);
   static void readCHeader(const char* buffer, SZipEntry& info);
@@ -80,8 +92,27 @@ public:
   static void ParseZip64ExtraField(const char* buf, uint16_t length, SZipEntry& info);
 
 private:
-  std::map<std::string,std::vector<SZipEntry> > mZipMap;
-  std::map<std::string, int64_t> mZipDate;
+  struct CIndex
+  {
+    int64_t mtime = 0;
+    std::vector<SZipEntry> entries;
+    std::unordered_map<std::string, size_t> names; // position of the entries by name
+  };
+
+  /*!
+   \brief Get the parsed central directory of an archive.
+   \param validate reparse the archive if it changed since it was parsed
+   */
+  std::shared_ptr<const CIndex> GetIndex(const CURL& url, bool validate);
+  static bool ReadIndex(const std::string& strFile, CIndex& index);
+  static bool ExtractEntry(XFILE::CFile& archive,
+                           const SZipEntry& entry,
+                           const std::string& strPath,
+                           std::vector<char>& in,
+                           std::vector<char>& out);
+
+  CCriticalSection m_critSection;
+  std::map<std::string, std::shared_ptr<const CIndex>> m_indexes;
 
   static bool ReadZip64EOCD(XFILE::CFile& file, uint64_t& cdirOffset, uint64_t& cdirSize);
 
@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "URL.h"
+#include "filesystem/DirectoryCache.h"
+#include "filesystem/IDirectory.h"
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace XFILE;
+
+namespace
+{
+void FillDirectory(CFileItemList& items, const std::string& path, int entries)
+{
+  items.SetPath(path);
+  for (int i = 0; i < entries; ++i)
+  {
+    const std::string name = path + "file" + std::to_string(i) + ".mkv";
+    items.Add(std::make_shared<CFileItem>(CURL(name), false));
+  }
+}
+} // unnamed namespace
+
+static void BM_DirectoryCache_SetDirectory(benchmark::State& state)
+{
+  CFileItemList items;
+  FillDirectory(items, "smb://server/share/Movies/", static_cast<int>(state.range(0)));
+  const CURL url(items.GetPath());
+
+  CDirectoryCache cache;
+  for (auto _ : state)
+    cache.SetDirectory(url, items, CacheType::ALWAYS);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DirectoryCache_SetDirectory)->Arg(100)->Arg(5000);
+
+static void BM_DirectoryCache_GetDirectory(benchmark::State& state)
+{
+  CFileItemList items;
+  FillDirectory(items, "smb://server/share/Movies/", static_cast<int>(state.range(0)));
+  const CURL url(items.GetPath());
+
+  CDirectoryCache cache;
+  cache.SetDirectory(url, items, CacheType::ALWAYS);
+  for (auto _ : state)
+  {
+    CFileItemList result;
+    benchmark::DoNotOptimize(cache.GetDirectory(url, result, true));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DirectoryCache_GetDirectory)->Arg(100)->Arg(5000);
+
+static void BM_DirectoryCache_FileExists(benchmark::State& state)
+{
+  CFileItemList items;
+  FillDirectory(items, "smb://server/share/Movies/", 5000);
+  CDirectoryCache cache;
+  cache.SetDirectory(CURL(items.GetPath()), items, CacheType::ALWAYS);
+
+  const CURL file("smb://server/share/Movies/file4999.mkv");
+  for (auto _ : state)
+  {
+    bool foundInCache = false;
+    benchmark::DoNotOptimize(cache.FileExists(file, foundInCache));
+  }
+}
+BENCHMARK(BM_DirectoryCache_FileExists);
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/CircularCache.h"
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr size_t FRONT_SIZE = 1024;
+constexpr size_t BACK_SIZE = 256;
+
+std::vector<char> MakeData(size_t size)
+{
+  std::vector<char> data(size);
+  std::iota(data.begin(), data.end(), 0);
+  return data;
+}
+} // namespace
+
+TEST(TestCircularCache, ReadSpanLendsCachedData)
+{
+  CCircularCache cache(FRONT_SIZE, BACK_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  const uint8_t* data = nullptr;
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, cache.ReadSpan(data, 100));
+
+  const auto input = MakeData(300);
+  ASSERT_EQ(300, cache.WriteToCache(input.data(), input.size()));
+
+  ASSERT_EQ(200, cache.ReadSpan(data, 200));
+  EXPECT_EQ(0, std::memcmp(data, input.data(), 200));
+
+  // only the consumed part is gone
+  cache.Release(150);
+  char rest[150];
+  ASSERT_EQ(150, cache.ReadFromCache(rest, sizeof(rest)));
+  EXPECT_EQ(0, std::memcmp(rest, input.data() + 150, sizeof(rest)));
+
+  cache.EndOfInput();
+  EXPECT_EQ(0, cache.ReadSpan(data, 100));
+}
+
+TEST(TestCircularCache, BorrowedDataIsNotOverwritten)
+{
+  CCircularCache cache(FRONT_SIZE, BACK_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  const auto input = MakeData(FRONT_SIZE);
+  ASSERT_EQ(static_cast<int>(FRONT_SIZE), cache.WriteToCache(input.data(), input.size()));
+
+  const uint8_t* data = nullptr;
+  ASSERT_EQ(static_cast<int>(FRONT_SIZE), cache.ReadSpan(data, FRONT_SIZE));
+
+  // the borrowed data still counts as forward data, only the back buffer space is writable
+  EXPECT_EQ(BACK_SIZE, cache.GetMaxWriteSize(FRONT_SIZE));
+  const auto more = MakeData(BACK_SIZE);
+  EXPECT_EQ(static_cast<int>(BACK_SIZE), cache.WriteToCache(more.data(), more.size()));
+  EXPECT_EQ(0u, cache.GetMaxWriteSize(FRONT_SIZE));
+  EXPECT_EQ(0, std::memcmp(data, input.data(), FRONT_SIZE));
+
+  cache.Release(FRONT_SIZE);
+  EXPECT_EQ(static_cast<size_t>(FRONT_SIZE - BACK_SIZE), cache.GetMaxWriteSize(FRONT_SIZE));
+}
+
+TEST(TestCircularCache, ReadSpanStopsAtWrapPoint)
+{
+  CCircularCache cache(FRONT_SIZE, BACK_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  // move the read position close to the end of the buffer
+  const auto input = MakeData(FRONT_SIZE + BACK_SIZE);
+  ASSERT_EQ(static_cast<int>(FRONT_SIZE), cache.WriteToCache(input.data(), FRONT_SIZE));
+  std::vector<char> skipped(FRONT_SIZE);
+  ASSERT_EQ(static_cast<int>(FRONT_SIZE), cache.ReadFromCache(skipped.data(), skipped.size()));
+  ASSERT_EQ(static_cast<int>(BACK_SIZE),
+            cache.WriteToCache(input.data() + FRONT_SIZE, BACK_SIZE));
+  ASSERT_EQ(100, cache.WriteToCache(input.data(), 100));
+
+  const uint8_t* data = nullptr;
+  ASSERT_EQ(static_cast<int>(BACK_SIZE), cache.ReadSpan(data, FRONT_SIZE));
+  EXPECT_EQ(0, std::memcmp(data, input.data() + FRONT_SIZE, BACK_SIZE));
+  cache.Release(BACK_SIZE);
+
+  ASSERT_EQ(100, cache.ReadSpan(data, FRONT_SIZE));
+  EXPECT_EQ(0, std::memcmp(data, input.data(), 100));
+  cache.Release(100);
+}
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "filesystem/CurlFile.h"
+#include "filesystem/File.h"
+#include "network/DNSNameCache.h"
+#include "network/WebServer.h"
+#include "network/httprequesthandler/HTTPVfsHandler.h"
+#include "settings/MediaSourceSettings.h"
+#include "test/TestUtils.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr const char* SOURCE_PATH = "xbmc/filesystem/test/data/httpdirectory/";
+constexpr const char* TEST_FILE = "lighttp-default.html";
+constexpr unsigned int CHUNK_SIZE = 1024;
+
+std::vector<char> ReadAll(CCurlFile& file, size_t size)
+{
+  std::vector<char> data(size);
+  size_t pos = 0;
+  while (pos < size)
+  {
+    const ssize_t read = file.Read(data.data() + pos, std::min<size_t>(size - pos, 700));
+    if (read <= 0)
+      break;
+    pos += read;
+  }
+  data.resize(pos);
+  return data;
+}
+} // namespace
+
+class TestCurlFile : public testing::Test
+{
+protected:
+  TestCurlFile() : m_sourcePath(XBMC_REF_FILE_PATH(SOURCE_PATH))
+  {
+    std::random_device rd;
+    std::mt19937 mt(rd());
+    std::uniform_int_distribution<uint16_t> dist(49152, 65535);
+    m_webServerPort = dist(mt);
+  }
+
+  void SetUp() override
+  {
+    CServiceBroker::RegisterDNSNameCache(std::make_shared<CDNSNameCache>());
+
+    CMediaSource source;
+    source.strName = "WebServer Share";
+    source.strPath = m_sourcePath;
+    source.vecPaths.push_back(m_sourcePath);
+    source.m_allowSharing = true;
+    source.m_iDriveType = SourceType::LOCAL;
+    source.GetLockInfo().SetMode(LockMode::EVERYONE);
+    source.m_ignore = true;
+    CMediaSourceSettings::GetInstance().AddShare("videos", source);
+
+    m_webServer.Start(m_webServerPort, "", "");
+    m_webServer.RegisterRequestHandler(&m_vfsHandler);
+  }
+
+  void TearDown() override
+  {
+    if (m_webServer.IsStarted())
+      m_webServer.Stop();
+
+    m_webServer.UnregisterRequestHandler(&m_vfsHandler);
+    CMediaSourceSettings::GetInstance().Clear();
+    CServiceBroker::UnregisterDNSNameCache();
+  }
+
+  std::string GetUrlOfTestFile() const
+  {
+    const std::string path = CURL::Encode(URIUtils::AddFileToFolder(m_sourcePath, TEST_FILE));
+    return StringUtils::Format("http://localhost:{}/vfs/{}", m_webServerPort, path);
+  }
+
+  std::vector<char> GetTestFileData() const
+  {
+    std::vector<uint8_t> data;
+    CFile file;
+    EXPECT_GT(file.LoadFile(URIUtils::AddFileToFolder(m_sourcePath, TEST_FILE), data), 0);
+    return {data.begin(), data.end()};
+  }
+
+  CWebServer m_webServer;
+  uint16_t m_webServerPort;
+  std::string m_sourcePath;
+  CHTTPVfsHandler m_vfsHandler;
+};
+
+TEST_F(TestCurlFile, ParallelRangesReadInOrder)
+{
+  const auto expected = GetTestFileData();
+  ASSERT_GT(expected.size(), 3 * CHUNK_SIZE);
+
+  CCurlFile file;
+  file.SetParallelRanges(3, CHUNK_SIZE);
+  ASSERT_TRUE(file.Open(CURL(GetUrlOfTestFile())));
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), file.GetLength());
+  ASSERT_EQ(0, file.IoControl(IOControl::SET_CACHE, nullptr));
+
+  EXPECT_EQ(expected, ReadAll(file, expected.size()));
+  EXPECT_EQ(static_cast<int64_t>(expected.size()), file.GetPosition());
+  EXPECT_EQ(0, file.Read(nullptr, 0));
+}
+
+TEST_F(TestCurlFile, ParallelRangesSeek)
+{
+  const auto expected = GetTestFileData();
+
+  CCurlFile file;
+  file.SetParallelRanges(3, CHUNK_SIZE);
+  ASSERT_TRUE(file.Open(CURL(GetUrlOfTestFile())));
+  ASSERT_EQ(0, file.IoControl(IOControl::SET_CACHE, nullptr));
+
+  // into the first chunk, then back from the end of the file into the middle and the start
+  const int64_t positions[] = {100, 2 * CHUNK_SIZE + 10, CHUNK_SIZE / 2};
+  for (const int64_t position : positions)
+  {
+    ASSERT_EQ(position, file.Seek(position, SEEK_SET));
+    const auto data = ReadAll(file, expected.size() - position);
+    ASSERT_EQ(expected.size() - position, data.size());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), expected.begin() + position));
+  }
+}
+
+TEST_F(TestCurlFile, ParallelRangesDisabledByDefault)
+{
+  CCurlFile file;
+  ASSERT_TRUE(file.Open(CURL(GetUrlOfTestFile())));
+  EXPECT_EQ(-1, file.IoControl(IOControl::SET_CACHE, nullptr));
+}
@@ -8,16 +8,33 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "ServiceBroker.h"
 #include "filesystem/Directory.h"
 #include "filesystem/DirectoryFactory.h"
+#include "filesystem/File.h"
 #include "filesystem/IDirectory.h"
+#include "filesystem/MultiPathDirectory.h"
 #include "filesystem/SpecialProtocol.h"
+#include "jobs/JobManager.h"
 #include "test/TestUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "video/VideoInfoTag.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
+namespace
+{
+void CreateFile(const std::string& path)
+{
+  XFILE::CFile file;
+  ASSERT_TRUE(file.OpenForWrite(path, true));
+  file.Close();
+}
+} // namespace
+
 TEST(TestDirectory, General)
 {
   std::string tmppath1, tmppath2, tmppath3;
@@ -58,6 +75,69 @@ TEST(TestDirectory, CreateRecursive)
   EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(path1));
 }
 
+TEST(TestDirectory, ItemsCallback)
+{
+  const auto path = URIUtils::AddFileToFolder(
+      CSpecialProtocol::TranslatePath("special://temp/"), "TestDirectoryItemsCallback");
+  ASSERT_TRUE(XFILE::CDirectory::Create(path));
+  for (int i = 0; i < 600; ++i)
+  {
+    const std::string name = StringUtils::Format("{:03}.{}", i, i % 2 ? "nfo" : "txt");
+    CreateFile(URIUtils::AddFileToFolder(path, name));
+  }
+
+  XFILE::CDirectory::CHints hints;
+  hints.mask = ".txt";
+  hints.flags = XFILE::DIR_FLAG_BYPASS_CACHE;
+  std::vector<std::string> reported;
+  hints.itemsCallback = [&reported](const CFileItemList& batch)
+  {
+    for (const auto& item : batch)
+      reported.emplace_back(item->GetPath());
+  };
+
+  CFileItemList items;
+  EXPECT_TRUE(XFILE::CDirectory::GetDirectory(path, items, hints));
+  EXPECT_EQ(300, items.Size());
+
+  // the preview is filtered like the listing, the last batch may be left for the listing itself
+  EXPECT_FALSE(reported.empty());
+  EXPECT_LE(reported.size(), 300u);
+  for (const auto& itemPath : reported)
+    EXPECT_TRUE(URIUtils::HasExtension(itemPath, ".txt")) << itemPath;
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(path));
+}
+
+TEST(TestDirectory, MultiPathKeepsOrder)
+{
+  CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+
+  const auto root = URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                              "TestDirectoryMultiPath");
+  std::vector<std::string> paths;
+  for (const char* name : {"c", "a", "d", "b"})
+  {
+    auto path = URIUtils::AddFileToFolder(root, name);
+    ASSERT_TRUE(XFILE::CDirectory::Create(path));
+    CreateFile(URIUtils::AddFileToFolder(path, std::string(name) + ".txt"));
+    URIUtils::AddSlashAtEnd(path);
+    paths.emplace_back(std::move(path));
+  }
+
+  CFileItemList items;
+  EXPECT_TRUE(XFILE::CDirectory::GetDirectory(XFILE::CMultiPathDirectory::ConstructMultiPath(paths),
+                                              items, "", XFILE::DIR_FLAG_BYPASS_CACHE));
+  ASSERT_EQ(4, items.Size());
+  for (int i = 0; i < items.Size(); ++i)
+    EXPECT_EQ(URIUtils::GetDirectory(items[i]->GetPath()), paths[i]);
+
+  EXPECT_TRUE(XFILE::CDirectory::RemoveRecursive(root));
+
+  CServiceBroker::GetJobManager()->CancelJobs();
+  CServiceBroker::UnregisterJobManager();
+}
+
 #ifdef HAVE_LIBBLURAY
 TEST(TestDirectory, BlurayResolve)
 {
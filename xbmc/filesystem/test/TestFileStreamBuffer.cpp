@@ -0,0 +1,134 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "filesystem/IFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+/*!
+ \brief File in memory which can lend its data like the file cache, and counts the copies made.
+ */
+class CLendingFile : public IFile
+{
+public:
+  CLendingFile(size_t size, bool canLend) : m_data(size), m_canLend(canLend)
+  {
+    std::iota(m_data.begin(), m_data.end(), 0);
+  }
+
+  bool Open(const CURL& url) override { return true; }
+  bool Exists(const CURL& url) override { return true; }
+  int Stat(const CURL& url, struct __stat64* buffer) override { return -1; }
+
+  ssize_t Read(void* bufPtr, size_t bufSize) override
+  {
+    const size_t size = std::min(bufSize, m_data.size() - m_pos);
+    std::memcpy(bufPtr, m_data.data() + m_pos, size);
+    m_pos += size;
+    m_copied += size;
+    return static_cast<ssize_t>(size);
+  }
+
+  ssize_t ReadSpan(const uint8_t*& data, size_t size) override
+  {
+    if (!m_canLend)
+      return -1;
+    data = m_data.data() + m_pos;
+    return static_cast<ssize_t>(std::min(size, m_data.size() - m_pos));
+  }
+
+  void ReleaseSpan(size_t consumed) override { m_pos += consumed; }
+
+  int64_t Seek(int64_t iFilePosition, int iWhence) override { return -1; }
+  void Close() override {}
+  int64_t GetPosition() override { return static_cast<int64_t>(m_pos); }
+  int64_t GetLength() override { return static_cast<int64_t>(m_data.size()); }
+  int GetChunkSize() override { return 1024; }
+
+  const uint8_t* GetData() const { return m_data.data(); }
+  size_t GetCopied() const { return m_copied; }
+
+private:
+  std::vector<uint8_t> m_data;
+  bool m_canLend;
+  size_t m_pos = 0;
+  size_t m_copied = 0;
+};
+} // namespace
+
+TEST(TestFileStreamBuffer, ReadSpanBypassesEmptyBuffer)
+{
+  CLendingFile file(4096, true);
+  CFileStreamBuffer buffer;
+  buffer.Attach(&file);
+
+  // the data is lent by the file, it isn't copied into the stream buffer first
+  const uint8_t* data = nullptr;
+  ASSERT_EQ(1000, buffer.ReadSpan(data, 1000));
+  EXPECT_EQ(file.GetData(), data);
+  buffer.ReleaseSpan(600);
+
+  ASSERT_EQ(1000, buffer.ReadSpan(data, 1000));
+  EXPECT_EQ(file.GetData() + 600, data);
+  buffer.ReleaseSpan(1000);
+  EXPECT_EQ(0u, file.GetCopied());
+
+  // reading continues where the borrowed data ended
+  char byte;
+  ASSERT_EQ(1, buffer.sgetn(&byte, 1));
+  EXPECT_EQ(static_cast<char>(file.GetData()[1600]), byte);
+
+  buffer.Detach();
+}
+
+TEST(TestFileStreamBuffer, ReadSpanLendsBufferedData)
+{
+  CLendingFile file(4096, true);
+  CFileStreamBuffer buffer;
+  buffer.Attach(&file);
+
+  // a read fills the buffer with a chunk, the rest of it is lent from the buffer
+  char bytes[100];
+  ASSERT_EQ(100, buffer.sgetn(bytes, sizeof(bytes)));
+  EXPECT_EQ(1024u, file.GetCopied());
+
+  const uint8_t* data = nullptr;
+  ASSERT_EQ(924, buffer.ReadSpan(data, 2000));
+  EXPECT_EQ(0, std::memcmp(data, file.GetData() + 100, 924));
+  buffer.ReleaseSpan(924);
+
+  // then from the file
+  ASSERT_EQ(2000, buffer.ReadSpan(data, 2000));
+  EXPECT_EQ(file.GetData() + 1024, data);
+  buffer.ReleaseSpan(2000);
+  EXPECT_EQ(1024u, file.GetCopied());
+
+  buffer.Detach();
+}
+
+TEST(TestFileStreamBuffer, ReadSpanUnsupported)
+{
+  CLendingFile file(4096, false);
+  CFileStreamBuffer buffer;
+  buffer.Attach(&file);
+
+  const uint8_t* data = nullptr;
+  EXPECT_EQ(-1, buffer.ReadSpan(data, 1000));
+
+  buffer.Detach();
+}
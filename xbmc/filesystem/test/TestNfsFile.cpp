@@ -10,8 +10,12 @@
 #include "filesystem/NFSFile.h"
 #include "test/TestUtils.h"
 
+#include <chrono>
 #include <errno.h>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -82,3 +86,128 @@ TEST_P(TestNfs, splitUrlIntoExportAndPath)
 }
 
 INSTANTIATE_TEST_SUITE_P(NfsFile, TestNfs, ValuesIn(g_TestData));
+
+namespace
+{
+/*!
+ \brief Pool which "mounts" contexts without a server.
+ */
+class CTestNfsConnection : public CNfsConnection
+{
+public:
+  void Evict(std::chrono::steady_clock::duration maxIdle)
+  {
+    std::unique_lock lock(*this);
+    EvictIdle(maxIdle);
+  }
+
+protected:
+  std::shared_ptr<CNfsContext> CreateContext(const std::string& id,
+                                             const CURL& url,
+                                             const std::string& exportPath) override
+  {
+    return std::make_shared<CNfsContext>(nullptr, id, url.GetHostName(), exportPath);
+  }
+
+  std::list<std::string> QueryExportList(const CURL& url) override { return {"/srv"}; }
+  unsigned int GetMaxContexts() const override { return 2; }
+};
+
+const CURL FILE_URL("nfs://192.168.0.1/srv/movie.mkv");
+} // namespace
+
+TEST(TestNfsPool, OpenFilesShareContext)
+{
+  CTestNfsConnection pool;
+  std::string relativePath;
+
+  std::vector<CNfsConnection::CLease> files;
+  for (int i = 0; i < 4; ++i)
+    files.emplace_back(pool.AcquireShared(FILE_URL, relativePath));
+
+  EXPECT_EQ("//movie.mkv", relativePath);
+  for (const auto& file : files)
+  {
+    ASSERT_TRUE(file);
+    EXPECT_EQ(files.front().Get(), file.Get());
+  }
+
+  const CNfsConnection::PoolStats stats = pool.GetPoolStats();
+  EXPECT_EQ(1u, stats.created);
+  EXPECT_EQ(3u, stats.reused);
+  EXPECT_EQ(1u, stats.shared);
+  EXPECT_EQ(0u, stats.inUse);
+}
+
+TEST(TestNfsPool, OpenFilesDontBlockLeases)
+{
+  CTestNfsConnection pool;
+  std::string relativePath;
+
+  std::vector<CNfsConnection::CLease> files;
+  for (int i = 0; i < 4; ++i)
+    files.emplace_back(pool.AcquireShared(FILE_URL, relativePath));
+
+  // more files open than the limit of contexts, a stat still gets one right away
+  CNfsConnection::CLease first = pool.Acquire(FILE_URL, relativePath);
+  CNfsConnection::CLease second = pool.Acquire(FILE_URL, relativePath);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  EXPECT_NE(files.front().Get(), first.Get());
+
+  CNfsConnection::PoolStats stats = pool.GetPoolStats();
+  EXPECT_EQ(0u, stats.waits);
+  EXPECT_EQ(0u, stats.overflows);
+  EXPECT_EQ(2u, stats.inUse);
+
+  // released contexts are reused
+  const std::shared_ptr<CNfsContext> released = first.Get();
+  first.Release();
+  CNfsConnection::CLease third = pool.Acquire(FILE_URL, relativePath);
+  EXPECT_EQ(released, third.Get());
+
+  stats = pool.GetPoolStats();
+  EXPECT_EQ(3u, stats.created);
+  EXPECT_EQ(0u, stats.waits);
+}
+
+TEST(TestNfsPool, SharedContextEvictedWhenUnused)
+{
+  CTestNfsConnection pool;
+  std::string relativePath;
+
+  CNfsConnection::CLease file = pool.AcquireShared(FILE_URL, relativePath);
+  const CNfsContext* context = file.Get().get();
+
+  // an open file keeps the context
+  pool.Evict(std::chrono::seconds(0));
+  EXPECT_EQ(1u, pool.GetPoolStats().shared);
+
+  // it's kept for the next file after closing
+  file.Release();
+  file = pool.AcquireShared(FILE_URL, relativePath);
+  EXPECT_EQ(context, file.Get().get());
+  file.Release();
+
+  pool.Evict(std::chrono::seconds(0));
+  const CNfsConnection::PoolStats stats = pool.GetPoolStats();
+  EXPECT_EQ(0u, stats.shared);
+  EXPECT_EQ(1u, stats.evicted);
+}
+
+TEST(TestNfsPool, SharedContextDroppedOnError)
+{
+  CTestNfsConnection pool;
+  std::string relativePath;
+
+  CNfsConnection::CLease file = pool.AcquireShared(FILE_URL, relativePath);
+  CNfsConnection::CLease other = pool.AcquireShared(FILE_URL, relativePath);
+  const std::shared_ptr<CNfsContext> expired = file.Get();
+
+  // the next file mounts a new context, the other file keeps the old one until it's closed
+  file.Release(false);
+  file = pool.AcquireShared(FILE_URL, relativePath);
+  EXPECT_NE(expired, file.Get());
+  EXPECT_EQ(expired, other.Get());
+  EXPECT_EQ(2u, pool.GetPoolStats().created);
+}
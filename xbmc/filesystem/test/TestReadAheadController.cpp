@@ -0,0 +1,250 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/IFile.h"
+#include "filesystem/ReadAheadController.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr uint32_t KiB = 1024;
+constexpr uint32_t MiB = 1024 * 1024;
+constexpr unsigned int CHUNK_SIZE = 128 * KiB;
+constexpr int64_t MAX_FORWARD = 64 * MiB;
+
+/*!
+ \brief Source delivering data at a rate following a repeating profile, driven by a virtual clock.
+ */
+class CSimulatedFile : public IFile
+{
+public:
+  struct Phase
+  {
+    std::chrono::milliseconds duration;
+    uint32_t rate; // bytes/second, 0 stalls
+  };
+
+  explicit CSimulatedFile(std::vector<Phase> profile) : m_profile(std::move(profile)) {}
+
+  bool Open(const CURL& url) override { return true; }
+  bool Exists(const CURL& url) override { return true; }
+  int Stat(const CURL& url, struct __stat64* buffer) override { return -1; }
+  void Close() override {}
+  int64_t Seek(int64_t iFilePosition, int iWhence) override { return -1; }
+  int64_t GetPosition() override { return m_position; }
+  int64_t GetLength() override { return 0; }
+
+  ssize_t Read(void* lpBuf, size_t uiBufSize) override
+  {
+    const size_t read = std::min<size_t>(uiBufSize, static_cast<size_t>(m_available));
+    m_available -= read;
+    m_position += read;
+    return read;
+  }
+
+  void Advance(std::chrono::milliseconds step)
+  {
+    m_elapsed += step;
+    const Phase& phase = GetPhase();
+    // the source only has a limited buffer of its own, like a socket
+    m_available = std::min(m_available + phase.rate * step.count() / 1000.0, 4.0 * MiB);
+  }
+
+  uint32_t GetRate() const { return GetPhase().rate; }
+
+private:
+  const Phase& GetPhase() const
+  {
+    std::chrono::milliseconds cycle{0};
+    for (const auto& phase : m_profile)
+      cycle += phase.duration;
+
+    auto offset = m_elapsed % cycle;
+    for (const auto& phase : m_profile)
+    {
+      if (offset < phase.duration)
+        return phase;
+      offset -= phase.duration;
+    }
+    return m_profile.back();
+  }
+
+  std::vector<Phase> m_profile;
+  std::chrono::milliseconds m_elapsed{0};
+  double m_available = 0;
+  int64_t m_position = 0;
+};
+
+/*!
+ \brief Runs the fill loop of CFileCache against a simulated source and a constant rate consumer.
+ */
+class CSimulation
+{
+public:
+  CSimulation(CSimulatedFile& source, uint32_t consumeRate)
+    : m_source(source), m_consumeRate(consumeRate), m_controller(MAX_FORWARD, CHUNK_SIZE)
+  {
+  }
+
+  void Run(std::chrono::seconds duration)
+  {
+    const auto end = m_now + duration;
+    while (m_now < end)
+      Step();
+  }
+
+  CReadAheadController& GetController() { return m_controller; }
+  int64_t GetForward() const { return m_writePos - m_readPos; }
+  int64_t GetMaxForward() const { return m_maxForward; }
+  unsigned int GetStalls() const { return m_stalls; }
+
+private:
+  static constexpr std::chrono::milliseconds STEP{10};
+
+  void Step()
+  {
+    m_now += STEP;
+    m_source.Advance(STEP);
+
+    // the player starts consuming after prebuffering a couple of seconds
+    const int64_t want = m_consumeRate * STEP.count() / 1000;
+    if (!m_playing && GetForward() >= 2 * static_cast<int64_t>(m_consumeRate))
+      m_playing = true;
+    if (m_playing)
+    {
+      if (GetForward() < want)
+      {
+        ++m_stalls;
+        m_playing = false;
+      }
+      m_readPos += std::min(want, GetForward());
+    }
+
+    m_controller.Update(m_readPos, GetForward(), m_now);
+
+    // the read rate applies to this step only, as the limiter of CFileCache does over time
+    int64_t budget = MAX_FORWARD - GetForward();
+    if (GetForward() >= m_controller.GetMinForward())
+      budget = std::min<int64_t>(budget, m_controller.GetReadRate() * STEP.count() / 1000);
+
+    while (budget > 0)
+    {
+      std::vector<char> buffer(std::min<int64_t>(budget, CHUNK_SIZE));
+      const ssize_t read = m_source.Read(buffer.data(), buffer.size());
+      m_controller.OnSourceRead(read, GetReadTime(read, buffer.size()));
+      m_writePos += read;
+      budget -= read;
+      if (read < static_cast<ssize_t>(buffer.size()))
+        break;
+    }
+    m_maxForward = std::max(m_maxForward, GetForward());
+  }
+
+  std::chrono::steady_clock::duration GetReadTime(ssize_t read, size_t requested) const
+  {
+    // a short read waited for the source for the whole step
+    const uint32_t rate = m_source.GetRate();
+    if (read < static_cast<ssize_t>(requested) || rate == 0)
+      return STEP;
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(read) / rate));
+  }
+
+  CSimulatedFile& m_source;
+  const uint32_t m_consumeRate;
+  CReadAheadController m_controller;
+  std::chrono::steady_clock::time_point m_now;
+  int64_t m_readPos = 0;
+  int64_t m_writePos = 0;
+  int64_t m_maxForward = 0;
+  bool m_playing = false;
+  unsigned int m_stalls = 0;
+};
+} // namespace
+
+TEST(TestReadAheadController, UnknownRateFillsCache)
+{
+  CReadAheadController controller(MAX_FORWARD, CHUNK_SIZE);
+  controller.Update(0, 0, std::chrono::steady_clock::time_point{});
+
+  EXPECT_EQ(0u, controller.GetConsumeRate());
+  EXPECT_EQ(MAX_FORWARD, controller.GetTargetForward());
+  EXPECT_GT(controller.GetReadRate(), 0u);
+}
+
+TEST(TestReadAheadController, RateHintIsLowerBound)
+{
+  CReadAheadController controller(MAX_FORWARD, CHUNK_SIZE);
+  controller.SetRateHint(MiB);
+  EXPECT_EQ(MiB, controller.GetConsumeRate());
+
+  // reading slower than the stream bitrate, e.g. while paused, doesn't shrink the cache
+  std::chrono::steady_clock::time_point now;
+  for (int64_t pos = 0; pos < 20 * KiB; pos += KiB)
+  {
+    now += 1s;
+    controller.Update(pos, MAX_FORWARD / 2, now);
+  }
+  EXPECT_EQ(MiB, controller.GetConsumeRate());
+}
+
+TEST(TestReadAheadController, LowBitrateDoesNotOverfill)
+{
+  CSimulatedFile source({{1s, 5 * MiB}});
+  CSimulation simulation(source, 40 * KiB); // 320 kbit/s audio
+  simulation.Run(300s);
+
+  // only the data fetched until the rate was measured exceeds the target
+  const int64_t target = simulation.GetController().GetTargetForward();
+  EXPECT_EQ(0u, simulation.GetStalls());
+  EXPECT_LT(target, 2 * MiB);
+  EXPECT_LT(simulation.GetMaxForward(), MAX_FORWARD / 8);
+  EXPECT_LE(simulation.GetForward(), target + CHUNK_SIZE);
+  EXPECT_NEAR(40.0 * KiB, simulation.GetController().GetConsumeRate(), 2.0 * KiB);
+}
+
+TEST(TestReadAheadController, HighBitrateUsesWholeCache)
+{
+  // 80 Mbit/s remux on a source that is barely faster and stalls every few seconds
+  CSimulatedFile source({{4s, 16 * MiB}, {1s, 0}});
+  CSimulation simulation(source, 10 * MiB);
+  simulation.Run(120s);
+
+  EXPECT_EQ(MAX_FORWARD, simulation.GetController().GetTargetForward());
+  EXPECT_GT(simulation.GetMaxForward(), MAX_FORWARD / 2);
+  EXPECT_EQ(0u, simulation.GetController().GetUnderruns());
+}
+
+TEST(TestReadAheadController, UnderrunGrowsTarget)
+{
+  // fast source with long outages
+  CSimulatedFile source({{15s, 8 * MiB}, {15s, 0}});
+  CSimulation simulation(source, MiB);
+  simulation.Run(10s);
+
+  const int64_t initialTarget = simulation.GetController().GetTargetForward();
+  EXPECT_LT(initialTarget, 15 * MiB);
+
+  simulation.Run(170s);
+
+  EXPECT_GE(simulation.GetController().GetUnderruns(), 1u);
+  EXPECT_GT(simulation.GetController().GetTargetForward(), initialTarget);
+  // once the target covers an outage, playback doesn't stall anymore
+  const unsigned int stalls = simulation.GetStalls();
+  simulation.Run(120s);
+  EXPECT_EQ(stalls, simulation.GetStalls());
+}
@@ -0,0 +1,226 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/FileCache.h"
+#include "filesystem/SegmentCache.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr size_t SEGMENT_SIZE = 1024;
+constexpr const char* CACHE_PATH = "special://temp/segmentcachetest/";
+constexpr const char* SOURCE_PATH = "special://temp/segmentcachetest.bin";
+
+std::vector<char> MakeData(size_t size)
+{
+  std::vector<char> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<char>(i * 7 + i / SEGMENT_SIZE);
+  return data;
+}
+
+std::vector<char> ReadAll(CSegmentCache& cache, size_t size)
+{
+  std::vector<char> data(size);
+  size_t pos = 0;
+  while (pos < size)
+  {
+    const int read = cache.ReadFromCache(data.data() + pos, size - pos);
+    if (read <= 0)
+      break;
+    pos += read;
+  }
+  data.resize(pos);
+  return data;
+}
+
+std::vector<char> ReadAll(CFileCache& cache, size_t size)
+{
+  std::vector<char> data(size);
+  size_t pos = 0;
+  while (pos < size)
+  {
+    const ssize_t read = cache.Read(data.data() + pos, size - pos);
+    if (read <= 0)
+      break;
+    pos += read;
+  }
+  data.resize(pos);
+  return data;
+}
+} // namespace
+
+class TestSegmentCache : public ::testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    CDirectory::RemoveRecursive(CACHE_PATH);
+    CFile::Delete(SOURCE_PATH);
+  }
+};
+
+TEST_F(TestSegmentCache, StoreEvictsLeastRecentlyUsed)
+{
+  CSegmentCacheStore store(CACHE_PATH, 2 * SEGMENT_SIZE, SEGMENT_SIZE);
+  const auto data = MakeData(SEGMENT_SIZE);
+
+  EXPECT_TRUE(store.Add("a", 0, data.data(), data.size()));
+  EXPECT_TRUE(store.Add("b", 0, data.data(), data.size()));
+  store.Touch("a", 0);
+  EXPECT_TRUE(store.Add("c", 0, data.data(), data.size()));
+
+  EXPECT_EQ(2 * SEGMENT_SIZE, store.GetSize());
+  EXPECT_TRUE(store.GetSegments("a", 1)[0]);
+  EXPECT_FALSE(store.GetSegments("b", 1)[0]);
+  EXPECT_TRUE(store.GetSegments("c", 1)[0]);
+}
+
+TEST_F(TestSegmentCache, StoreKeepsPinnedSegments)
+{
+  CSegmentCacheStore store(CACHE_PATH, 2 * SEGMENT_SIZE, SEGMENT_SIZE);
+  const auto data = MakeData(SEGMENT_SIZE);
+  const int owner = 0;
+
+  store.Pin(&owner, "a", 1);
+  EXPECT_TRUE(store.Add("a", 0, data.data(), data.size()));
+  EXPECT_TRUE(store.Add("a", 1, data.data(), data.size()));
+  EXPECT_TRUE(store.Add("b", 0, data.data(), data.size()));
+
+  const auto segments = store.GetSegments("a", 2);
+  EXPECT_FALSE(segments[0]);
+  EXPECT_TRUE(segments[1]);
+
+  store.Unpin(&owner);
+}
+
+TEST_F(TestSegmentCache, StoreReloadsSegments)
+{
+  const auto data = MakeData(SEGMENT_SIZE);
+  {
+    CSegmentCacheStore store(CACHE_PATH, 4 * SEGMENT_SIZE, SEGMENT_SIZE);
+    EXPECT_TRUE(store.Add("a", 0, data.data(), data.size()));
+    EXPECT_TRUE(store.Add("a", 2, data.data(), data.size()));
+  }
+
+  CSegmentCacheStore store(CACHE_PATH, 4 * SEGMENT_SIZE, SEGMENT_SIZE);
+  EXPECT_EQ(std::vector<bool>({true, false, true}), store.GetSegments("a", 3));
+  EXPECT_EQ(2 * SEGMENT_SIZE, store.GetSize());
+}
+
+TEST_F(TestSegmentCache, ReopenReadsFromDisk)
+{
+  CSegmentCacheStore store(CACHE_PATH, 16 * SEGMENT_SIZE, SEGMENT_SIZE);
+  const size_t fileSize = 2 * SEGMENT_SIZE + SEGMENT_SIZE / 2;
+  const auto data = MakeData(fileSize);
+
+  {
+    CSegmentCache cache(store, "file", fileSize, 16 * SEGMENT_SIZE);
+    ASSERT_EQ(CACHE_RC_OK, cache.Open());
+    EXPECT_EQ(0, cache.CachedDataEndPosIfSeekTo(0));
+
+    // write in chunks that don't line up with the segments
+    for (size_t pos = 0; pos < fileSize; pos += 700)
+    {
+      const size_t size = std::min<size_t>(700, fileSize - pos);
+      ASSERT_EQ(static_cast<int>(size), cache.WriteToCache(data.data() + pos, size));
+    }
+    cache.EndOfInput();
+    EXPECT_EQ(data, ReadAll(cache, fileSize));
+  }
+
+  EXPECT_EQ(fileSize, store.GetSize());
+
+  CSegmentCache cache(store, "file", fileSize, 16 * SEGMENT_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+  EXPECT_EQ(static_cast<int64_t>(fileSize), cache.CachedDataEndPosIfSeekTo(0));
+  EXPECT_FALSE(cache.Reset(0));
+  EXPECT_EQ(static_cast<int64_t>(fileSize), cache.CachedDataEndPos());
+  EXPECT_EQ(data, ReadAll(cache, fileSize));
+
+  const int64_t position = SEGMENT_SIZE + 100;
+  EXPECT_EQ(position, cache.Seek(position));
+  const auto tail = ReadAll(cache, fileSize - position);
+  EXPECT_TRUE(std::equal(tail.begin(), tail.end(), data.begin() + position));
+}
+
+TEST_F(TestSegmentCache, UnalignedDataIsNotStored)
+{
+  CSegmentCacheStore store(CACHE_PATH, 16 * SEGMENT_SIZE, SEGMENT_SIZE);
+  const size_t fileSize = 3 * SEGMENT_SIZE;
+  const auto data = MakeData(fileSize);
+
+  CSegmentCache cache(store, "file", fileSize, 16 * SEGMENT_SIZE);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  // start writing in the middle of the first segment, as after a seek to an uncached position
+  const int64_t start = SEGMENT_SIZE / 2;
+  EXPECT_TRUE(cache.Reset(start));
+  EXPECT_EQ(start, cache.CachedDataEndPos());
+
+  const size_t size = fileSize - start;
+  EXPECT_EQ(static_cast<int>(SEGMENT_SIZE - start), cache.WriteToCache(data.data() + start, size));
+
+  // the partial segment has to be read before the buffer can be reused
+  EXPECT_EQ(0u, cache.GetMaxWriteSize(SEGMENT_SIZE));
+  EXPECT_EQ(static_cast<size_t>(SEGMENT_SIZE - start), ReadAll(cache, SEGMENT_SIZE - start).size());
+  EXPECT_EQ(static_cast<int>(2 * SEGMENT_SIZE),
+            cache.WriteToCache(data.data() + SEGMENT_SIZE, 2 * SEGMENT_SIZE));
+
+  EXPECT_EQ(std::vector<bool>({false, true, true}), store.GetSegments("file", 3));
+}
+
+TEST_F(TestSegmentCache, FileCacheContinuesBehindStoredSegments)
+{
+  CSegmentCacheStore store(CACHE_PATH, 16 * SEGMENT_SIZE, SEGMENT_SIZE);
+  const size_t fileSize = 4 * SEGMENT_SIZE;
+  const auto data = MakeData(fileSize);
+  {
+    CFile source;
+    ASSERT_TRUE(source.OpenForWrite(SOURCE_PATH, true));
+    ASSERT_EQ(static_cast<ssize_t>(fileSize), source.Write(data.data(), fileSize));
+  }
+
+  // the first two segments are left from an earlier session
+  EXPECT_TRUE(store.Add("file", 0, data.data(), SEGMENT_SIZE));
+  EXPECT_TRUE(store.Add("file", 1, data.data() + SEGMENT_SIZE, SEGMENT_SIZE));
+
+  CFileCache cache(0, std::make_unique<CSegmentCache>(store, "file", fileSize, 16 * SEGMENT_SIZE));
+  ASSERT_TRUE(cache.Open(CURL(SOURCE_PATH)));
+
+  // the reader starts at the beginning of the stored data, not behind it
+  const auto head = ReadAll(cache, SEGMENT_SIZE / 2);
+  ASSERT_EQ(static_cast<size_t>(SEGMENT_SIZE / 2), head.size());
+  EXPECT_TRUE(std::equal(head.begin(), head.end(), data.begin()));
+
+  // seeking past the stored data waits for the source instead of serving stale data
+  int64_t position = 3 * SEGMENT_SIZE + 100;
+  ASSERT_EQ(position, cache.Seek(position, SEEK_SET));
+  auto tail = ReadAll(cache, fileSize - position);
+  ASSERT_EQ(fileSize - position, tail.size());
+  EXPECT_TRUE(std::equal(tail.begin(), tail.end(), data.begin() + position));
+
+  // and seeking a second time does too
+  position = SEGMENT_SIZE + 100;
+  ASSERT_EQ(position, cache.Seek(position, SEEK_SET));
+  tail = ReadAll(cache, fileSize - position);
+  ASSERT_EQ(fileSize - position, tail.size());
+  EXPECT_TRUE(std::equal(tail.begin(), tail.end(), data.begin() + position));
+
+  cache.Close();
+}
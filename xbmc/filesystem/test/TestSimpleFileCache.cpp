@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/CacheStrategy.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+std::vector<char> MakeData(size_t size)
+{
+  std::vector<char> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<char>(i * 7 + i / 251);
+  return data;
+}
+} // namespace
+
+TEST(TestSimpleFileCache, WriteAndReadBackLargeChunks)
+{
+  CSimpleFileCache cache;
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  // chunks larger than a single write to the cache file, as with a 1 MB filecache.chunksize
+  const auto data = MakeData(3 * 1024 * 1024 + 123);
+  constexpr size_t CHUNK_SIZE = 1024 * 1024;
+  for (size_t pos = 0; pos < data.size(); pos += CHUNK_SIZE)
+  {
+    const size_t size = std::min(CHUNK_SIZE, data.size() - pos);
+    ASSERT_EQ(static_cast<int>(size), cache.WriteToCache(data.data() + pos, size));
+  }
+  cache.EndOfInput();
+
+  std::vector<char> read(data.size());
+  size_t pos = 0;
+  while (pos < read.size())
+  {
+    ASSERT_GT(cache.WaitForData(1, 5s), 0);
+    const int bytes =
+        cache.ReadFromCache(read.data() + pos, std::min(CHUNK_SIZE, read.size() - pos));
+    ASSERT_GT(bytes, 0);
+    pos += bytes;
+  }
+  EXPECT_EQ(data, read);
+  EXPECT_EQ(0, cache.ReadFromCache(read.data(), 1));
+
+  cache.Close();
+}
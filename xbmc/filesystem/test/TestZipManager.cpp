@@ -6,11 +6,48 @@
  *  See LICENSES/README.md for more information.
  */
 
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
 #include "filesystem/ZipManager.h"
+#include "test/TestUtils.h"
 #include "utils/RegExp.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+using namespace XFILE;
+
+namespace
+{
+std::string ReadFile(const std::string& path)
+{
+  std::vector<uint8_t> buffer;
+  CFile file;
+  if (file.LoadFile(path, buffer) <= 0)
+    return {};
+  return std::string(buffer.begin(), buffer.end());
+}
+} // namespace
+
+class TestZipManagerExtract : public ::testing::Test
+{
+protected:
+  TestZipManagerExtract()
+    : m_dest(URIUtils::AddFileToFolder("special://temp/",
+                                       "zipextract-" + StringUtils::CreateUUID(), ""))
+  {
+  }
+
+  ~TestZipManagerExtract() override { CDirectory::RemoveRecursive(m_dest); }
+
+  std::string m_dest;
+};
+
 TEST(TestZipManager, PathTraversal)
 {
   CRegExp pathTraversal;
@@ -28,3 +65,63 @@ TEST(TestZipManager, PathTraversal)
   ASSERT_FALSE(pathTraversal.RegFind("test.txt..") >= 0);
   ASSERT_FALSE(pathTraversal.RegFind("test..test.txt") >= 0);
 }
+
+TEST(TestZipManager, GetZipEntry)
+{
+  const CURL archive(XBMC_REF_FILE_PATH("xbmc/filesystem/test/addon.zip"));
+
+  SZipEntry entry;
+  ASSERT_TRUE(g_ZipManager.GetZipEntry(
+      URIUtils::CreateArchivePath("zip", archive, "plugin.test/resources/data.txt"), entry));
+  EXPECT_EQ(0, entry.method);
+  EXPECT_EQ(12u, entry.usize);
+
+  EXPECT_FALSE(g_ZipManager.GetZipEntry(
+      URIUtils::CreateArchivePath("zip", archive, "plugin.test/missing.txt"), entry));
+}
+
+TEST_F(TestZipManagerExtract, ExtractArchive)
+{
+  const std::string archive = XBMC_REF_FILE_PATH("xbmc/filesystem/test/addon.zip");
+  ASSERT_TRUE(g_ZipManager.ExtractArchive(archive, m_dest));
+
+  EXPECT_TRUE(CDirectory::Exists(URIUtils::AddFileToFolder(m_dest, "plugin.test/")));
+  const std::string addon = ReadFile(URIUtils::AddFileToFolder(m_dest, "plugin.test/addon.xml"));
+  EXPECT_EQ(1847u, addon.size());
+  EXPECT_TRUE(addon.starts_with("<?xml"));
+  EXPECT_EQ("stored data\n",
+            ReadFile(URIUtils::AddFileToFolder(m_dest, "plugin.test/resources/data.txt")));
+}
+
+TEST_F(TestZipManagerExtract, ExtractSubPath)
+{
+  const CURL archive(XBMC_REF_FILE_PATH("xbmc/filesystem/test/addon.zip"));
+  ASSERT_TRUE(g_ZipManager.ExtractArchive(archive, m_dest, "plugin.test"));
+
+  EXPECT_FALSE(CDirectory::Exists(URIUtils::AddFileToFolder(m_dest, "plugin.test/")));
+  EXPECT_TRUE(CFile::Exists(URIUtils::AddFileToFolder(m_dest, "addon.xml")));
+  EXPECT_EQ("stored data\n", ReadFile(URIUtils::AddFileToFolder(m_dest, "resources/data.txt")));
+}
+
+TEST_F(TestZipManagerExtract, ExtractMatchesZipFile)
+{
+  // entries with data descriptors and ZIP64 archives are extracted like they are read
+  for (const char* file : {"xbmc/filesystem/test/extendedlocalheader.zip",
+                           "xbmc/filesystem/test/reffile.txt.zip64.zip"})
+  {
+    const CURL archive(XBMC_REF_FILE_PATH(file));
+    ASSERT_TRUE(g_ZipManager.ExtractArchive(archive, m_dest));
+
+    std::vector<SZipEntry> entries;
+    ASSERT_TRUE(g_ZipManager.GetZipList(URIUtils::CreateArchivePath("zip", archive, ""), entries));
+    ASSERT_FALSE(entries.empty());
+    for (const auto& entry : entries)
+    {
+      const std::string extracted = ReadFile(URIUtils::AddFileToFolder(m_dest, entry.name));
+      EXPECT_EQ(entry.usize, extracted.size()) << entry.name;
+      EXPECT_EQ(
+          ReadFile(URIUtils::CreateArchivePath("zip", archive, entry.name).Get()), extracted)
+          << entry.name;
+    }
+  }
+}
@@ -44,6 +44,7 @@
 #include "settings/windows/GUIWindowSettingsScreenCalibration.h"
 #include "threads/SingleLock.h"
 #include "utils/StringUtils.h"
+#include "utils/TraceEvents.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
@@ -1262,6 +1263,7 @@ bool RenderOrderSortFunction(const std::shared_ptr<CGUIWindow>& first,
 
 void CGUIWindowManager::Process(unsigned int currentTime)
 {
+  KODI_TRACE_SCOPE("gui", "CGUIWindowManager::Process");
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
@@ -1403,6 +1405,7 @@ void CGUIWindowManager::RenderEx() const
 
 bool CGUIWindowManager::Render()
 {
+  KODI_TRACE_SCOPE("gui", "CGUIWindowManager::Render");
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
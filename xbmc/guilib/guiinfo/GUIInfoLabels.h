@@ -166,6 +166,15 @@ constexpr uint32_t SYSTEM_HDD_LOCKKEY                = 158;
 constexpr uint32_t SYSTEM_INTERNET_STATE             = 159;
 constexpr uint32_t SYSTEM_HAS_INPUT_HIDDEN           = 160;
 constexpr uint32_t SYSTEM_HAS_PVR_ADDON              = 161;
+constexpr uint32_t SYSTEM_FRAMETIME_P50              = 162;
+constexpr uint32_t SYSTEM_FRAMETIME_P95              = 163;
+constexpr uint32_t SYSTEM_FRAMETIME_P99              = 164;
+constexpr uint32_t SYSTEM_FRAMETIME_MAX              = 165;
+constexpr uint32_t SYSTEM_MISSED_VSYNCS              = 166;
+constexpr uint32_t SYSTEM_PROCESS_TIME               = 167;
+constexpr uint32_t SYSTEM_FRAMEMOVE_TIME             = 168;
+constexpr uint32_t SYSTEM_RENDER_TIME                = 169;
+constexpr uint32_t SYSTEM_SWAP_TIME                  = 170;
 
 constexpr uint32_t SYSTEM_ALARM_LESS_OR_EQUAL        = 180;
 constexpr uint32_t SYSTEM_PROFILECOUNT               = 181;
@@ -17,6 +17,7 @@
 #include "addons/addoninfo/AddonType.h"
 #include "application/AppParams.h"
 #include "application/ApplicationComponents.h"
+#include "application/ApplicationFrameStatistics.h"
 #include "application/ApplicationPowerHandling.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
@@ -249,6 +250,57 @@ bool CSystemGUIInfo::GetLabel(std::string& value,
     case SYSTEM_FPS:
       value = StringUtils::Format("{:02.2f}", m_fps);
       return true;
+    case SYSTEM_FRAMETIME_P50:
+    case SYSTEM_FRAMETIME_P95:
+    case SYSTEM_FRAMETIME_P99:
+    case SYSTEM_FRAMETIME_MAX:
+    case SYSTEM_MISSED_VSYNCS:
+    case SYSTEM_PROCESS_TIME:
+    case SYSTEM_FRAMEMOVE_TIME:
+    case SYSTEM_RENDER_TIME:
+    case SYSTEM_SWAP_TIME:
+    {
+      using Stage = CApplicationFrameStatistics::Stage;
+
+      const auto frameStats =
+          CServiceBroker::GetAppComponents().GetComponent<CApplicationFrameStatistics>();
+      const auto summary = frameStats->GetSummary();
+      switch (info.GetInfo())
+      {
+        case SYSTEM_FRAMETIME_P50:
+          value = StringUtils::Format("{:.2f}", summary.p50Ms);
+          return true;
+        case SYSTEM_FRAMETIME_P95:
+          value = StringUtils::Format("{:.2f}", summary.p95Ms);
+          return true;
+        case SYSTEM_FRAMETIME_P99:
+          value = StringUtils::Format("{:.2f}", summary.p99Ms);
+          return true;
+        case SYSTEM_FRAMETIME_MAX:
+          value = StringUtils::Format("{:.2f}", summary.maxMs);
+          return true;
+        case SYSTEM_MISSED_VSYNCS:
+          value = std::to_string(summary.missedVsyncs);
+          return true;
+        case SYSTEM_PROCESS_TIME:
+          value = StringUtils::Format(
+              "{:.2f}", summary.stageAverageMs[static_cast<size_t>(Stage::PROCESS)]);
+          return true;
+        case SYSTEM_FRAMEMOVE_TIME:
+          value = StringUtils::Format(
+              "{:.2f}", summary.stageAverageMs[static_cast<size_t>(Stage::FRAME_MOVE)]);
+          return true;
+        case SYSTEM_RENDER_TIME:
+          value = StringUtils::Format(
+              "{:.2f}", summary.stageAverageMs[static_cast<size_t>(Stage::RENDER)]);
+          return true;
+        case SYSTEM_SWAP_TIME:
+          value = StringUtils::Format(
+              "{:.2f}", summary.stageAverageMs[static_cast<size_t>(Stage::SWAP)]);
+          return true;
+      }
+      break;
+    }
 #ifdef HAS_OPTICAL_DRIVE
     case SYSTEM_DVD_LABEL:
       value = CServiceBroker::GetMediaManager().GetDiskLabel();
@@ -20,14 +20,46 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/LockProfiler.h"
 #include "utils/JSONVariantParser.h"
 #include "utils/StringUtils.h"
+#include "utils/TraceEvents.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
 #include <stdlib.h>
 
+/*! \brief Log the most contended critical sections.
+ *  \param params The parameters.
+ *  \details params[0] = Maximum number of sections to log (optional, default 20).
+ */
+static int DumpLockStatistics(const std::vector<std::string>& params)
+{
+  using XbmcThreads::CLockProfiler;
+
+  if (!CLockProfiler::IsEnabled())
+  {
+    CLog::Log(LOGWARNING, "DumpLockStatistics: lock profiling is not enabled in this build");
+    return -1;
+  }
+
+  const size_t limit = params.empty() ? 20 : std::atoi(params[0].c_str());
+  CLog::Log(LOGINFO, "DumpLockStatistics: most contended critical sections");
+  for (const auto& statistics : CLockProfiler::GetInstance().GetTopContended(limit))
+  {
+    CLog::Log(LOGINFO,
+              "  {}{}: {} instances, {} acquisitions ({} shared), {} contended, wait total {} us "
+              "max {} us, hold total {} us max {} us",
+              statistics.name, statistics.shared ? " [shared]" : "", statistics.instances,
+              statistics.acquisitions, statistics.sharedAcquisitions, statistics.contentions,
+              statistics.waitTotal.count(), statistics.waitMax.count(),
+              statistics.holdTotal.count(), statistics.holdMax.count());
+  }
+
+  return 0;
+}
+
 /*! \brief Extract an archive.
  *  \param params The parameters
  *  \details params[0] = The archive URL.
@@ -113,6 +145,41 @@ static int SetVolume(const std::vector<std::string>& params)
   return 0;
 }
 
+/*! \brief Start recording trace events.
+ *  \param params (ignored)
+ */
+static int StartTracing(const std::vector<std::string>& params)
+{
+  using KODI::UTILS::CTraceRecorder;
+
+  if (!CTraceRecorder::IsEnabled())
+  {
+    CLog::Log(LOGWARNING, "StartTracing: trace events are not enabled in this build");
+    return -1;
+  }
+
+  CTraceRecorder::GetInstance().Start();
+  return 0;
+}
+
+/*! \brief Stop recording trace events and write them to a file.
+ *  \param params The parameters.
+ *  \details params[0] = Path of the trace file (optional, default special://temp/trace.json).
+ */
+static int StopTracing(const std::vector<std::string>& params)
+{
+  using KODI::UTILS::CTraceRecorder;
+
+  if (!CTraceRecorder::IsEnabled())
+  {
+    CLog::Log(LOGWARNING, "StopTracing: trace events are not enabled in this build");
+    return -1;
+  }
+
+  const std::string path = params.empty() ? "special://temp/trace.json" : params[0];
+  return CTraceRecorder::GetInstance().Stop(path) ? 0 : -1;
+}
+
 /*! \brief Toggle debug info.
  *  \param params (ignored)
  */
@@ -160,6 +227,13 @@ static int WakeOnLAN(const std::vector<std::string>& params)
 ///     Function,
 ///     Description }
 ///   \table_row2_l{
+///     <b>`DumpLockStatistics([limit])`</b>
+///     ,
+///     Logs the most contended critical sections. Only available in builds
+///     with lock profiling enabled.
+///     @param[in] limit                 Maximum number of sections to log (optional\, default 20).
+///   }
+///   \table_row2_l{
 ///     <b>`Extract(url [\, dest])`</b>
 ///     ,
 ///     Extracts a specified archive to an optionally specified 'absolute' path.
@@ -189,6 +263,19 @@ static int WakeOnLAN(const std::vector<std::string>& params)
 ///     @param[in] showvolumebar         Add "showVolumeBar" to show volume bar (optional).
 ///   }
 ///   \table_row2_l{
+///     <b>`StartTracing`</b>
+///     ,
+///     Starts recording trace events of the GUI\, player\, audio engine and job
+///     workers. Only available in builds with trace events enabled.
+///   }
+///   \table_row2_l{
+///     <b>`StopTracing([file])`</b>
+///     ,
+///     Stops recording trace events and writes them to a trace event JSON file\,
+///     which can be opened in Perfetto.
+///     @param[in] file                  Path of the trace file (optional\, default special://temp/trace.json).
+///   }
+///   \table_row2_l{
 ///     <b>`ToggleDebug`</b>
 ///     ,
 ///     Toggles debug mode on/off
@@ -211,10 +298,13 @@ static int WakeOnLAN(const std::vector<std::string>& params)
 CBuiltins::CommandMap CApplicationBuiltins::GetOperations() const
 {
   return {
+           {"dumplockstatistics", {"Logs the most contended critical sections", 0, DumpLockStatistics}},
            {"extract", {"Extracts the specified archive", 1, Extract}},
            {"mute", {"Mute the player", 0, Mute}},
            {"notifyall", {"Notify all connected clients", 2, NotifyAll}},
            {"setvolume", {"Set the current volume", 1, SetVolume}},
+           {"starttracing", {"Starts recording trace events", 0, StartTracing}},
+           {"stoptracing", {"Stops recording trace events and writes them to a file", 0, StopTracing}},
            {"toggledebug", {"Enables/disables debug mode", 0, ToggleDebug}},
            {"toggledpms", {"Toggle DPMS mode manually", 0, ToggleDPMS}},
            {"wakeonlan", {"Sends the wake-up packet to the broadcast address for the specified MAC address", 1, WakeOnLAN}}
@@ -258,7 +258,13 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
 
 // XBMC operations
   { "XBMC.GetInfoLabels",                           CXBMCOperations::GetInfoLabels },
-  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans }
+  { "XBMC.GetInfoBooleans",                         CXBMCOperations::GetInfoBooleans },
+  { "XBMC.GetJobStatistics",                        CXBMCOperations::GetJobStatistics },
+  { "XBMC.GetLockStatistics",                       CXBMCOperations::GetLockStatistics },
+  { "XBMC.GetFrameStatistics",                      CXBMCOperations::GetFrameStatistics },
+  { "XBMC.ResetJobStatistics",                      CXBMCOperations::ResetJobStatistics },
+  { "XBMC.ResetLockStatistics",                     CXBMCOperations::ResetLockStatistics },
+  { "XBMC.ResetFrameStatistics",                    CXBMCOperations::ResetFrameStatistics }
 };
 
 // clang-format on
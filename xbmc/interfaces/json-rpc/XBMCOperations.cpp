@@ -9,8 +9,12 @@
 #include "XBMCOperations.h"
 
 #include "ServiceBroker.h"
+#include "application/ApplicationComponents.h"
+#include "application/ApplicationFrameStatistics.h"
+#include "jobs/JobManager.h"
 #include "messaging/ApplicationMessenger.h"
 #include "powermanagement/PowerManager.h"
+#include "threads/LockProfiler.h"
 #include "utils/Variant.h"
 
 using namespace JSONRPC;
@@ -86,3 +90,88 @@ JSONRPC_STATUS CXBMCOperations::GetInfoBooleans(const std::string &method, ITran
 
   return OK;
 }
+
+JSONRPC_STATUS CXBMCOperations::GetJobStatistics(const std::string& method,
+                                                 ITransportLayer* transport,
+                                                 IClient* client,
+                                                 const CVariant& parameterObject,
+                                                 CVariant& result)
+{
+  CServiceBroker::GetJobManager()->GetStatistics().Serialize(result);
+  return OK;
+}
+
+JSONRPC_STATUS CXBMCOperations::GetLockStatistics(const std::string& method,
+                                                  ITransportLayer* transport,
+                                                  IClient* client,
+                                                  const CVariant& parameterObject,
+                                                  CVariant& result)
+{
+  using XbmcThreads::CLockProfiler;
+
+  result["enabled"] = CLockProfiler::IsEnabled();
+  result["sections"] = CVariant(CVariant::VariantTypeArray);
+
+  CLockProfiler& profiler = CLockProfiler::GetInstance();
+  const auto limit = static_cast<size_t>(parameterObject["limit"].asUnsignedInteger());
+  for (const auto& statistics : profiler.GetTopContended(limit))
+  {
+    CVariant section(CVariant::VariantTypeObject);
+    section["name"] = statistics.name;
+    section["shared"] = statistics.shared;
+    section["instances"] = statistics.instances;
+    section["acquisitions"] = statistics.acquisitions;
+    section["sharedacquisitions"] = statistics.sharedAcquisitions;
+    section["contentions"] = statistics.contentions;
+    section["waittotalus"] = static_cast<int64_t>(statistics.waitTotal.count());
+    section["waitmaxus"] = static_cast<int64_t>(statistics.waitMax.count());
+    section["holdtotalus"] = static_cast<int64_t>(statistics.holdTotal.count());
+    section["holdmaxus"] = static_cast<int64_t>(statistics.holdMax.count());
+    result["sections"].push_back(std::move(section));
+  }
+
+  return OK;
+}
+
+JSONRPC_STATUS CXBMCOperations::GetFrameStatistics(const std::string& method,
+                                                   ITransportLayer* transport,
+                                                   IClient* client,
+                                                   const CVariant& parameterObject,
+                                                   CVariant& result)
+{
+  const auto frameStats =
+      CServiceBroker::GetAppComponents().GetComponent<CApplicationFrameStatistics>();
+  frameStats->Serialize(result);
+
+  return OK;
+}
+
+JSONRPC_STATUS CXBMCOperations::ResetJobStatistics(const std::string& method,
+                                                   ITransportLayer* transport,
+                                                   IClient* client,
+                                                   const CVariant& parameterObject,
+                                                   CVariant& result)
+{
+  CServiceBroker::GetJobManager()->GetStatistics().Reset();
+  return ACK;
+}
+
+JSONRPC_STATUS CXBMCOperations::ResetLockStatistics(const std::string& method,
+                                                    ITransportLayer* transport,
+                                                    IClient* client,
+                                                    const CVariant& parameterObject,
+                                                    CVariant& result)
+{
+  XbmcThreads::CLockProfiler::GetInstance().Reset();
+  return ACK;
+}
+
+JSONRPC_STATUS CXBMCOperations::ResetFrameStatistics(const std::string& method,
+                                                     ITransportLayer* transport,
+                                                     IClient* client,
+                                                     const CVariant& parameterObject,
+                                                     CVariant& result)
+{
+  CServiceBroker::GetAppComponents().GetComponent<CApplicationFrameStatistics>()->Reset();
+  return ACK;
+}
@@ -10,11 +10,14 @@
 
 #include "jobs/IJobCallback.h"
 #include "threads/Thread.h"
+#include "utils/TraceEvents.h"
 #include "utils/log.h"
 
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <iterator>
+#include <limits>
 #include <mutex>
 #include <optional>
 #include <stdexcept>
@@ -22,6 +25,14 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+// lane of the work-stealing backend owned by the calling worker thread, if any
+thread_local size_t t_workerLane = std::numeric_limits<size_t>::max();
+// lane the job processed by the calling worker thread was taken from
+thread_local size_t t_jobLane = std::numeric_limits<size_t>::max();
+} // unnamed namespace
+
 bool CJob::ShouldCancel(unsigned int progress, unsigned int total) const
 {
   if (m_progressCallback)
@@ -39,7 +50,10 @@ size_t CJob::GetPendingCallbackCount() const
 class CJobManager::CJobWorker : private CThread
 {
 public:
-  explicit CJobWorker(CJobManager& manager) : CThread("JobWorker"), m_jobManager(manager)
+  CJobWorker(CJobManager& manager, size_t lane)
+    : CThread("JobWorker"),
+      m_jobManager(manager),
+      m_lane(lane)
   {
     Create(true); // start work immediately, and kill ourselves when we're done
   }
@@ -54,6 +68,7 @@ public:
   void Process() override
   {
     SetPriority(ThreadPriority::LOWEST);
+    t_workerLane = m_lane;
     while (true)
     {
       // request an item from our manager (this call is blocking)
@@ -64,6 +79,7 @@ public:
       bool success{false};
       try
       {
+        KODI_TRACE_SCOPE("jobs", *job->GetType() ? job->GetType() : "CJob::DoWork");
         success = job->DoWork();
       }
       catch (...)
@@ -76,6 +92,7 @@ public:
 
 private:
   CJobManager& m_jobManager;
+  size_t m_lane{0};
 };
 
 struct CJobManager::JobFinder
@@ -86,9 +103,14 @@ struct CJobManager::JobFinder
   const CJob* m_job{nullptr};
 };
 
+CJobManager::CJobManager()
+{
+  for (size_t i = 0; i < GetLaneCount(); ++i)
+    m_lanes.emplace_back(std::make_unique<CWorkLane>());
+}
+
 bool CJobManager::IsRunning() const
 {
-  std::unique_lock lock(m_section);
   return m_running;
 }
 
@@ -101,33 +123,96 @@ void CJobManager::Restart()
   m_running = true;
 }
 
+void CJobManager::SetWorkStealing(bool enable)
+{
+  std::unique_lock lock(m_section);
+
+  if (m_workStealing == enable)
+    return;
+
+  // AddJob() checks the backend again under the lock of the queue it adds to, so jobs added
+  // meanwhile aren't left behind in the queues of the previous backend
+  if (enable)
+  {
+    // distribute the queued jobs over the lanes, keeping their order within each lane
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
+         ++priority)
+    {
+      for (auto& wi : m_jobQueue[priority])
+      {
+        CWorkLane& lane = *m_lanes[m_nextLane++ % m_lanes.size()];
+        std::unique_lock laneLock(lane.m_section);
+        lane.m_queues[priority].emplace_back(std::move(wi));
+      }
+      m_jobQueue[priority].clear();
+    }
+    m_workStealing = true;
+  }
+  else
+  {
+    m_workStealing = false;
+
+    // collect the queued jobs back into the global queues, restoring submission order
+    for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
+         ++priority)
+    {
+      for (auto& lane : m_lanes)
+      {
+        std::unique_lock laneLock(lane->m_section);
+        std::ranges::move(lane->m_queues[priority], std::back_inserter(m_jobQueue[priority]));
+        lane->m_queues[priority].clear();
+      }
+      std::ranges::stable_sort(m_jobQueue[priority], {}, &CWorkItem::GetId);
+    }
+  }
+
+  CLog::Log(LOGDEBUG, "CJobManager: using {} scheduling",
+            enable ? "work-stealing" : "global queue");
+}
+
 void CJobManager::CancelJobs()
 {
   std::unique_lock lock(m_section);
   m_running = false;
 
+  const auto abortJob = [this](CWorkItem& wi)
+  {
+    m_statistics.OnCancelled(wi.GetStatistics(), true);
+    for (auto* callback : wi.GetCallbacks())
+      callback->OnJobAbort(wi.GetId(), wi.GetJob());
+    wi.FreeJob();
+  };
+
   // clear any pending jobs
   for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
        ++priority)
   {
-    std::ranges::for_each(m_jobQueue[priority],
-                          [](CWorkItem& wi)
-                          {
-                            for (auto* callback : wi.GetCallbacks())
-                              callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                            wi.FreeJob();
-                          });
+    std::ranges::for_each(m_jobQueue[priority], abortJob);
     m_jobQueue[priority].clear();
   }
 
   // cancel any callbacks on jobs still processing
-  std::ranges::for_each(m_processing,
-                        [](CWorkItem& wi)
-                        {
-                          for (auto* callback : wi.GetCallbacks())
-                            callback->OnJobAbort(wi.GetId(), wi.GetJob());
-                          wi.Cancel();
-                        });
+  const auto cancelJob = [this](CWorkItem& wi)
+  {
+    if (!wi.GetCallbacks().empty())
+      m_statistics.OnCancelled(wi.GetStatistics(), false);
+    for (auto* callback : wi.GetCallbacks())
+      callback->OnJobAbort(wi.GetId(), wi.GetJob());
+    wi.Cancel();
+  };
+
+  for (auto& lane : m_lanes)
+  {
+    std::unique_lock laneLock(lane->m_section);
+    for (auto& queue : lane->m_queues)
+    {
+      std::ranges::for_each(queue, abortJob);
+      queue.clear();
+    }
+    std::ranges::for_each(lane->m_processing, cancelJob);
+  }
+
+  std::ranges::for_each(m_processing, cancelJob);
 
   // tell our workers to finish
   while (!m_workers.empty())
@@ -141,6 +226,9 @@ void CJobManager::CancelJobs()
 
 unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORITY priority)
 {
+  if (m_workStealing)
+    return AddJobToLanes(job, callback, priority);
+
   std::unique_lock lock(m_section);
 
   if (!m_running)
@@ -149,9 +237,17 @@ unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORI
     return 0;
   }
 
+  // the backend was switched while waiting for the lock
+  if (m_workStealing)
+  {
+    lock.unlock();
+    return AddJobToLanes(job, callback, priority);
+  }
+
+  const auto equalJob = [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); };
+
   // Check if we have this job already in the queue - if so, add callback to existing job
-  auto it = std::ranges::find_if(m_jobQueue[priority],
-                                 [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); });
+  auto it = std::ranges::find_if(m_jobQueue[priority], equalJob);
   if (it != m_jobQueue[priority].end())
   {
     it->AddCallback(callback);
@@ -163,8 +259,7 @@ unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORI
   // Note: Jobs that have moved to completion phase (removed from m_processing)
   // won't be found here, causing a new job to be created. This is intentional -
   // the completing job's results are about to be delivered to existing callbacks.
-  auto procIt = std::ranges::find_if(m_processing, [job](const CWorkItem& wi)
-                                     { return wi.GetJob()->Equals(job); });
+  auto procIt = std::ranges::find_if(m_processing, equalJob);
   if (procIt != m_processing.end())
   {
     procIt->AddCallback(callback);
@@ -172,17 +267,87 @@ unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORI
     return procIt->GetId();
   }
 
-  // increment the job counter, ensuring 0 (invalid job) is never hit
-  m_jobCounter++;
-  if (m_jobCounter == 0)
-    m_jobCounter++;
-
   // create a work item for this job
-  CWorkItem work(job, m_jobCounter, priority, callback);
-  m_jobQueue[priority].emplace_back(work);
+  const unsigned int id = NextJobId();
+  CJobTypeStatistics& stats = m_statistics.GetType(job->GetType());
+  m_statistics.OnQueued(stats);
+  m_jobQueue[priority].emplace_back(job, id, priority, callback, stats);
 
   StartWorkers(priority);
-  return work.GetId();
+  return id;
+}
+
+unsigned int CJobManager::AddJobToLanes(CJob* job, IJobCallback* callback, CJob::PRIORITY priority)
+{
+  if (!m_running)
+  {
+    delete job;
+    return 0;
+  }
+
+  const auto equalJob = [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); };
+
+  // Check if an equal job is queued or processing in any lane - if so, add callback to it.
+  // Lanes are checked one at a time, so an equal job added concurrently by another thread can be
+  // missed. It's processed twice then, as one added right after the other completed would be.
+  for (auto& lane : m_lanes)
+  {
+    std::unique_lock laneLock(lane->m_section);
+    auto it = std::ranges::find_if(lane->m_queues[priority], equalJob);
+    if (it != lane->m_queues[priority].end())
+    {
+      it->AddCallback(callback);
+      delete job;
+      return it->GetId();
+    }
+    auto procIt = std::ranges::find_if(lane->m_processing, equalJob);
+    if (procIt != lane->m_processing.end())
+    {
+      procIt->AddCallback(callback);
+      delete job;
+      return procIt->GetId();
+    }
+  }
+
+  const unsigned int id = NextJobId();
+  CJobTypeStatistics& stats = m_statistics.GetType(job->GetType());
+
+  // workers queue follow-up jobs on their own lane, other threads spread them over all lanes
+  const size_t laneIndex =
+      t_workerLane < m_lanes.size() ? t_workerLane : m_nextLane++ % m_lanes.size();
+  CWorkLane& lane = *m_lanes[laneIndex];
+  {
+    std::unique_lock laneLock(lane.m_section);
+
+    // CancelJobs() stops the manager before clearing the lanes
+    if (!m_running)
+    {
+      delete job;
+      return 0;
+    }
+
+    // SetWorkStealing() switches the backend before collecting the lanes
+    if (!m_workStealing)
+    {
+      laneLock.unlock();
+      return AddJob(job, callback, priority);
+    }
+
+    m_statistics.OnQueued(stats);
+    lane.m_queues[priority].emplace_back(job, id, priority, callback, stats);
+  }
+
+  StartWorkers(priority);
+  return id;
+}
+
+unsigned int CJobManager::NextJobId()
+{
+  // increment the job counter, ensuring 0 (invalid job) is never hit
+  unsigned int id = ++m_jobCounter;
+  if (id == 0)
+    id = ++m_jobCounter;
+  return id;
 }
 
 void CJobManager::CancelJob(unsigned int jobID)
@@ -199,38 +364,80 @@ void CJobManager::CancelJob(unsigned int jobID)
     {
       CWorkItem item(std::move(*i));
       m_jobQueue[priority].erase(i);
+      m_statistics.OnCancelled(item.GetStatistics(), true);
       item.FreeJob();
       return;
     }
   }
+  // or if it's queued in one of the work-stealing lanes
+  for (auto& lane : m_lanes)
+  {
+    std::unique_lock laneLock(lane->m_section);
+    for (auto& queue : lane->m_queues)
+    {
+      const auto i =
+          std::ranges::find_if(queue, [jobID](const auto& wi) { return wi.GetId() == jobID; });
+      if (i != queue.cend())
+      {
+        CWorkItem item(std::move(*i));
+        queue.erase(i);
+        m_statistics.OnCancelled(item.GetStatistics(), true);
+        item.FreeJob();
+        return;
+      }
+    }
+    const auto it = std::ranges::find_if(lane->m_processing,
+                                         [jobID](const auto& wi) { return wi.GetId() == jobID; });
+    if (it != lane->m_processing.cend())
+    {
+      // job is in progress, so only thing to do is to remove all callbacks
+      m_statistics.OnCancelled(it->GetStatistics(), false);
+      it->Cancel();
+      return;
+    }
+  }
   // or if we're processing it
   const auto it =
       std::ranges::find_if(m_processing, [jobID](const auto& wi) { return wi.GetId() == jobID; });
   if (it != m_processing.cend())
-    it->Cancel(); // job is in progress, so only thing to do is to remove all callbacks
+  {
+    // job is in progress, so only thing to do is to remove all callbacks
+    m_statistics.OnCancelled(it->GetStatistics(), false);
+    it->Cancel();
+  }
 }
 
 void CJobManager::StartWorkers(CJob::PRIORITY priority)
 {
-  std::unique_lock lock(m_section);
-
   // check how many free threads we have
-  if (m_processing.size() >= GetMaxWorkers(priority))
+  if (m_processingCount >= GetMaxWorkers(priority))
     return;
 
   // do we have any sleeping threads?
-  if (m_processing.size() < m_workers.size())
+  if (m_processingCount < m_workerCount)
   {
     m_jobEvent.Set();
     return;
   }
 
-  // everyone is busy - we need more workers
-  m_workers.emplace_back(new CJobWorker(*this));
+  // everyone is busy - we need more workers, unless another thread just started one
+  std::unique_lock lock(m_section);
+  if (m_processingCount < m_workers.size())
+  {
+    m_jobEvent.Set();
+    return;
+  }
+
+  m_workers.emplace_back(new CJobWorker(*this, m_workers.size() % GetLaneCount()));
+  m_workerCount = m_workers.size();
+  m_statistics.OnWorkerCountChanged(m_workers.size());
 }
 
 CJob* CJobManager::PopJob()
 {
+  if (m_workStealing)
+    return PopJobFromLanes(t_workerLane < m_lanes.size() ? t_workerLane : 0);
+
   std::unique_lock lock(m_section);
   for (int priority = CJob::PRIORITY_DEDICATED; priority >= CJob::PRIORITY_LOW_PAUSABLE; --priority)
   {
@@ -242,11 +449,13 @@ CJob* CJobManager::PopJob()
         m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
     {
       // pop the job off the queue
-      const CWorkItem job{m_jobQueue[priority].front()};
+      CWorkItem job{m_jobQueue[priority].front()};
       m_jobQueue[priority].pop_front();
+      m_statistics.OnStarted(job.GetStatistics(), job.Start());
 
       // add to the processing vector
       m_processing.emplace_back(job);
+      ++m_processingCount;
       job.GetJob()->SetProgressCallback(this);
       return job.GetJob();
     }
@@ -254,6 +463,53 @@ CJob* CJobManager::PopJob()
   return nullptr;
 }
 
+CJob* CJobManager::PopJobFromLanes(size_t lane)
+{
+  const size_t laneCount = m_lanes.size();
+  for (int priority = CJob::PRIORITY_DEDICATED; priority >= CJob::PRIORITY_LOW_PAUSABLE; --priority)
+  {
+    // Check whether we're pausing pausable jobs
+    if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
+      continue;
+
+    // reserve a processing slot for this priority before looking for work
+    const size_t maxWorkers = GetMaxWorkers(CJob::PRIORITY(priority));
+    size_t processing = m_processingCount;
+    do
+    {
+      if (processing >= maxWorkers)
+        break;
+    } while (!m_processingCount.compare_exchange_weak(processing, processing + 1));
+    if (processing >= maxWorkers)
+      continue;
+
+    // own lane first, then steal from the other lanes - always the oldest job, so that the jobs
+    // queued by one thread start in order and none waits behind newer ones
+    for (size_t i = 0; i < laneCount; ++i)
+    {
+      const size_t index = (lane + i) % laneCount;
+      CWorkLane& candidate = *m_lanes[index];
+      std::unique_lock laneLock(candidate.m_section);
+      JobQueue& queue = candidate.m_queues[priority];
+      if (queue.empty())
+        continue;
+
+      CWorkItem item{std::move(queue.front())};
+      queue.pop_front();
+      m_statistics.OnStarted(item.GetStatistics(), item.Start());
+
+      CJob* job = item.GetJob();
+      job->SetProgressCallback(this);
+      candidate.m_processing.emplace_back(std::move(item));
+      t_jobLane = index;
+      return job;
+    }
+
+    --m_processingCount;
+  }
+  return nullptr;
+}
+
 void CJobManager::PauseJobs()
 {
   std::unique_lock lock(m_section);
@@ -264,6 +520,8 @@ void CJobManager::UnPauseJobs()
 {
   std::unique_lock lock(m_section);
   m_pauseJobs = false;
+  // sleeping workers don't notice jobs queued while paused otherwise
+  m_jobEvent.Set();
 }
 
 bool CJobManager::IsProcessing(const CJob::PRIORITY& priority) const
@@ -273,37 +531,47 @@ bool CJobManager::IsProcessing(const CJob::PRIORITY& priority) const
   if (m_pauseJobs && priority == CJob::PRIORITY::PRIORITY_LOW_PAUSABLE)
     return false;
 
-  return std::ranges::any_of(m_processing,
-                             [priority](const auto& wi) { return wi.GetPriority() == priority; });
+  const auto hasPriority = [priority](const auto& wi) { return wi.GetPriority() == priority; };
+  if (std::ranges::any_of(m_processing, hasPriority))
+    return true;
+
+  return std::ranges::any_of(m_lanes,
+                             [&hasPriority](const auto& lane)
+                             {
+                               std::unique_lock laneLock(lane->m_section);
+                               return std::ranges::any_of(lane->m_processing, hasPriority);
+                             });
 }
 
 int CJobManager::IsProcessing(const std::string& type) const
 {
   std::unique_lock lock(m_section);
 
-  return static_cast<int>(std::ranges::count_if(
-      m_processing,
-      [this, &type](const auto& wi)
-      {
-        return (!m_pauseJobs || wi.GetPriority() != CJob::PRIORITY::PRIORITY_LOW_PAUSABLE) &&
-               (std::string(wi.GetJob()->GetType()) == type);
-      }));
+  const auto isType = [this, &type](const auto& wi)
+  {
+    return (!m_pauseJobs || wi.GetPriority() != CJob::PRIORITY::PRIORITY_LOW_PAUSABLE) &&
+           (std::string(wi.GetJob()->GetType()) == type);
+  };
+
+  auto count = std::ranges::count_if(m_processing, isType);
+  for (const auto& lane : m_lanes)
+  {
+    std::unique_lock laneLock(lane->m_section);
+    count += std::ranges::count_if(lane->m_processing, isType);
+  }
+  return static_cast<int>(count);
 }
 
 CJob* CJobManager::GetNextJob()
 {
-  std::unique_lock lock(m_section);
-  while (m_running)
+  while (IsRunning())
   {
     // grab a job off the queue if we have one
     CJob* job = PopJob();
     if (job)
       return job;
     // no jobs are left - sleep for 30 seconds to allow new jobs to come in
-    lock.unlock();
-    bool newJob = m_jobEvent.Wait(30000ms);
-    lock.lock();
-    if (!newJob)
+    if (!m_jobEvent.Wait(30000ms))
       break;
   }
   // ensure no jobs have come in during the period after
@@ -311,51 +579,116 @@ CJob* CJobManager::GetNextJob()
   return PopJob();
 }
 
-bool CJobManager::OnJobProgress(unsigned int progress, unsigned int total, const CJob* job) const
+std::optional<CJobManager::CWorkItem> CJobManager::FindProcessing(const CJob* job) const
 {
-  std::unique_lock lock(m_section);
-  // find the job in the processing queue, and check whether it's cancelled (no callbacks)
-  const auto i = std::ranges::find_if(m_processing, JobFinder(job));
-  if (i != m_processing.cend())
+  const auto findInLanes = [this, job]() -> std::optional<CWorkItem>
   {
-    CWorkItem item(*i);
-    lock.unlock(); // leave section prior to call
-    if (!item.GetCallbacks().empty())
+    // the lane the calling worker took its job from first
+    const size_t first = t_jobLane < m_lanes.size() ? t_jobLane : 0;
+    for (size_t i = 0; i < m_lanes.size(); ++i)
     {
-      for (auto* callback : item.GetCallbacks())
-        callback->OnJobProgress(item.GetId(), progress, total, job);
-      return false;
+      CWorkLane& lane = *m_lanes[(first + i) % m_lanes.size()];
+      std::unique_lock laneLock(lane.m_section);
+      const auto it = std::ranges::find_if(lane.m_processing, JobFinder(job));
+      if (it != lane.m_processing.cend())
+        return *it;
     }
+    return {};
+  };
+
+  // jobs started before switching the backend are still processing in the queue of the other one
+  if (m_workStealing)
+  {
+    if (auto item = findInLanes())
+      return item;
   }
-  return true; // couldn't find the job, or it's been cancelled
+
+  {
+    std::unique_lock lock(m_section);
+    const auto it = std::ranges::find_if(m_processing, JobFinder(job));
+    if (it != m_processing.cend())
+      return *it;
+  }
+
+  if (!m_workStealing)
+    return findInLanes();
+  return {};
 }
 
-void CJobManager::OnJobComplete(bool success, CJob* job)
+std::optional<CJobManager::CWorkItem> CJobManager::TakeProcessing(const CJob* job)
 {
-  std::optional<CWorkItem> item = [&, this]
+  // Move work item out of the processing queue to avoid iterator invalidation
+  // when another thread modifies it during callback execution
+  const auto takeFrom = [job](Processing& processing) -> std::optional<CWorkItem>
   {
-    std::unique_lock lock(m_section);
-    std::optional<CWorkItem> item;
-    auto i = std::ranges::find_if(m_processing, JobFinder(job));
-    if (i != m_processing.end())
+    auto it = std::ranges::find_if(processing, JobFinder(job));
+    if (it == processing.end())
+      return {};
+    std::optional<CWorkItem> item{std::move(*it)};
+    processing.erase(it);
+    return item;
+  };
+
+  const auto takeFromLanes = [this, &takeFrom]() -> std::optional<CWorkItem>
+  {
+    // the lane the calling worker took its job from first
+    const size_t first = t_jobLane < m_lanes.size() ? t_jobLane : 0;
+    for (size_t i = 0; i < m_lanes.size(); ++i)
     {
-      // Move work item out of m_processing to avoid iterator invalidation
-      // when another thread modifies m_processing during callback execution
-      item.emplace(std::move(*i));
-      m_processing.erase(i);
+      CWorkLane& lane = *m_lanes[(first + i) % m_lanes.size()];
+      std::unique_lock laneLock(lane.m_section);
+      if (auto item = takeFrom(lane.m_processing))
+        return item;
     }
-    return item;
-  }();
+    return {};
+  };
 
+  // jobs started before switching the backend are still processing in the queue of the other one
+  if (m_workStealing)
+  {
+    if (auto item = takeFromLanes())
+      return item;
+  }
+
+  {
+    std::unique_lock lock(m_section);
+    if (auto item = takeFrom(m_processing))
+      return item;
+  }
+
+  if (!m_workStealing)
+    return takeFromLanes();
+  return {};
+}
+
+bool CJobManager::OnJobProgress(unsigned int progress, unsigned int total, const CJob* job) const
+{
+  // find the job in the processing queue, and check whether it's cancelled (no callbacks)
+  const std::optional<CWorkItem> item = FindProcessing(job);
+  if (item && !item->GetCallbacks().empty())
+  {
+    for (auto* callback : item->GetCallbacks())
+      callback->OnJobProgress(item->GetId(), progress, total, job);
+    return false;
+  }
+  return true; // couldn't find the job, or it's been cancelled
+}
+
+void CJobManager::OnJobComplete(bool success, CJob* job)
+{
+  std::optional<CWorkItem> item = TakeProcessing(job);
   if (item.has_value())
   {
+    --m_processingCount;
+    m_statistics.OnFinished(item->GetStatistics(), item->GetRunTime(), success);
+
     if (!item->GetCallbacks().empty())
     {
       // We can safely hold a reference to the counter as we are the ones
       // controlling the creation and deletion.
       auto& counter = [&, this]() -> std::atomic<size_t>&
       {
-        std::unique_lock lock(m_section);
+        std::unique_lock lock(m_callbackSection);
 
         assert(!m_pendingCallbacks.contains(job));
 
@@ -379,7 +712,7 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
       }
 
       {
-        std::unique_lock lock(m_section);
+        std::unique_lock lock(m_callbackSection);
         m_pendingCallbacks.erase(job);
       }
     }
@@ -390,7 +723,7 @@ void CJobManager::OnJobComplete(bool success, CJob* job)
 
 size_t CJobManager::GetPendingCallbackCount(const CJob* job) const
 {
-  std::unique_lock lock(m_section);
+  std::unique_lock lock(m_callbackSection);
   auto it = m_pendingCallbacks.find(job);
   return it != m_pendingCallbacks.end() ? static_cast<size_t>(it->second) : 0;
 }
@@ -402,6 +735,8 @@ void CJobManager::RemoveWorker(const CJobWorker* worker)
   const auto i = std::ranges::find(m_workers, worker);
   if (i != m_workers.cend())
     m_workers.erase(i); // workers auto-delete
+  m_workerCount = m_workers.size();
+  m_statistics.OnWorkerCountChanged(m_workers.size());
 }
 
 unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
@@ -411,3 +746,9 @@ unsigned int CJobManager::GetMaxWorkers(CJob::PRIORITY priority)
     return 10000; // A large number..
   return max_workers - (CJob::PRIORITY_HIGH - priority);
 }
+
+size_t CJobManager::GetLaneCount()
+{
+  // one lane per worker of the shared pool, dedicated jobs steal from all of them
+  return GetMaxWorkers(CJob::PRIORITY_HIGH);
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "jobs/Job.h"
+#include "jobs/JobStatistics.h"
 #include "jobs/LambdaJob.h"
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
@@ -16,6 +17,9 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -32,12 +36,31 @@ class IJobCallback;
  on priority levels.  Lower priority jobs are executed only if there are sufficient
  spare worker threads free to allow for higher priority jobs that may arise.
 
+ Two scheduling backends are available. The default one keeps a single queue per priority level
+ guarded by the manager's lock. The work-stealing backend (advancedsettings.xml
+ <jobmanager><workstealing>) distributes queued jobs over per-worker lanes, each with its own lock;
+ idle workers steal from the other lanes, always preferring the highest priority available. Adding,
+ starting and completing a job only lock a lane then.
+
  \sa CJob and IJobCallback
  */
 class CJobManager final
 {
 public:
-  CJobManager() = default;
+  CJobManager();
+
+  /*!
+   \brief Select the scheduling backend.
+   Jobs already queued are migrated to the new backend, so this may be called at any time.
+   \param enable true to use per-worker lanes with work stealing, false for the global queues.
+   */
+  void SetWorkStealing(bool enable);
+
+  /*!
+   \brief Returns whether the work-stealing scheduling backend is active.
+   \sa SetWorkStealing()
+   */
+  bool IsWorkStealing() const { return m_workStealing; }
 
   /*!
    \brief Returns whether the job manager is currently running.
@@ -170,6 +193,13 @@ public:
    */
   size_t GetPendingCallbackCount(const CJob* job) const;
 
+  /*!
+   \brief Get the queue depth, latency and utilisation statistics of this job manager.
+   \sa CJobStatistics
+   */
+  CJobStatistics& GetStatistics() { return m_statistics; }
+  const CJobStatistics& GetStatistics() const { return m_statistics; }
+
 private:
   CJobManager(const CJobManager&) = delete;
   CJobManager const& operator=(CJobManager const&) = delete;
@@ -180,10 +210,16 @@ private:
   class CWorkItem
   {
   public:
-    CWorkItem(CJob* job, unsigned int id, CJob::PRIORITY priority, IJobCallback* callback)
+    CWorkItem(CJob* job,
+              unsigned int id,
+              CJob::PRIORITY priority,
+              IJobCallback* callback,
+              CJobTypeStatistics& stats)
       : m_job(job),
         m_id(id),
-        m_priority(priority)
+        m_priority(priority),
+        m_stats(&stats),
+        m_queued(std::chrono::steady_clock::now())
     {
       if (callback)
         m_callbacks.push_back(callback);
@@ -213,12 +249,48 @@ private:
       return callback;
     }
     CJob::PRIORITY GetPriority() const { return m_priority; }
+    CJobTypeStatistics& GetStatistics() const { return *m_stats; }
+
+    /*!
+     \brief Mark the work item as picked up by a worker.
+     \return the time the item spent in the queue
+     */
+    std::chrono::microseconds Start()
+    {
+      m_started = std::chrono::steady_clock::now();
+      return std::chrono::duration_cast<std::chrono::microseconds>(m_started - m_queued);
+    }
+    std::chrono::microseconds GetRunTime() const
+    {
+      return std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - m_started);
+    }
 
   private:
     CJob* m_job{nullptr};
     unsigned int m_id{0};
     std::vector<IJobCallback*> m_callbacks;
     CJob::PRIORITY m_priority{CJob::PRIORITY::PRIORITY_LOW};
+    CJobTypeStatistics* m_stats{nullptr};
+    std::chrono::steady_clock::time_point m_queued;
+    std::chrono::steady_clock::time_point m_started;
+  };
+
+  using JobQueue = std::deque<CWorkItem>;
+  using JobQueues = std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1>;
+  using Processing = std::vector<CWorkItem>;
+  using Workers = std::vector<CJobWorker*>;
+
+  /*!
+   \brief Queues of one worker lane of the work-stealing backend.
+   Lock order is always m_section before a lane's section. Jobs taken from a lane stay in its
+   m_processing until they complete, so they are never unaccounted for while moving.
+   */
+  struct CWorkLane
+  {
+    CCriticalSection m_section;
+    JobQueues m_queues;
+    Processing m_processing;
   };
 
   /*! \brief Pop a job off the job queue and add to the processing queue ready to process
@@ -226,25 +298,53 @@ private:
    */
   CJob* PopJob();
 
+  /*! \brief Work-stealing variant of PopJob(). Tries the given lane first, then steals from the
+   other lanes, priority by priority.
+   \param lane the lane owned by the calling worker.
+   \return the job to process, nullptr if no jobs are available
+   */
+  CJob* PopJobFromLanes(size_t lane);
+
+  /*! \brief Queue a job in a lane of the work-stealing backend, or add the callback to an equal job
+   queued or processing in any lane.
+   \return the id of the job, 0 if the manager isn't running
+   */
+  unsigned int AddJobToLanes(CJob* job, IJobCallback* callback, CJob::PRIORITY priority);
+
+  /*! \brief Remove a completed job from the processing queue of its lane or the global one.
+   */
+  std::optional<CWorkItem> TakeProcessing(const CJob* job);
+
+  /*! \brief Copy the work item of a processing job.
+   */
+  std::optional<CWorkItem> FindProcessing(const CJob* job) const;
+
+  unsigned int NextJobId();
   void StartWorkers(CJob::PRIORITY priority);
   void RemoveWorker(const CJobWorker* worker);
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
+  static size_t GetLaneCount();
 
-  unsigned int m_jobCounter{0};
+  std::atomic<unsigned int> m_jobCounter{0};
 
-  using JobQueue = std::deque<CWorkItem>;
-  using Processing = std::vector<CWorkItem>;
-  using Workers = std::vector<CJobWorker*>;
+  JobQueues m_jobQueue;
+  std::atomic<bool> m_pauseJobs{false};
 
-  std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
-  bool m_pauseJobs{false};
+  std::atomic<bool> m_workStealing{false};
+  std::vector<std::unique_ptr<CWorkLane>> m_lanes; // created once, only their content changes
+  std::atomic<size_t> m_nextLane{0};
+  std::atomic<size_t> m_processingCount{0};
   Processing m_processing;
   Workers m_workers;
+  std::atomic<size_t> m_workerCount{0};
 
   mutable CCriticalSection m_section;
   CEvent m_jobEvent;
-  bool m_running{true};
+  std::atomic<bool> m_running{true};
 
   // Tracks pending callback count for jobs in completion phase, used by CJob::IsShared()
   std::unordered_map<const CJob*, std::atomic<size_t>> m_pendingCallbacks;
+  mutable CCriticalSection m_callbackSection;
+
+  CJobStatistics m_statistics;
 };
@@ -14,6 +14,16 @@
 #include <algorithm>
 #include <mutex>
 
+namespace
+{
+void UpdateHeldJobs(const CJob* job, int delta)
+{
+  const auto jobManager = CServiceBroker::GetJobManager();
+  if (jobManager)
+    jobManager->GetStatistics().GetType(job->GetType()).m_held += delta;
+}
+} // unnamed namespace
+
 void CJobQueue::CJobPointer::CancelJob()
 {
   CServiceBroker::GetJobManager()->CancelJob(m_id);
@@ -63,6 +73,7 @@ void CJobQueue::CancelJob(const CJob* job)
   const auto j = std::ranges::find_if(m_jobQueue, JobFinder(job));
   if (j != m_jobQueue.cend())
   {
+    UpdateHeldJobs(j->GetJob(), -1);
     j->FreeJob();
     m_jobQueue.erase(j);
   }
@@ -81,6 +92,7 @@ bool CJobQueue::AddJob(CJob* job)
     return false;
   }
 
+  UpdateHeldJobs(job, 1);
   if (m_lifo)
     m_jobQueue.emplace_back(job);
   else
@@ -110,6 +122,7 @@ void CJobQueue::QueueNextJob()
   while (!m_jobQueue.empty() && m_processing.size() < m_jobsAtOnce)
   {
     CJobPointer& job = m_jobQueue.back();
+    UpdateHeldJobs(job.GetJob(), -1);
     job.SetId(CServiceBroker::GetJobManager()->AddJob(job.GetJob(), this, m_priority));
     if (job.GetId() > 0)
     {
@@ -125,7 +138,12 @@ void CJobQueue::CancelJobs()
 {
   std::unique_lock lock(m_section);
   std::ranges::for_each(m_processing, [](CJobPointer& jp) { jp.CancelJob(); });
-  std::ranges::for_each(m_jobQueue, [](CJobPointer& jp) { jp.FreeJob(); });
+  std::ranges::for_each(m_jobQueue,
+                        [](CJobPointer& jp)
+                        {
+                          UpdateHeldJobs(jp.GetJob(), -1);
+                          jp.FreeJob();
+                        });
   m_jobQueue.clear();
   m_processing.clear();
 }
@@ -0,0 +1,208 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "JobStatistics.h"
+
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <string_view>
+
+namespace
+{
+template<typename T>
+void UpdateMax(std::atomic<T>& max, T value)
+{
+  T current = max;
+  while (current < value && !max.compare_exchange_weak(current, value))
+  {
+  }
+}
+} // unnamed namespace
+
+void CJobLatencyHistogram::Add(std::chrono::microseconds duration)
+{
+  const uint64_t us = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+  const size_t bucket = std::min<size_t>(std::bit_width(us), BUCKETS - 1);
+
+  m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(us, std::memory_order_relaxed);
+  UpdateMax(m_max, us);
+}
+
+void CJobLatencyHistogram::Reset()
+{
+  for (auto& bucket : m_buckets)
+    bucket = 0;
+  m_count = 0;
+  m_sum = 0;
+  m_max = 0;
+}
+
+double CJobLatencyHistogram::GetAverageUs() const
+{
+  const uint64_t count = m_count;
+  return count > 0 ? static_cast<double>(m_sum) / count : 0.0;
+}
+
+uint64_t CJobLatencyHistogram::GetPercentileUs(double percentile) const
+{
+  const uint64_t count = m_count;
+  if (count == 0)
+    return 0;
+
+  const auto target = static_cast<uint64_t>(count * std::clamp(percentile, 0.0, 100.0) / 100.0);
+  uint64_t seen = 0;
+  for (size_t bucket = 0; bucket < BUCKETS; ++bucket)
+  {
+    seen += m_buckets[bucket];
+    if (seen > target)
+      return std::min<uint64_t>(bucket == 0 ? 0 : (uint64_t{1} << bucket) - 1, m_max);
+  }
+  return m_max;
+}
+
+void CJobLatencyHistogram::Serialize(CVariant& value) const
+{
+  value["count"] = GetCount();
+  value["averageus"] = GetAverageUs();
+  value["p50us"] = GetPercentileUs(50);
+  value["p95us"] = GetPercentileUs(95);
+  value["p99us"] = GetPercentileUs(99);
+  value["maxus"] = GetMaxUs();
+}
+
+CJobStatistics::CJobStatistics() : m_since(clock::now().time_since_epoch().count())
+{
+}
+
+CJobTypeStatistics& CJobStatistics::GetType(const char* type)
+{
+  std::unique_lock lock(m_section);
+  auto it = m_types.find(std::string_view(type));
+  if (it == m_types.end())
+    it = m_types.emplace(type, std::make_unique<CJobTypeStatistics>()).first;
+  return *it->second;
+}
+
+void CJobStatistics::OnStarted(CJobTypeStatistics& stats, std::chrono::microseconds wait)
+{
+  --stats.m_queued;
+  ++stats.m_processing;
+  ++m_busyWorkers;
+  stats.m_wait.Add(wait);
+}
+
+void CJobStatistics::OnFinished(CJobTypeStatistics& stats,
+                                std::chrono::microseconds run,
+                                bool success)
+{
+  --stats.m_processing;
+  --m_busyWorkers;
+  if (success)
+    ++stats.m_completed;
+  else
+    ++stats.m_failed;
+  stats.m_run.Add(run);
+  m_busyTimeUs.fetch_add(run.count(), std::memory_order_relaxed);
+}
+
+void CJobStatistics::OnCancelled(CJobTypeStatistics& stats, bool wasQueued)
+{
+  if (wasQueued)
+    --stats.m_queued;
+  ++stats.m_cancelled;
+}
+
+double CJobStatistics::GetUtilisation() const
+{
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      clock::now() - clock::time_point(clock::duration(m_since)));
+  const size_t workers = m_workers;
+  if (workers == 0 || elapsed.count() <= 0)
+    return 0.0;
+
+  return std::min(1.0, static_cast<double>(m_busyTimeUs) / (elapsed.count() * workers));
+}
+
+void CJobStatistics::Reset()
+{
+  std::unique_lock lock(m_section);
+  for (auto& [type, stats] : m_types)
+  {
+    // queue depths describe the current state and are kept
+    stats->m_completed = 0;
+    stats->m_failed = 0;
+    stats->m_cancelled = 0;
+    stats->m_wait.Reset();
+    stats->m_run.Reset();
+  }
+  m_busyTimeUs = 0;
+  m_since = clock::now().time_since_epoch().count();
+}
+
+void CJobStatistics::Serialize(CVariant& value) const
+{
+  value["workers"] = static_cast<uint64_t>(m_workers);
+  value["busyworkers"] = static_cast<int64_t>(m_busyWorkers);
+  value["utilisation"] = GetUtilisation();
+  value["types"] = CVariant(CVariant::VariantTypeArray);
+
+  std::unique_lock lock(m_section);
+  for (const auto& [type, stats] : m_types)
+  {
+    CVariant entry(CVariant::VariantTypeObject);
+    entry["type"] = type;
+    entry["held"] = static_cast<int64_t>(stats->m_held);
+    entry["queued"] = static_cast<int64_t>(stats->m_queued);
+    entry["processing"] = static_cast<int64_t>(stats->m_processing);
+    entry["completed"] = static_cast<uint64_t>(stats->m_completed);
+    entry["failed"] = static_cast<uint64_t>(stats->m_failed);
+    entry["cancelled"] = static_cast<uint64_t>(stats->m_cancelled);
+    stats->m_wait.Serialize(entry["wait"]);
+    stats->m_run.Serialize(entry["run"]);
+    value["types"].push_back(std::move(entry));
+  }
+}
+
+std::string CJobStatistics::GetSummary(size_t maxTypes) const
+{
+  struct Entry
+  {
+    std::string type;
+    int64_t depth;
+    uint64_t p95WaitUs;
+  };
+  std::vector<Entry> entries;
+  {
+    std::unique_lock lock(m_section);
+    for (const auto& [type, stats] : m_types)
+    {
+      const int64_t depth = stats->m_held + stats->m_queued + stats->m_processing;
+      if (depth > 0)
+        entries.emplace_back(type.empty() ? "unnamed" : type, depth,
+                             stats->m_wait.GetPercentileUs(95));
+    }
+  }
+  std::ranges::sort(entries, std::ranges::greater{}, &Entry::depth);
+  if (entries.size() > maxTypes)
+    entries.resize(maxTypes);
+
+  std::string summary = StringUtils::Format("Jobs: busy:{}/{} util:{:.0f}%",
+                                            static_cast<int64_t>(m_busyWorkers),
+                                            static_cast<uint64_t>(m_workers),
+                                            GetUtilisation() * 100.0);
+  for (const auto& entry : entries)
+    summary += StringUtils::Format(" {}:{} (p95 wait {} ms)", entry.type, entry.depth,
+                                   entry.p95WaitUs / 1000);
+  return summary;
+}
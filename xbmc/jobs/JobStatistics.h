@@ -0,0 +1,123 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CVariant;
+
+/*!
+ \ingroup jobs
+ \brief Lock-free latency histogram with power of two microsecond buckets.
+ */
+class CJobLatencyHistogram
+{
+public:
+  static constexpr size_t BUCKETS = 26; // last bucket collects everything above ~33 seconds
+
+  void Add(std::chrono::microseconds duration);
+  void Reset();
+
+  uint64_t GetCount() const { return m_count; }
+  uint64_t GetMaxUs() const { return m_max; }
+  double GetAverageUs() const;
+
+  /*!
+   \brief Approximate percentile, resolved to the upper bound of the matching bucket.
+   \param percentile value in the range [0, 100]
+   */
+  uint64_t GetPercentileUs(double percentile) const;
+
+  void Serialize(CVariant& value) const;
+
+private:
+  std::array<std::atomic<uint64_t>, BUCKETS> m_buckets{};
+  std::atomic<uint64_t> m_count{0};
+  std::atomic<uint64_t> m_sum{0};
+  std::atomic<uint64_t> m_max{0};
+};
+
+/*!
+ \ingroup jobs
+ \brief Counters of a single job type, as reported by CJob::GetType().
+ */
+struct CJobTypeStatistics
+{
+  std::atomic<int64_t> m_held{0}; //!< jobs waiting in a CJobQueue, not yet added to the manager
+  std::atomic<int64_t> m_queued{0};
+  std::atomic<int64_t> m_processing{0};
+  std::atomic<uint64_t> m_completed{0};
+  std::atomic<uint64_t> m_failed{0};
+  std::atomic<uint64_t> m_cancelled{0};
+  CJobLatencyHistogram m_wait; //!< time from AddJob() until a worker picks the job up
+  CJobLatencyHistogram m_run; //!< time spent in CJob::DoWork()
+};
+
+/*!
+ \ingroup jobs
+ \brief Queue depth, latency and worker utilisation statistics of the CJobManager.
+
+ Statistics are collected per job type. The hot paths only touch atomics of a CJobTypeStatistics
+ entry, which is looked up once when a job is queued and then kept with the work item.
+ */
+class CJobStatistics
+{
+public:
+  CJobStatistics();
+
+  /*!
+   \brief Get (and create on first use) the counters for the given job type.
+   The returned object lives as long as this CJobStatistics instance.
+   */
+  CJobTypeStatistics& GetType(const char* type);
+
+  void OnQueued(CJobTypeStatistics& stats) { ++stats.m_queued; }
+  void OnStarted(CJobTypeStatistics& stats, std::chrono::microseconds wait);
+  void OnFinished(CJobTypeStatistics& stats, std::chrono::microseconds run, bool success);
+  void OnCancelled(CJobTypeStatistics& stats, bool wasQueued);
+
+  void OnWorkerCountChanged(size_t workers) { m_workers = workers; }
+
+  /*!
+   \brief Fraction of the available worker time spent running jobs since the last reset.
+   */
+  double GetUtilisation() const;
+
+  /*!
+   \brief Reset latency histograms and counters, keeping current queue depths.
+   */
+  void Reset();
+
+  void Serialize(CVariant& value) const;
+
+  /*!
+   \brief One line summary of the busiest job types, for on-screen display.
+   */
+  std::string GetSummary(size_t maxTypes = 3) const;
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  mutable CCriticalSection m_section;
+  std::map<std::string, std::unique_ptr<CJobTypeStatistics>, std::less<>> m_types;
+
+  std::atomic<size_t> m_workers{0};
+  std::atomic<int64_t> m_busyWorkers{0};
+  std::atomic<uint64_t> m_busyTimeUs{0};
+  std::atomic<clock::rep> m_since;
+};
@@ -18,6 +18,8 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
 #include <utility>
 
 namespace KODI
@@ -58,30 +60,61 @@ CApplicationMessenger::~CApplicationMessenger()
   Cleanup();
 }
 
-void CApplicationMessenger::Cleanup()
+void CApplicationMessenger::CMessageQueue::Push(const QueuedMessage& entry,
+                                                CCriticalSection& section)
 {
-  std::unique_lock lock(m_critSection);
+  if (m_ring.TryPush(entry))
+    return;
+
+  // the receiving thread is lagging behind. Move what was queued so far to the deque and append
+  // there to keep the order of messages.
+  std::unique_lock lock(section);
+  Drain();
+  m_overflow.push_back(entry);
+}
+
+bool CApplicationMessenger::CMessageQueue::Pop(QueuedMessage& entry)
+{
+  // messages in the deque are always older than the ones in the ring
+  if (!m_overflow.empty())
+  {
+    entry = m_overflow.front();
+    m_overflow.pop_front();
+    return true;
+  }
+  return m_ring.TryPop(entry);
+}
 
-  while (!m_vecMessages.empty())
+void CApplicationMessenger::CMessageQueue::Drain()
+{
+  // senders which already reserved a slot are about to publish their message, wait for them
+  const size_t reserved = m_ring.GetPushPosition();
+  QueuedMessage entry;
+  while (true)
   {
-    ThreadMessage* pMsg = m_vecMessages.front();
+    while (m_ring.TryPop(entry))
+      m_overflow.push_back(entry);
 
-    if (pMsg->waitEvent)
-      pMsg->waitEvent->Set();
+    if (m_ring.GetPopPosition() >= reserved)
+      break;
 
-    delete pMsg;
-    m_vecMessages.pop();
+    std::this_thread::yield();
   }
+}
 
-  while (!m_vecWindowMessages.empty())
-  {
-    ThreadMessage* pMsg = m_vecWindowMessages.front();
+void CApplicationMessenger::Cleanup()
+{
+  std::unique_lock lock(m_critSection);
 
-    if (pMsg->waitEvent)
-      pMsg->waitEvent->Set();
+  for (CMessageQueue* queue : {&m_vecMessages, &m_vecWindowMessages})
+  {
+    while (ThreadMessage* pMsg = DequeueMessage(*queue))
+    {
+      if (pMsg->waitEvent)
+        pMsg->waitEvent->Set();
 
-    delete pMsg;
-    m_vecWindowMessages.pop();
+      delete pMsg;
+    }
   }
 }
 
@@ -117,14 +150,7 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
 
   ThreadMessage* msg = new ThreadMessage(std::move(message));
 
-  std::unique_lock lock(m_critSection);
-
-  if (msg->dwMessage == TMSG_GUI_MESSAGE)
-    m_vecWindowMessages.push(msg);
-  else
-    m_vecMessages.push(msg);
-  lock.unlock(); // this releases the lock on the vec of messages and
-      //   allows the ProcessMessage to execute and therefore
+  QueueMessage(msg); // this allows the ProcessMessage to execute and therefore
       //   delete the message itself. Therefore any access
       //   of the message itself after this point constitutes
       //   a race condition (yarc - "yet another race condition")
@@ -148,6 +174,63 @@ int CApplicationMessenger::SendMsg(ThreadMessage&& message, bool wait)
   return -1;
 }
 
+void CApplicationMessenger::QueueMessage(ThreadMessage* msg)
+{
+  CMessageQueue& queue =
+      msg->dwMessage == TMSG_GUI_MESSAGE ? m_vecWindowMessages : m_vecMessages;
+
+  // a payload of a superseded message would leak, and senders waiting for a result expect their
+  // own message to be processed
+  if (!msg->result && !msg->lpVoid)
+  {
+    CoalescedMessage* coalesced = GetCoalescedMessage(msg->dwMessage);
+    if (coalesced)
+    {
+      ThreadMessage* superseded = coalesced->latest.exchange(msg);
+      if (superseded)
+      {
+        // the queue already has an entry for this message type, which now picks up ours
+        delete superseded;
+        return;
+      }
+      queue.Push({nullptr, coalesced}, m_critSection);
+      return;
+    }
+  }
+
+  queue.Push({msg, nullptr}, m_critSection);
+}
+
+ThreadMessage* CApplicationMessenger::DequeueMessage(CMessageQueue& queue)
+{
+  QueuedMessage entry;
+  while (queue.Pop(entry))
+  {
+    if (!entry.coalesced)
+      return entry.message;
+
+    ThreadMessage* msg = entry.coalesced->latest.exchange(nullptr);
+    if (msg)
+      return msg;
+  }
+  return nullptr;
+}
+
+CApplicationMessenger::CoalescedMessage* CApplicationMessenger::GetCoalescedMessage(
+    uint32_t messageId) const
+{
+  std::shared_lock lock(m_coalescingSection);
+  const auto it = m_coalescedMessages.find(messageId);
+  return it != m_coalescedMessages.end() ? it->second.get() : nullptr;
+}
+
+void CApplicationMessenger::SetCoalescing(uint32_t messageId)
+{
+  std::unique_lock lock(m_coalescingSection);
+  if (!m_coalescedMessages.contains(messageId))
+    m_coalescedMessages.emplace(messageId, std::make_unique<CoalescedMessage>());
+}
+
 int CApplicationMessenger::SendMsg(uint32_t messageId)
 {
    return SendMsg(ThreadMessage{ messageId }, true);
@@ -204,12 +287,9 @@ void CApplicationMessenger::ProcessMessages()
 {
   // process threadmessages
   std::unique_lock lock(m_critSection);
-  while (!m_vecMessages.empty())
+  //first remove the message from the queue, else the message could be processed more then once
+  while (ThreadMessage* pMsg = DequeueMessage(m_vecMessages))
   {
-    ThreadMessage* pMsg = m_vecMessages.front();
-    //first remove the message from the queue, else the message could be processed more then once
-    m_vecMessages.pop();
-
     //Leave here as the message might make another
     //thread call processmessages or sendmessage
 
@@ -253,12 +333,9 @@ void CApplicationMessenger::ProcessWindowMessages()
 {
   std::unique_lock lock(m_critSection);
   //message type is window, process window messages
-  while (!m_vecWindowMessages.empty())
+  //first remove the message from the queue, else the message could be processed more then once
+  while (ThreadMessage* pMsg = DequeueMessage(m_vecWindowMessages))
   {
-    ThreadMessage* pMsg = m_vecWindowMessages.front();
-    //first remove the message from the queue, else the message could be processed more then once
-    m_vecWindowMessages.pop();
-
     // leave here in case we make more thread messages from this one
 
     std::shared_ptr<CEvent> waitEvent = pMsg->waitEvent;
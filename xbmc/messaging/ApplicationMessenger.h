@@ -10,11 +10,14 @@
 
 #include "guilib/WindowIDs.h"
 #include "messaging/ThreadMessage.h"
+#include "threads/SharedSection.h"
 #include "threads/Thread.h"
+#include "utils/MPSCRing.h"
 
+#include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
-#include <queue>
 #include <string>
 #include <vector>
 
@@ -219,6 +222,14 @@ struct ThreadMessageCallback
  * this might need to be redesigned to simplify the lookup of the correct message queue but currently they're implemented
  * as two member variables
  *
+ * Senders add messages to a queue without taking a lock, through a bounded ring buffer. Only if the ring buffer
+ * is full, messages are moved to an overflow deque under the lock. Messages in the deque are always older than the
+ * ones in the ring buffer, so the order is kept.
+ *
+ * Message types registered with \sa CApplicationMessenger::SetCoalescing() are coalesced: posting such a message
+ * while another one of the same type is still pending replaces the pending one, which is then processed with the
+ * parameters of the latest message at the position of the first one.
+ *
  * The design is meant to be very encapsulated and easy to extend without altering the public interface.
  * e.g. If GUI messages should be handled on another thread, call \sa CApplicationMessenger::ProcessWindowMessage() on that
  * thread and nothing else has to change. The callers have no knowledge of how this is implemented.
@@ -403,6 +414,16 @@ public:
    */
   void RegisterReceiver(IMessageTarget* target);
 
+  /*!
+   * \brief Collapse bursts of posted messages of the given type, only the latest pending one is
+   * processed.
+   *
+   * Only meant for idempotent messages, like setting an absolute value. Messages sent with
+   * SendMsg and messages carrying a payload pointer are never coalesced.
+   * \param messageId the message type
+   */
+  void SetCoalescing(uint32_t messageId);
+
   /*!
    * \brief Set the UI thread id to avoid messenger being dependent on
    * CApplication to determine if marshaling is required
@@ -429,16 +450,50 @@ private:
   CApplicationMessenger(const CApplicationMessenger&) = delete;
   CApplicationMessenger const& operator=(CApplicationMessenger const&) = delete;
 
+  struct CoalescedMessage
+  {
+    ~CoalescedMessage() { delete latest.load(); }
+
+    std::atomic<ThreadMessage*> latest{nullptr}; /*!< pending message, owned by this object */
+  };
+
+  struct QueuedMessage
+  {
+    ThreadMessage* message{nullptr};
+    CoalescedMessage* coalesced{nullptr}; /*!< set instead of message for coalesced messages */
+  };
+
+  class CMessageQueue
+  {
+  public:
+    void Push(const QueuedMessage& entry, CCriticalSection& section);
+    //! \brief Pop the oldest message, the caller has to hold the section passed to Push()
+    bool Pop(QueuedMessage& entry);
+    //! \brief Move the messages from the ring buffer to the overflow deque, with the section held
+    void Drain();
+
+  private:
+    static constexpr size_t RING_SIZE = 1024;
+
+    KODI::UTILS::CMPSCRing<QueuedMessage> m_ring{RING_SIZE};
+    std::deque<QueuedMessage> m_overflow;
+  };
+
   int SendMsg(ThreadMessage&& msg, bool wait);
+  void QueueMessage(ThreadMessage* msg);
+  ThreadMessage* DequeueMessage(CMessageQueue& queue);
   void ProcessMessage(ThreadMessage *pMsg);
+  CoalescedMessage* GetCoalescedMessage(uint32_t messageId) const;
 
-  std::queue<ThreadMessage*> m_vecMessages; /*!< queue for regular messages */
-  std::queue<ThreadMessage*> m_vecWindowMessages; /*!< queue for UI messages */
+  CMessageQueue m_vecMessages; /*!< queue for regular messages */
+  CMessageQueue m_vecWindowMessages; /*!< queue for UI messages */
+  mutable CSharedSection m_coalescingSection;
+  std::map<uint32_t, std::unique_ptr<CoalescedMessage>> m_coalescedMessages;
   std::map<int, IMessageTarget*> m_mapTargets; /*!< a map of registered receivers indexed on the message mask*/
   CCriticalSection m_critSection;
   std::thread::id m_guiThreadId;
   std::thread::id m_processThreadId;
-  bool m_bStop{ false };
+  std::atomic<bool> m_bStop{false};
 };
 }
 }
@@ -0,0 +1,133 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "messaging/ApplicationMessenger.h"
+#include "messaging/IMessageTarget.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::MESSAGING;
+
+namespace
+{
+constexpr uint32_t TMSG_MASK_TEST = 1 << 20;
+constexpr uint32_t TMSG_TEST = TMSG_MASK_TEST + 0;
+constexpr uint32_t TMSG_TEST_COALESCED = TMSG_MASK_TEST + 1;
+
+class CTestTarget : public IMessageTarget
+{
+public:
+  int GetMessageMask() override { return TMSG_MASK_TEST; }
+  void OnApplicationMessage(ThreadMessage* msg) override
+  {
+    m_received.emplace_back(msg->dwMessage, msg->param1, msg->param2);
+  }
+
+  struct Received
+  {
+    uint32_t message;
+    int param1;
+    int param2;
+  };
+  std::vector<Received> m_received;
+};
+
+class TestApplicationMessenger : public testing::Test
+{
+protected:
+  TestApplicationMessenger() { m_messenger.RegisterReceiver(&m_target); }
+
+  CApplicationMessenger m_messenger;
+  CTestTarget m_target;
+};
+} // unnamed namespace
+
+TEST_F(TestApplicationMessenger, Order)
+{
+  // more messages than fit into the lock-free ring buffer
+  constexpr int MESSAGES = 5000;
+  for (int i = 0; i < MESSAGES; ++i)
+    m_messenger.PostMsg(TMSG_TEST, i, 0, nullptr);
+
+  m_messenger.ProcessMessages();
+
+  ASSERT_EQ(static_cast<size_t>(MESSAGES), m_target.m_received.size());
+  for (int i = 0; i < MESSAGES; ++i)
+    EXPECT_EQ(i, m_target.m_received[i].param1);
+}
+
+TEST_F(TestApplicationMessenger, MultipleSenders)
+{
+  constexpr int THREADS = 4;
+  constexpr int MESSAGES = 2000;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; ++t)
+    threads.emplace_back(
+        [this, t]
+        {
+          for (int i = 0; i < MESSAGES; ++i)
+            m_messenger.PostMsg(TMSG_TEST, t, i, nullptr);
+        });
+
+  // process while the senders are still busy
+  size_t received = 0;
+  while (received < THREADS * MESSAGES)
+  {
+    m_messenger.ProcessMessages();
+    received = m_target.m_received.size();
+    std::this_thread::yield();
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  // the order of each sender is kept
+  std::vector<int> next(THREADS, 0);
+  for (const auto& msg : m_target.m_received)
+    EXPECT_EQ(next[msg.param1]++, msg.param2);
+}
+
+TEST_F(TestApplicationMessenger, Coalescing)
+{
+  m_messenger.SetCoalescing(TMSG_TEST_COALESCED);
+
+  m_messenger.PostMsg(TMSG_TEST, 1, 0, nullptr);
+  m_messenger.PostMsg(TMSG_TEST_COALESCED, 10, 0, nullptr);
+  m_messenger.PostMsg(TMSG_TEST, 2, 0, nullptr);
+  m_messenger.PostMsg(TMSG_TEST_COALESCED, 11, 0, nullptr);
+  m_messenger.PostMsg(TMSG_TEST_COALESCED, 12, 0, nullptr);
+  m_messenger.ProcessMessages();
+
+  // the latest value is processed at the position of the first message
+  ASSERT_EQ(3u, m_target.m_received.size());
+  EXPECT_EQ(1, m_target.m_received[0].param1);
+  EXPECT_EQ(TMSG_TEST_COALESCED, m_target.m_received[1].message);
+  EXPECT_EQ(12, m_target.m_received[1].param1);
+  EXPECT_EQ(2, m_target.m_received[2].param1);
+
+  // a new burst is queued again
+  m_messenger.PostMsg(TMSG_TEST_COALESCED, 13, 0, nullptr);
+  m_messenger.ProcessMessages();
+  ASSERT_EQ(4u, m_target.m_received.size());
+  EXPECT_EQ(13, m_target.m_received[3].param1);
+}
+
+TEST_F(TestApplicationMessenger, NoCoalescingWithPayload)
+{
+  m_messenger.SetCoalescing(TMSG_TEST_COALESCED);
+
+  int payload = 0;
+  m_messenger.PostMsg(TMSG_TEST_COALESCED, 1, 0, &payload);
+  m_messenger.PostMsg(TMSG_TEST_COALESCED, 2, 0, &payload);
+  m_messenger.ProcessMessages();
+
+  EXPECT_EQ(2u, m_target.m_received.size());
+}
@@ -0,0 +1,697 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "UringFile.h"
+
+#include "utils/log.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <cstring>
+#include <errno.h>
+#include <mutex>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr unsigned int READ_REQUESTS = 4;
+constexpr size_t READ_REQUEST_SIZE = 256 * 1024;
+constexpr unsigned int WRITE_REQUESTS = 4;
+constexpr size_t WRITE_REQUEST_SIZE = 512 * 1024;
+
+// every request occupies at most one entry at a time, so the queue can't overflow
+constexpr unsigned int QUEUE_ENTRIES = READ_REQUESTS + WRITE_REQUESTS;
+} // unnamed namespace
+
+namespace XFILE
+{
+
+/*!
+ \brief Minimal io_uring instance, only the parts needed for plain reads and writes.
+ Not thread safe, CUringFile serializes all access.
+ */
+class CUring
+{
+public:
+  explicit CUring(unsigned int entries);
+  ~CUring();
+
+  CUring(const CUring&) = delete;
+  CUring& operator=(const CUring&) = delete;
+
+  bool IsValid() const { return m_fd >= 0; }
+
+  /*!
+   \brief Add a request to the submission queue, it's passed to the kernel with the next Enter.
+   */
+  void Queue(uint8_t opcode, int fd, const struct iovec* iov, int64_t offset, void* userData);
+
+  bool HasQueued() const { return m_queued > 0; }
+
+  /*!
+   \brief Submit the queued requests and wait for the given number of completions in one syscall.
+   \return 0 or a negative errno
+   */
+  int Enter(unsigned int minComplete);
+
+  template<typename F>
+  void Reap(F&& onCompletion)
+  {
+    unsigned int head = *m_cqHead;
+    const unsigned int tail = std::atomic_ref(*m_cqTail).load(std::memory_order_acquire);
+    while (head != tail)
+    {
+      const struct io_uring_cqe& cqe = m_cqes[head & *m_cqMask];
+      onCompletion(reinterpret_cast<void*>(cqe.user_data), cqe.res);
+      ++head;
+    }
+    std::atomic_ref(*m_cqHead).store(head, std::memory_order_release);
+  }
+
+private:
+  int m_fd = -1;
+  void* m_sqRing = MAP_FAILED;
+  size_t m_sqRingSize = 0;
+  void* m_cqRing = MAP_FAILED;
+  size_t m_cqRingSize = 0;
+  struct io_uring_sqe* m_sqes = static_cast<struct io_uring_sqe*>(MAP_FAILED);
+  size_t m_sqesSize = 0;
+
+  unsigned int* m_sqTail = nullptr;
+  unsigned int* m_sqMask = nullptr;
+  unsigned int* m_sqArray = nullptr;
+  unsigned int* m_cqHead = nullptr;
+  unsigned int* m_cqTail = nullptr;
+  unsigned int* m_cqMask = nullptr;
+  struct io_uring_cqe* m_cqes = nullptr;
+  unsigned int m_queued = 0;
+};
+
+} // namespace XFILE
+
+CUring::CUring(unsigned int entries)
+{
+  struct io_uring_params params = {};
+  const int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+  if (fd < 0)
+    return;
+
+  m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+  m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (singleMap)
+    m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+
+  m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                  IORING_OFF_SQ_RING);
+  if (singleMap)
+    m_cqRing = m_sqRing;
+  else
+    m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                    IORING_OFF_CQ_RING);
+
+  m_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+  m_sqes = static_cast<struct io_uring_sqe*>(mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE,
+                                                  MAP_SHARED | MAP_POPULATE, fd,
+                                                  IORING_OFF_SQES));
+
+  if (m_sqRing == MAP_FAILED || m_cqRing == MAP_FAILED || m_sqes == MAP_FAILED)
+  {
+    CLog::Log(LOGERROR, "CUring::{} - Failed to map the rings: {}", __FUNCTION__, strerror(errno));
+    close(fd);
+    return;
+  }
+
+  auto* sq = static_cast<uint8_t*>(m_sqRing);
+  m_sqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+  m_sqMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+  m_sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+
+  auto* cq = static_cast<uint8_t*>(m_cqRing);
+  m_cqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+  m_cqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+  m_cqMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+  m_cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+  m_fd = fd;
+}
+
+CUring::~CUring()
+{
+  if (m_sqes != MAP_FAILED)
+    munmap(m_sqes, m_sqesSize);
+  if (m_cqRing != MAP_FAILED && m_cqRing != m_sqRing)
+    munmap(m_cqRing, m_cqRingSize);
+  if (m_sqRing != MAP_FAILED)
+    munmap(m_sqRing, m_sqRingSize);
+  if (m_fd >= 0)
+    close(m_fd);
+}
+
+void CUring::Queue(uint8_t opcode, int fd, const struct iovec* iov, int64_t offset, void* userData)
+{
+  const unsigned int tail = *m_sqTail;
+  const unsigned int index = tail & *m_sqMask;
+
+  struct io_uring_sqe& sqe = m_sqes[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = opcode;
+  sqe.fd = fd;
+  sqe.off = static_cast<uint64_t>(offset);
+  sqe.addr = reinterpret_cast<uint64_t>(iov);
+  sqe.len = 1;
+  sqe.user_data = reinterpret_cast<uint64_t>(userData);
+
+  m_sqArray[index] = index;
+  std::atomic_ref(*m_sqTail).store(tail + 1, std::memory_order_release);
+  ++m_queued;
+}
+
+int CUring::Enter(unsigned int minComplete)
+{
+  while (true)
+  {
+    const unsigned int flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    const long submitted =
+        syscall(__NR_io_uring_enter, m_fd, m_queued, minComplete, flags, nullptr, 0);
+    if (submitted >= 0)
+    {
+      m_queued -= std::min(m_queued, static_cast<unsigned int>(submitted));
+      return 0;
+    }
+
+    if (errno != EINTR)
+      return -errno;
+  }
+}
+
+CUringFile::CUringFile() = default;
+
+CUringFile::~CUringFile()
+{
+  Close();
+}
+
+bool CUringFile::IsSupported()
+{
+  static const bool supported = []
+  {
+    const CUring ring(2);
+    if (!ring.IsValid())
+      CLog::Log(LOGINFO, "CUringFile::{} - io_uring isn't available, using blocking file I/O",
+                __FUNCTION__);
+    return ring.IsValid();
+  }();
+
+  return supported;
+}
+
+bool CUringFile::Open(const CURL& url)
+{
+  if (!CPosixFile::Open(url))
+    return false;
+
+  Setup();
+  return true;
+}
+
+bool CUringFile::OpenForWrite(const CURL& url, bool bOverWrite /* = false */)
+{
+  if (!CPosixFile::OpenForWrite(url, bOverWrite))
+    return false;
+
+  Setup();
+  return true;
+}
+
+void CUringFile::Close()
+{
+  if (m_ring)
+  {
+    std::unique_lock lock(m_section);
+    CancelReads();
+    WaitForWritesLocked();
+    if (std::ranges::none_of(m_writes, &Request::pending))
+    {
+      m_freeWrites.insert(m_freeWrites.end(), m_writes.begin(), m_writes.end());
+      m_writes.clear();
+    }
+    m_writeError = 0;
+  }
+
+  CPosixFile::Close();
+}
+
+ssize_t CUringFile::Read(void* lpBuf, size_t uiBufSize)
+{
+  if (!m_ring)
+    return CPosixFile::Read(lpBuf, uiBufSize);
+
+  if (m_fd < 0)
+    return -1;
+
+  assert(lpBuf != nullptr || uiBufSize == 0);
+  if (lpBuf == nullptr && uiBufSize != 0)
+    return -1;
+
+  std::unique_lock lock(m_section);
+
+  if (m_freeReads.empty() && m_reads.empty())
+    Allocate(m_freeReads, READ_REQUESTS, READ_REQUEST_SIZE);
+
+  // what was read ahead is of no use if the position moved out of it
+  if (!m_reads.empty() && (m_filePos < m_reads.front()->offset || m_filePos >= m_readAheadPos))
+    CancelReads();
+
+  auto* buffer = static_cast<uint8_t*>(lpBuf);
+  size_t copied = 0;
+  bool reread = false;
+  while (copied < uiBufSize)
+  {
+    QueueReads();
+    if (m_reads.empty())
+      break;
+
+    Request& request = *m_reads.front();
+    if (request.pending)
+    {
+      // return what's there rather than waiting for more
+      if (copied > 0)
+        break;
+
+      if (!WaitForRequest(request))
+      {
+        CancelReads();
+        return -1;
+      }
+    }
+
+    if (request.result < 0)
+    {
+      CLog::Log(LOGERROR, "CUringFile::{} - Read at {} failed: {}", __FUNCTION__, request.offset,
+                strerror(static_cast<int>(-request.result)));
+      errno = static_cast<int>(-request.result);
+      CancelReads();
+      if (copied > 0)
+        break;
+      return -1;
+    }
+
+    const int64_t end = request.offset + request.result;
+    if (m_filePos >= end)
+    {
+      if (request.result == static_cast<ssize_t>(request.length))
+      {
+        // skipped by a seek within the read ahead data
+        RecycleRead();
+        continue;
+      }
+
+      // a short read was the end of the file at the time, it may have grown since
+      if (copied > 0 || reread)
+        break;
+
+      CancelReads();
+      reread = true;
+      continue;
+    }
+
+    const size_t size = std::min(static_cast<size_t>(end - m_filePos), uiBufSize - copied);
+    std::memcpy(buffer + copied, request.buffer.get() + (m_filePos - request.offset), size);
+    copied += size;
+    m_filePos += size;
+
+    if (m_filePos >= end && request.result == static_cast<ssize_t>(request.length))
+      RecycleRead();
+  }
+
+  // recycled requests are read ahead while the caller processes the data
+  QueueReads();
+  if (m_ring->HasQueued())
+    m_ring->Enter(0);
+
+  DropCacheBehind();
+
+  return copied;
+}
+
+ssize_t CUringFile::Write(const void* lpBuf, size_t uiBufSize)
+{
+  if (!m_ring)
+    return CPosixFile::Write(lpBuf, uiBufSize);
+
+  if (m_fd < 0)
+    return -1;
+
+  assert(lpBuf != nullptr || uiBufSize == 0);
+  if ((lpBuf == nullptr && uiBufSize != 0) || !m_allowWrite)
+    return -1;
+
+  if (uiBufSize == 0)
+    return 0;
+
+  std::unique_lock lock(m_section);
+
+  if (m_freeWrites.empty() && m_writes.empty())
+    Allocate(m_freeWrites, WRITE_REQUESTS, WRITE_REQUEST_SIZE);
+
+  // data read ahead may be overwritten
+  CancelReads();
+
+  Reap();
+  while (m_freeWrites.empty() && m_writeError == 0)
+  {
+    if (!WaitForCompletion())
+      return -1;
+  }
+
+  if (m_writeError != 0)
+  {
+    errno = m_writeError;
+    return -1;
+  }
+
+  Request& request = *m_freeWrites.back();
+  m_freeWrites.pop_back();
+
+  const size_t size = std::min(uiBufSize, WRITE_REQUEST_SIZE);
+  std::memcpy(request.buffer.get(), lpBuf, size);
+  request.offset = m_filePos;
+  request.length = size;
+  Submit(request, true);
+  m_writes.emplace_back(&request);
+
+  const int ret = m_ring->Enter(0);
+  if (ret < 0)
+  {
+    CLog::Log(LOGERROR, "CUringFile::{} - Failed to submit write: {}", __FUNCTION__,
+              strerror(-ret));
+  }
+
+  m_filePos += size;
+  return size;
+}
+
+int64_t CUringFile::Seek(int64_t iFilePosition, int iWhence /* = SEEK_SET */)
+{
+  if (!m_ring)
+    return CPosixFile::Seek(iFilePosition, iWhence);
+
+  if (m_fd < 0)
+    return -1;
+
+  std::unique_lock lock(m_section);
+
+  // writes are tracked in file order, so they have to complete before writing elsewhere
+  WaitForWritesLocked();
+
+  int64_t position = -1;
+  switch (iWhence)
+  {
+    case SEEK_SET:
+      position = iFilePosition;
+      break;
+    case SEEK_CUR:
+      position = m_filePos + iFilePosition;
+      break;
+    case SEEK_END:
+    {
+      struct stat64 st;
+      if (fstat64(m_fd, &st) != 0)
+        return -1;
+      position = st.st_size + iFilePosition;
+      break;
+    }
+    default:
+      break;
+  }
+
+  if (position < 0)
+  {
+    errno = EINVAL;
+    return -1;
+  }
+
+  // the read ahead data is dropped by the next read if it doesn't cover the new position
+  m_filePos = position;
+  return m_filePos;
+}
+
+int CUringFile::Truncate(int64_t size)
+{
+  if (!m_ring)
+    return CPosixFile::Truncate(size);
+
+  std::unique_lock lock(m_section);
+  CancelReads();
+  WaitForWritesLocked();
+  return CPosixFile::Truncate(size);
+}
+
+int64_t CUringFile::GetPosition()
+{
+  if (!m_ring)
+    return CPosixFile::GetPosition();
+
+  if (m_fd < 0)
+    return -1;
+
+  return m_filePos;
+}
+
+int64_t CUringFile::GetLength()
+{
+  if (m_ring)
+  {
+    std::unique_lock lock(m_section);
+    WaitForWritesLocked();
+  }
+
+  return CPosixFile::GetLength();
+}
+
+void CUringFile::Flush()
+{
+  if (m_ring)
+  {
+    std::unique_lock lock(m_section);
+    WaitForWritesLocked();
+  }
+
+  CPosixFile::Flush();
+}
+
+int CUringFile::Stat(struct __stat64* buffer)
+{
+  if (m_ring)
+  {
+    std::unique_lock lock(m_section);
+    WaitForWritesLocked();
+  }
+
+  return CPosixFile::Stat(buffer);
+}
+
+int64_t CUringFile::GetWrittenPosition()
+{
+  std::unique_lock lock(m_section);
+  if (!m_ring)
+    return m_filePos;
+
+  Reap();
+  return m_writes.empty() ? m_filePos : m_writes.front()->offset;
+}
+
+bool CUringFile::WaitForWrites()
+{
+  std::unique_lock lock(m_section);
+  if (!m_ring)
+    return false;
+
+  return WaitForWritesLocked();
+}
+
+void CUringFile::Setup()
+{
+  if (m_ring || !IsSupported())
+    return;
+
+  auto ring = std::make_unique<CUring>(QUEUE_ENTRIES);
+  if (!ring->IsValid())
+  {
+    // e.g. the locked memory limit is reached, this file just doesn't queue
+    CLog::Log(LOGDEBUG, "CUringFile::{} - Failed to set up io_uring, using blocking file I/O",
+              __FUNCTION__);
+    return;
+  }
+
+  m_ring = std::move(ring);
+}
+
+void CUringFile::Allocate(std::vector<Request*>& free, unsigned int count, size_t size)
+{
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    auto request = std::make_unique<Request>();
+    request->buffer = std::make_unique<uint8_t[]>(size);
+    request->length = size;
+    free.emplace_back(request.get());
+    m_requests.emplace_back(std::move(request));
+  }
+}
+
+void CUringFile::QueueReads()
+{
+  if (m_reads.empty())
+    m_readAheadPos = m_filePos;
+
+  while (!m_freeReads.empty())
+  {
+    // nothing to read ahead beyond the end of the file
+    if (!m_reads.empty())
+    {
+      const Request& last = *m_reads.back();
+      if (!last.pending && last.result != static_cast<ssize_t>(last.length))
+        break;
+    }
+
+    Request& request = *m_freeReads.back();
+    m_freeReads.pop_back();
+    request.offset = m_readAheadPos;
+    request.length = READ_REQUEST_SIZE;
+    Submit(request, false);
+    m_reads.emplace_back(&request);
+    m_readAheadPos += READ_REQUEST_SIZE;
+  }
+}
+
+void CUringFile::CancelReads()
+{
+  // the buffers can't be reused before the kernel is done with them
+  for (const Request* request : m_reads)
+  {
+    if (!WaitForRequest(*request))
+      return;
+  }
+
+  m_freeReads.insert(m_freeReads.end(), m_reads.begin(), m_reads.end());
+  m_reads.clear();
+  m_readAheadPos = m_filePos;
+}
+
+void CUringFile::RecycleRead()
+{
+  m_freeReads.emplace_back(m_reads.front());
+  m_reads.pop_front();
+}
+
+void CUringFile::Submit(Request& request, bool write)
+{
+  request.iov.iov_base = request.buffer.get();
+  request.iov.iov_len = request.length;
+  request.result = 0;
+  request.write = write;
+  request.pending = true;
+  m_ring->Queue(write ? IORING_OP_WRITEV : IORING_OP_READV, m_fd, &request.iov, request.offset,
+                &request);
+}
+
+bool CUringFile::WaitForRequest(const Request& request)
+{
+  while (request.pending)
+  {
+    if (!WaitForCompletion())
+      return false;
+  }
+  return true;
+}
+
+bool CUringFile::WaitForCompletion()
+{
+  const int ret = m_ring->Enter(1);
+  if (ret < 0)
+  {
+    CLog::Log(LOGERROR, "CUringFile::{} - Failed to wait for completions: {}", __FUNCTION__,
+              strerror(-ret));
+    return false;
+  }
+
+  Reap();
+  return true;
+}
+
+void CUringFile::Reap()
+{
+  m_ring->Reap(
+      [this](void* userData, int result)
+      {
+        auto& request = *static_cast<Request*>(userData);
+        if (request.write)
+        {
+          OnWriteCompleted(request, result);
+        }
+        else
+        {
+          request.result = result;
+          request.pending = false;
+        }
+      });
+
+  while (!m_writes.empty() && !m_writes.front()->pending && m_writes.front()->result > 0)
+  {
+    m_freeWrites.emplace_back(m_writes.front());
+    m_writes.pop_front();
+  }
+
+  // remainders of short writes
+  if (m_ring->HasQueued())
+    m_ring->Enter(0);
+}
+
+void CUringFile::OnWriteCompleted(Request& request, int result)
+{
+  if (result > 0 && static_cast<size_t>(result) < request.iov.iov_len)
+  {
+    // unusual for local files, e.g. the disk is full. Writing the rest reports the actual error.
+    request.iov.iov_base = static_cast<uint8_t*>(request.iov.iov_base) + result;
+    request.iov.iov_len -= result;
+    request.offset += result;
+    m_ring->Queue(IORING_OP_WRITEV, m_fd, &request.iov, request.offset, &request);
+    return;
+  }
+
+  request.result = result;
+  request.pending = false;
+
+  if (result <= 0 && m_writeError == 0)
+  {
+    m_writeError = result < 0 ? -result : EIO;
+    CLog::Log(LOGERROR, "CUringFile::{} - Write at {} failed: {}", __FUNCTION__, request.offset,
+              strerror(m_writeError));
+  }
+}
+
+bool CUringFile::WaitForWritesLocked()
+{
+  bool waited = false;
+  while (std::ranges::any_of(m_writes, &Request::pending))
+  {
+    waited = true;
+    if (!WaitForCompletion())
+      break;
+  }
+  return waited;
+}
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "platform/posix/filesystem/PosixFile.h"
+#include "threads/CriticalSection.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <sys/uio.h>
+
+namespace XFILE
+{
+
+class CUring;
+
+/*!
+ \brief Local file reading ahead and writing behind through io_uring.
+
+ Sequential reads are served from a queue of buffers which are read ahead asynchronously, so the
+ caller rarely waits for the disk and a single syscall submits and reaps several requests. Writes
+ are copied to a buffer and queued, the caller only waits if all buffers are in use.
+
+ If io_uring isn't available, e.g. on old kernels or when it's disabled by a seccomp policy, the
+ file behaves exactly like CPosixFile.
+ */
+class CUringFile : public CPosixFile
+{
+public:
+  CUringFile();
+  ~CUringFile() override;
+
+  bool Open(const CURL& url) override;
+  bool OpenForWrite(const CURL& url, bool bOverWrite = false) override;
+  void Close() override;
+
+  ssize_t Read(void* lpBuf, size_t uiBufSize) override;
+  ssize_t Write(const void* lpBuf, size_t uiBufSize) override;
+  int64_t Seek(int64_t iFilePosition, int iWhence = SEEK_SET) override;
+  int Truncate(int64_t size) override;
+  int64_t GetPosition() override;
+  int64_t GetLength() override;
+  void Flush() override;
+
+  using CPosixFile::Stat;
+  int Stat(struct __stat64* buffer) override;
+
+  /*!
+   \brief Get the end of the data that reached the file, queued writes are not included.
+   Unlike the other methods this may be called from another thread than the one writing.
+   */
+  int64_t GetWrittenPosition();
+
+  /*!
+   \brief Wait until all queued writes reached the file.
+   Unlike the other methods this may be called from another thread than the one writing.
+   \return false if no writes were queued
+   */
+  bool WaitForWrites();
+
+  /*!
+   \brief Whether the kernel supports io_uring, otherwise all files fall back to plain syscalls.
+   */
+  static bool IsSupported();
+
+private:
+  struct Request
+  {
+    std::unique_ptr<uint8_t[]> buffer;
+    struct iovec iov = {};
+    int64_t offset = 0;
+    size_t length = 0;
+    ssize_t result = 0;
+    bool write = false;
+    bool pending = false;
+  };
+
+  void Setup();
+  void Allocate(std::vector<Request*>& free, unsigned int count, size_t size);
+
+  void QueueReads();
+  void CancelReads();
+  void RecycleRead();
+
+  void Submit(Request& request, bool write);
+  bool WaitForRequest(const Request& request);
+  bool WaitForCompletion();
+  void Reap();
+  void OnWriteCompleted(Request& request, int result);
+  bool WaitForWritesLocked();
+
+  CCriticalSection m_section;
+  std::unique_ptr<CUring> m_ring;
+  std::vector<std::unique_ptr<Request>> m_requests;
+  std::vector<Request*> m_freeReads;
+  std::vector<Request*> m_freeWrites;
+  std::deque<Request*> m_reads; //!< read ahead requests in file order
+  int64_t m_readAheadPos = 0; //!< end of the data requested by m_reads
+  std::deque<Request*> m_writes; //!< queued writes in submission order, failed ones stay queued
+  int m_writeError = 0;
+};
+
+} // namespace XFILE
@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "URL.h"
+#include "platform/linux/filesystem/UringFile.h"
+#include "utils/StringUtils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace XFILE;
+
+namespace
+{
+std::vector<uint8_t> MakeData(size_t size)
+{
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<uint8_t>(i * 7 + i / 251);
+  return data;
+}
+} // namespace
+
+class TestUringFile : public ::testing::Test
+{
+protected:
+  TestUringFile()
+  {
+    std::string tmpdir{"/tmp"};
+    const char* test_tmpdir = getenv("TMPDIR");
+    if (test_tmpdir && test_tmpdir[0] != '\0')
+      tmpdir.assign(test_tmpdir);
+
+    m_path = tmpdir + "/kodi-test-" + StringUtils::CreateUUID();
+  }
+
+  ~TestUringFile() override { unlink(m_path.c_str()); }
+
+  void WriteFile(const std::vector<uint8_t>& data, size_t chunkSize)
+  {
+    CUringFile file;
+    ASSERT_TRUE(file.OpenForWrite(CURL(m_path), true));
+    for (size_t pos = 0; pos < data.size();)
+    {
+      const ssize_t written =
+          file.Write(data.data() + pos, std::min(chunkSize, data.size() - pos));
+      ASSERT_GT(written, 0);
+      pos += written;
+    }
+    file.WaitForWrites();
+    EXPECT_EQ(static_cast<int64_t>(data.size()), file.GetWrittenPosition());
+    EXPECT_EQ(static_cast<int64_t>(data.size()), file.GetLength());
+    file.Close();
+  }
+
+  std::vector<uint8_t> ReadFile(CUringFile& file, size_t size, size_t chunkSize)
+  {
+    std::vector<uint8_t> data(size);
+    size_t pos = 0;
+    while (pos < size)
+    {
+      const ssize_t read = file.Read(data.data() + pos, std::min(chunkSize, size - pos));
+      if (read <= 0)
+        break;
+      pos += read;
+    }
+    data.resize(pos);
+    return data;
+  }
+
+  std::string m_path;
+};
+
+TEST_F(TestUringFile, WriteAndReadBack)
+{
+  const auto data = MakeData(3 * 1024 * 1024 + 123);
+  WriteFile(data, 100000);
+
+  CUringFile file;
+  ASSERT_TRUE(file.Open(CURL(m_path)));
+  EXPECT_EQ(static_cast<int64_t>(data.size()), file.GetLength());
+  EXPECT_EQ(data, ReadFile(file, data.size(), 77777));
+  EXPECT_EQ(static_cast<int64_t>(data.size()), file.GetPosition());
+
+  uint8_t byte;
+  EXPECT_EQ(0, file.Read(&byte, 1));
+}
+
+TEST_F(TestUringFile, Seek)
+{
+  const auto data = MakeData(2 * 1024 * 1024);
+  WriteFile(data, 1024 * 1024);
+
+  CUringFile file;
+  ASSERT_TRUE(file.Open(CURL(m_path)));
+  ASSERT_EQ(1000u, ReadFile(file, 1000, 1000).size());
+
+  // back, within what was read ahead
+  ASSERT_EQ(10, file.Seek(10, SEEK_SET));
+  auto read = ReadFile(file, 100, 100);
+  EXPECT_TRUE(std::equal(read.begin(), read.end(), data.begin() + 10));
+
+  // forward, beyond it
+  ASSERT_EQ(1500000, file.Seek(1500000 - 110, SEEK_CUR));
+  read = ReadFile(file, 4096, 4096);
+  EXPECT_TRUE(std::equal(read.begin(), read.end(), data.begin() + 1500000));
+
+  ASSERT_EQ(static_cast<int64_t>(data.size()) - 100, file.Seek(-100, SEEK_END));
+  read = ReadFile(file, 1000, 1000);
+  ASSERT_EQ(100u, read.size());
+  EXPECT_TRUE(std::equal(read.begin(), read.end(), data.end() - 100));
+
+  EXPECT_EQ(-1, file.Seek(-1, SEEK_SET));
+}
+
+TEST_F(TestUringFile, ReadGrowingFile)
+{
+  const auto data = MakeData(3000);
+
+  CUringFile writer;
+  ASSERT_TRUE(writer.OpenForWrite(CURL(m_path), true));
+  ASSERT_EQ(1000, writer.Write(data.data(), 1000));
+  writer.WaitForWrites();
+
+  CUringFile reader;
+  ASSERT_TRUE(reader.Open(CURL(m_path)));
+  EXPECT_EQ(1000u, ReadFile(reader, data.size(), data.size()).size());
+
+  // the end of the file read ahead before isn't taken for the end of the file now
+  ASSERT_EQ(2000, writer.Write(data.data() + 1000, 2000));
+  writer.WaitForWrites();
+  const auto read = ReadFile(reader, 2000, 2000);
+  ASSERT_EQ(2000u, read.size());
+  EXPECT_TRUE(std::equal(read.begin(), read.end(), data.begin() + 1000));
+}
@@ -92,6 +92,8 @@ bool CPosixDirectory::GetDirectory(const CURL& url, CFileItemList& items)
 
       if (name.starts_with('.'))
         item->SetProperty("file:hidden", true);
+
+      ReportItems(fileItems);
     }
   }
   items.AddItems(std::move(fileItems));
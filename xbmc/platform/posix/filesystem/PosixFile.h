@@ -38,6 +38,11 @@ namespace XFILE
     int Stat(struct __stat64* buffer) override;
 
   protected:
+    /*!
+     \brief Advise the OS to drop the cached data well behind the current read position.
+     */
+    void DropCacheBehind();
+
     int     m_fd = -1;
     int64_t m_filePos = -1;
     int64_t m_lastDropPos = -1;
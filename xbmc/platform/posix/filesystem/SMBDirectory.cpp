@@ -157,6 +157,8 @@ bool CSMBDirectory::GetDirectory(const CURL& url, CFileItemList& items)
       item->SetSize(size);
     if (hidden)
       item->SetProperty("file:hidden", true);
+
+    ReportItems(fileItems);
   }
 
   // No results from smbc_readdirplus2() suggests server or share browsing.
@@ -450,6 +450,7 @@ void CAdvancedSettings::Initialize()
   m_curlDisableIPV6 = false;      //Certain hardware/OS combinations have trouble
                                   //with ipv6.
   m_curlDisableHTTP2 = false;
+  m_curlParallelConnections = 1;
 
 #if defined(TARGET_WINDOWS_DESKTOP)
   m_minimizeToTray = false;
@@ -826,6 +827,8 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "fpsdetect", m_videoFpsDetect, 0, 2);
     XMLUtils::GetFloat(pElement, "maxtempo", m_maxTempo, 1.5, 2.0);
     XMLUtils::GetBoolean(pElement, "preferstereostream", m_videoPreferStereoStream);
+    XMLUtils::GetUInt(pElement, "streamdetailscachesize", m_videoStreamDetailsCacheSize, 0,
+                      1000000);
 
     // Store global display latency settings
     const TiXmlElement* pVideoLatency = pElement->FirstChildElement("latency");
@@ -953,9 +956,13 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "curlkeepaliveinterval", m_curlKeepAliveInterval, 0, 300);
     XMLUtils::GetBoolean(pElement, "disableipv6", m_curlDisableIPV6);
     XMLUtils::GetBoolean(pElement, "disablehttp2", m_curlDisableHTTP2);
+    XMLUtils::GetInt(pElement, "curlparallelconnections", m_curlParallelConnections, 1, 16);
     XMLUtils::GetString(pElement, "catrustfile", m_caTrustFile);
     XMLUtils::GetUInt(pElement, "nfstimeout", m_nfsTimeout, 0, 3600);
     XMLUtils::GetInt(pElement, "nfsretries", m_nfsRetries, -1, 30);
+    XMLUtils::GetUInt(pElement, "nfsmaxconnections", m_nfsMaxConnections, 1, 32);
+    XMLUtils::GetUInt(pElement, "segmentcachesize", m_segmentCacheSize, 0, 1048576);
+    XMLUtils::GetUInt(pElement, "directorycachesize", m_directoryCacheSize, 0, 100000);
   }
 
   pElement = pRootElement->FirstChildElement("jsonrpc");
@@ -965,6 +972,10 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetUInt(pElement, "tcpport", m_jsonTcpPort);
   }
 
+  pElement = pRootElement->FirstChildElement("jobmanager");
+  if (pElement)
+    XMLUtils::GetBoolean(pElement, "workstealing", m_jobManagerWorkStealing);
+
   pElement = pRootElement->FirstChildElement("samba");
   if (pElement)
   {
@@ -999,6 +1010,20 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     CServiceBroker::GetLogging().SetLogLevel(m_logLevel);
   }
 
+  pElement = pRootElement->FirstChildElement("logging");
+  if (pElement)
+  {
+    XMLUtils::GetBoolean(pElement, "async", m_logAsync);
+    XMLUtils::GetUInt(pElement, "queuesize", m_logAsyncQueueSize, 64, 1048576);
+    std::string overflow;
+    if (XMLUtils::GetString(pElement, "overflow", overflow))
+      m_logAsyncBlock = StringUtils::EqualsNoCase(overflow, "block");
+    XMLUtils::GetUInt(pElement, "componentratelimit", m_logComponentRateLimit);
+
+    CServiceBroker::GetLogging().SetAsync(m_logAsync, m_logAsyncQueueSize, m_logAsyncBlock);
+    CServiceBroker::GetLogging().SetComponentRateLimit(m_logComponentRateLimit);
+  }
+
   XMLUtils::GetString(pRootElement, "cddbaddress", m_cddbAddress);
   XMLUtils::GetBoolean(pRootElement, "addsourceontop", m_addSourceOnTop);
 
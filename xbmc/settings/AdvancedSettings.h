@@ -198,6 +198,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int  m_videoFpsDetect;
     float m_maxTempo;
     bool m_videoPreferStereoStream = false;
+    unsigned int m_videoStreamDetailsCacheSize{10000}; ///< \brief number of probed files whose stream details are kept on disk
 
     std::string m_videoDefaultPlayer;
     float m_videoPlayCountMinimumPercent;
@@ -210,6 +211,10 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_songInfoDuration;
     int m_logLevel;
     int m_logLevelHint;
+    bool m_logAsync{false}; ///< \brief write the log from a dedicated thread
+    unsigned int m_logAsyncQueueSize{8192}; ///< \brief messages buffered for the log thread
+    bool m_logAsyncBlock{false}; ///< \brief wait for room instead of dropping messages
+    unsigned int m_logComponentRateLimit{0}; ///< \brief messages per second and log component
     std::string m_cddbAddress;
     bool m_addSourceOnTop; //!< True to put 'add source' buttons on top
 
@@ -329,6 +334,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_curlKeepAliveInterval;    // seconds
     bool m_curlDisableIPV6;
     bool m_curlDisableHTTP2;
+    int m_curlParallelConnections;  // range requests in flight when read through a file cache
 
     std::string m_caTrustFile;
 
@@ -387,6 +393,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_jsonOutputCompact;
     unsigned int m_jsonTcpPort;
 
+    bool m_jobManagerWorkStealing{false}; ///< \brief use per-worker job lanes with work stealing
+
     bool m_enableMultimediaKeys;
     std::vector<std::string> m_settingsFiles;
     void ParseSettingsFile(const std::string &file);
@@ -420,6 +428,9 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     std::string m_userAgent;
     uint32_t m_nfsTimeout;
     int m_nfsRetries;
+    unsigned int m_nfsMaxConnections{4}; ///< \brief contexts per NFS export used at once
+    unsigned int m_segmentCacheSize{0}; ///< \brief size of the persistent network file cache in MB
+    unsigned int m_directoryCacheSize{0}; ///< \brief number of network directory listings kept on disk
 
   private:
     void Initialize();
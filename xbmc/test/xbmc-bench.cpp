@@ -0,0 +1,33 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TestBasicEnvironment.h"
+#include "TestUtils.h"
+
+#include <cstdlib>
+
+#include <benchmark/benchmark.h>
+
+// Runs the micro-benchmarks registered with BENCHMARK() in the Bench*.cpp sources.
+// Use --benchmark_out=<file> --benchmark_out_format=json (or the "bench" make target) to
+// get machine readable results that can be compared between releases.
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  CXBMCTestUtils::Instance().ParseArgs(argc, argv);
+
+  TestBasicEnvironment environment;
+  environment.SetUp();
+
+  benchmark::RunSpecifiedBenchmarks();
+
+  environment.TearDown();
+  benchmark::Shutdown();
+
+  return EXIT_SUCCESS;
+}
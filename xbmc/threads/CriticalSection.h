@@ -13,14 +13,46 @@
 #if defined(TARGET_POSIX)
 #include "platform/posix/threads/RecursiveMutex.h"
 
-class CCriticalSection : public XbmcThreads::CountingLockable<XbmcThreads::CRecursiveMutex>
+namespace XbmcThreads
 {
-};
+using CCriticalSectionMutex = CRecursiveMutex;
+}
 
 #elif defined(TARGET_WINDOWS)
 #include <mutex>
 
-class CCriticalSection : public XbmcThreads::CountingLockable<std::recursive_mutex>
+namespace XbmcThreads
+{
+using CCriticalSectionMutex = std::recursive_mutex;
+}
+
+#endif
+
+#if defined(HAS_LOCK_PROFILING)
+#include "threads/LockProfiler.h"
+
+#include <source_location>
+
+/*!
+ * \brief Profiling build of the critical section. All sections constructed at the same place
+ * share their contention statistics, see XbmcThreads::CLockProfiler.
+ */
+class CCriticalSection
+  : public XbmcThreads::CountingLockable<
+        XbmcThreads::CProfiledMutex<XbmcThreads::CCriticalSectionMutex>>
+{
+public:
+  CCriticalSection(const std::source_location& location = std::source_location::current())
+  {
+    mutex.SetSite(XbmcThreads::CLockProfiler::GetInstance().GetSite(location, false));
+  }
+
+  explicit CCriticalSection(XbmcThreads::CLockSite* site) { mutex.SetSite(site); }
+};
+
+#else
+
+class CCriticalSection : public XbmcThreads::CountingLockable<XbmcThreads::CCriticalSectionMutex>
 {
 };
 
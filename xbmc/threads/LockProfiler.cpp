@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LockProfiler.h"
+
+#include <algorithm>
+
+using namespace XbmcThreads;
+
+namespace
+{
+void UpdateMax(std::atomic<uint64_t>& max, uint64_t value)
+{
+  uint64_t current = max.load(std::memory_order_relaxed);
+  while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+uint64_t ToNs(std::chrono::steady_clock::duration duration)
+{
+  return static_cast<uint64_t>(
+      std::max<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), 0));
+}
+
+std::chrono::microseconds ToUs(uint64_t ns)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(ns));
+}
+} // unnamed namespace
+
+void CLockSite::AddWait(std::chrono::steady_clock::duration wait)
+{
+  const uint64_t ns = ToNs(wait);
+  m_contentions.fetch_add(1, std::memory_order_relaxed);
+  m_waitTotalNs.fetch_add(ns, std::memory_order_relaxed);
+  UpdateMax(m_waitMaxNs, ns);
+}
+
+void CLockSite::AddHold(std::chrono::steady_clock::duration hold)
+{
+  const uint64_t ns = ToNs(hold);
+  m_holdTotalNs.fetch_add(ns, std::memory_order_relaxed);
+  UpdateMax(m_holdMaxNs, ns);
+}
+
+void CLockSite::Reset()
+{
+  m_acquisitions = 0;
+  m_sharedAcquisitions = 0;
+  m_contentions = 0;
+  m_waitTotalNs = 0;
+  m_waitMaxNs = 0;
+  m_holdTotalNs = 0;
+  m_holdMaxNs = 0;
+}
+
+LockStatistics CLockSite::GetStatistics() const
+{
+  return {m_name,
+          m_shared,
+          m_instances.load(std::memory_order_relaxed),
+          m_acquisitions.load(std::memory_order_relaxed),
+          m_sharedAcquisitions.load(std::memory_order_relaxed),
+          m_contentions.load(std::memory_order_relaxed),
+          ToUs(m_waitTotalNs.load(std::memory_order_relaxed)),
+          ToUs(m_waitMaxNs.load(std::memory_order_relaxed)),
+          ToUs(m_holdTotalNs.load(std::memory_order_relaxed)),
+          ToUs(m_holdMaxNs.load(std::memory_order_relaxed))};
+}
+
+CLockProfiler& CLockProfiler::GetInstance()
+{
+  // intentionally leaked, locks with static storage duration may outlive any other object
+  static CLockProfiler* instance = new CLockProfiler();
+  return *instance;
+}
+
+CLockSite* CLockProfiler::GetSite(const std::source_location& location, bool shared)
+{
+  std::string name = std::string(location.function_name()) + " (" +
+                     std::string(location.file_name()) + ":" + std::to_string(location.line()) +
+                     ")";
+
+  std::unique_lock lock(m_mutex);
+  auto& site = m_sites[name];
+  if (!site)
+    site = std::make_unique<CLockSite>(std::move(name), shared);
+  return site.get();
+}
+
+std::vector<LockStatistics> CLockProfiler::GetTopContended(size_t maxSites) const
+{
+  std::vector<LockStatistics> statistics;
+  {
+    std::unique_lock lock(m_mutex);
+    statistics.reserve(m_sites.size());
+    for (const auto& [name, site] : m_sites)
+      statistics.emplace_back(site->GetStatistics());
+  }
+
+  std::ranges::sort(statistics,
+                    [](const LockStatistics& a, const LockStatistics& b)
+                    {
+                      if (a.waitTotal != b.waitTotal)
+                        return a.waitTotal > b.waitTotal;
+                      return a.contentions > b.contentions;
+                    });
+  if (maxSites > 0 && statistics.size() > maxSites)
+    statistics.resize(maxSites);
+  return statistics;
+}
+
+void CLockProfiler::Reset()
+{
+  std::unique_lock lock(m_mutex);
+  for (auto& [name, site] : m_sites)
+    site->Reset();
+}
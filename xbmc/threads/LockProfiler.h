@@ -0,0 +1,175 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace XbmcThreads
+{
+
+/*!
+ * \brief Snapshot of the contention statistics of all locks constructed at the same site.
+ */
+struct LockStatistics
+{
+  std::string name; //!< function, file and line the locks were constructed at
+  bool shared; //!< true for CSharedSection, false for CCriticalSection
+  uint64_t instances;
+  uint64_t acquisitions;
+  uint64_t sharedAcquisitions;
+  uint64_t contentions; //!< acquisitions which had to wait for another thread
+  std::chrono::microseconds waitTotal;
+  std::chrono::microseconds waitMax;
+  std::chrono::microseconds holdTotal;
+  std::chrono::microseconds holdMax;
+};
+
+/*!
+ * \brief Contention counters shared by all locks constructed at the same site.
+ */
+class CLockSite
+{
+public:
+  CLockSite(std::string name, bool shared) : m_name(std::move(name)), m_shared(shared) {}
+
+  void AddInstance() { m_instances.fetch_add(1, std::memory_order_relaxed); }
+  void AddAcquisition() { m_acquisitions.fetch_add(1, std::memory_order_relaxed); }
+  void AddSharedAcquisition() { m_sharedAcquisitions.fetch_add(1, std::memory_order_relaxed); }
+  void AddWait(std::chrono::steady_clock::duration wait);
+  void AddHold(std::chrono::steady_clock::duration hold);
+  void Reset();
+
+  LockStatistics GetStatistics() const;
+
+private:
+  const std::string m_name;
+  const bool m_shared;
+  std::atomic<uint64_t> m_instances{0};
+  std::atomic<uint64_t> m_acquisitions{0};
+  std::atomic<uint64_t> m_sharedAcquisitions{0};
+  std::atomic<uint64_t> m_contentions{0};
+  std::atomic<uint64_t> m_waitTotalNs{0};
+  std::atomic<uint64_t> m_waitMaxNs{0};
+  std::atomic<uint64_t> m_holdTotalNs{0};
+  std::atomic<uint64_t> m_holdMaxNs{0};
+};
+
+/*!
+ * \brief Registry of lock sites, filled by CCriticalSection and CSharedSection when built with
+ * ENABLE_LOCK_PROFILING.
+ *
+ * Sites are never freed, so locks can keep a plain pointer to theirs for their whole lifetime,
+ * including locks with static storage duration.
+ */
+class CLockProfiler
+{
+public:
+  static CLockProfiler& GetInstance();
+
+  static constexpr bool IsEnabled()
+  {
+#if defined(HAS_LOCK_PROFILING)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  CLockSite* GetSite(const std::source_location& location, bool shared);
+
+  /*!
+   * \brief Get the lock sites with the highest total wait time, most contended first.
+   * \param maxSites maximum number of sites to return, 0 for all of them
+   */
+  std::vector<LockStatistics> GetTopContended(size_t maxSites) const;
+
+  void Reset();
+
+private:
+  CLockProfiler() = default;
+
+  // not a CCriticalSection, which would profile itself
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, std::unique_ptr<CLockSite>> m_sites;
+};
+
+/*!
+ * \brief Wraps the mutex of a CountingLockable to measure how long threads wait for and hold it.
+ *
+ * Wrapping the underlying mutex, rather than the CountingLockable, also accounts for condition
+ * variables releasing and reacquiring the mutex while waiting.
+ */
+template<class M>
+class CProfiledMutex
+{
+public:
+  CProfiledMutex() = default;
+  CProfiledMutex(const CProfiledMutex&) = delete;
+  CProfiledMutex& operator=(const CProfiledMutex&) = delete;
+
+  void SetSite(CLockSite* site)
+  {
+    m_site = site;
+    m_site->AddInstance();
+  }
+
+  void lock()
+  {
+    if (!m_mutex.try_lock())
+    {
+      const auto start = std::chrono::steady_clock::now();
+      m_mutex.lock();
+      m_site->AddWait(std::chrono::steady_clock::now() - start);
+    }
+    Acquired();
+  }
+
+  bool try_lock()
+  {
+    if (!m_mutex.try_lock())
+      return false;
+    Acquired();
+    return true;
+  }
+
+  void unlock()
+  {
+    // only the owning thread touches the depth and hold start
+    if (--m_depth == 0)
+      m_site->AddHold(std::chrono::steady_clock::now() - m_holdStart);
+    m_mutex.unlock();
+  }
+
+  auto native_handle() { return m_mutex.native_handle(); }
+
+private:
+  void Acquired()
+  {
+    if (m_depth++ == 0)
+    {
+      m_holdStart = std::chrono::steady_clock::now();
+      m_site->AddAcquisition();
+    }
+  }
+
+  M m_mutex;
+  CLockSite* m_site = nullptr;
+  unsigned int m_depth = 0;
+  std::chrono::steady_clock::time_point m_holdStart;
+};
+
+} // namespace XbmcThreads
@@ -18,19 +18,39 @@
  */
 class CSharedSection
 {
+#if defined(HAS_LOCK_PROFILING)
+  XbmcThreads::CLockSite* site;
+#endif
   CCriticalSection sec;
   XbmcThreads::ConditionVariable actualCv;
 
   unsigned int sharedCount = 0;
 
 public:
+#if defined(HAS_LOCK_PROFILING)
+  inline CSharedSection(const std::source_location& location = std::source_location::current())
+    : site(XbmcThreads::CLockProfiler::GetInstance().GetSite(location, true)), sec(site)
+  {
+  }
+#else
   inline CSharedSection() = default;
+#endif
 
   inline void lock()
   {
     std::unique_lock l(sec);
+#if defined(HAS_LOCK_PROFILING)
+    // waiting for readers to leave is the contention a reader/writer lock adds
+    if (sharedCount)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      actualCv.wait(l, [this]() { return sharedCount == 0; });
+      site->AddWait(std::chrono::steady_clock::now() - start);
+    }
+#else
     while (sharedCount)
       actualCv.wait(l, [this]() { return sharedCount == 0; });
+#endif
     sec.lock();
   }
   inline bool try_lock() { return (sec.try_lock() ? ((sharedCount == 0) ? true : (sec.unlock(), false)) : false); }
@@ -40,6 +60,9 @@ public:
   {
     std::unique_lock l(sec);
     sharedCount++;
+#if defined(HAS_LOCK_PROFILING)
+    site->AddSharedAcquisition();
+#endif
   }
   inline bool try_lock_shared() { return (sec.try_lock() ? sharedCount++, sec.unlock(), true : false); }
   inline void unlock_shared()
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/CriticalSection.h"
+#include "threads/LockProfiler.h"
+
+#include <mutex>
+#include <source_location>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace XbmcThreads;
+using namespace std::chrono_literals;
+
+namespace
+{
+using ProfiledSection = CountingLockable<CProfiledMutex<CCriticalSectionMutex>>;
+
+class CTestSection : public ProfiledSection
+{
+public:
+  explicit CTestSection(CLockSite* site) { mutex.SetSite(site); }
+};
+} // unnamed namespace
+
+TEST(TestLockProfiler, SameSiteIsShared)
+{
+  CLockProfiler& profiler = CLockProfiler::GetInstance();
+  const std::source_location location = std::source_location::current();
+  CLockSite* site = profiler.GetSite(location, false);
+  EXPECT_EQ(site, profiler.GetSite(location, false));
+  EXPECT_NE(site, profiler.GetSite(std::source_location::current(), false));
+}
+
+TEST(TestLockProfiler, RecursiveHoldIsCountedOnce)
+{
+  CLockSite site("recursive", false);
+  CTestSection section(&site);
+
+  {
+    std::unique_lock outer(section);
+    std::unique_lock inner(section);
+    EXPECT_TRUE(section.try_lock());
+    section.unlock();
+  }
+
+  const LockStatistics statistics = site.GetStatistics();
+  EXPECT_EQ(1U, statistics.instances);
+  EXPECT_EQ(1U, statistics.acquisitions);
+  EXPECT_EQ(0U, statistics.contentions);
+}
+
+TEST(TestLockProfiler, Contention)
+{
+  CLockSite site("contended", false);
+  CTestSection section(&site);
+
+  std::unique_lock lock(section);
+  std::thread waiter([&section] { std::unique_lock lock(section); });
+
+  std::this_thread::sleep_for(50ms);
+  lock.unlock();
+  waiter.join();
+
+  const LockStatistics statistics = site.GetStatistics();
+  EXPECT_EQ(2U, statistics.acquisitions);
+  EXPECT_EQ(1U, statistics.contentions);
+  EXPECT_GE(statistics.waitTotal, 40ms);
+  EXPECT_GE(statistics.holdMax, 40ms);
+  EXPECT_EQ(statistics.waitTotal, statistics.waitMax);
+
+  site.Reset();
+  EXPECT_EQ(0U, site.GetStatistics().acquisitions);
+  EXPECT_EQ(1U, site.GetStatistics().instances);
+}
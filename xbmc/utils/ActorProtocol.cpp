@@ -10,11 +10,15 @@
 
 #include "threads/Event.h"
 
+#include <algorithm>
 #include <cstring>
 #include <mutex>
+#include <thread>
 
 using namespace Actor;
 
+Message::~Message() = default;
+
 void Message::Release()
 {
   bool skip;
@@ -26,14 +30,17 @@ void Message::Release()
   if (skip)
     return;
 
-  // free data buffer
-  if (data != buffer)
-    delete [] data;
+  // keep moderately sized data buffers around for the next user of this message
+  if (heapBufferSize > MSG_MAX_RETAINED_BUFFER_SIZE)
+  {
+    heapBuffer.reset();
+    heapBufferSize = 0;
+  }
 
   payloadObj.reset();
 
-  // delete event in case of sync message
-  delete event;
+  // the event of a sync message is kept for reuse as well
+  event = nullptr;
 
   origin.ReturnMessage(this);
 }
@@ -57,13 +64,7 @@ bool Message::Reply(int sig, void *data /* = NULL*/, size_t size /* = 0 */)
     msg->isOut = !isOut;
     replyMessage = msg;
     if (data)
-    {
-      if (size > sizeof(msg->buffer))
-        msg->data = new uint8_t[size];
-      else
-        msg->data = msg->buffer;
-      memcpy(msg->data, data, size);
-    }
+      msg->SetData(data, size);
   }
 
   origin.Unlock();
@@ -74,30 +75,54 @@ bool Message::Reply(int sig, void *data /* = NULL*/, size_t size /* = 0 */)
   return true;
 }
 
+void Message::SetData(const void* payload, size_t size)
+{
+  if (size > sizeof(buffer))
+  {
+    if (size > heapBufferSize)
+    {
+      heapBuffer.reset(new uint8_t[size]);
+      heapBufferSize = size;
+    }
+    data = heapBuffer.get();
+  }
+  else
+    data = buffer;
+
+  memcpy(data, payload, size);
+  payloadSize = size;
+}
+
+CEvent* Message::GetSyncEvent()
+{
+  if (!syncEvent)
+    syncEvent = std::make_unique<CEvent>();
+  syncEvent->Reset();
+  return syncEvent.get();
+}
+
 Protocol::~Protocol()
 {
-  Message *msg;
   Purge();
-  while (!freeMessageQueue.empty())
-  {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
+
+  for (Message* msg : freeMessages)
     delete msg;
-  }
 }
 
 Message *Protocol::GetMessage()
 {
-  Message *msg;
+  Message *msg = nullptr;
 
-  std::unique_lock lock(criticalSection);
-
-  if (!freeMessageQueue.empty())
   {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
+    std::unique_lock lock(freeMessageSection);
+    if (!freeMessages.empty())
+    {
+      msg = freeMessages.back();
+      freeMessages.pop_back();
+    }
   }
-  else
+
+  if (!msg)
     msg = new Message(*this);
 
   msg->isSync = false;
@@ -113,9 +138,97 @@ Message *Protocol::GetMessage()
 
 void Protocol::ReturnMessage(Message *msg)
 {
-  std::unique_lock lock(criticalSection);
+  std::unique_lock lock(freeMessageSection);
+
+  freeMessages.push_back(msg);
+}
+
+void Protocol::QueueMessage(Message* msg)
+{
+  MessageRing& ring = msg->isOut ? outRing : inRing;
+
+  msg->sendTime = std::chrono::steady_clock::now();
+  if (!ring.TryPush(msg))
+  {
+    // the receiver is lagging behind. Move what was queued so far to the deque and append there
+    // to keep the order of messages.
+    std::unique_lock lock(criticalSection);
+    std::deque<Message*>& messages = msg->isOut ? outMessages : inMessages;
+    DrainRing(ring, messages);
+    messages.push_back(msg);
+  }
 
-  freeMessageQueue.push(msg);
+  CEvent* containerEvent = msg->isOut ? containerOutEvent : containerInEvent;
+  if (containerEvent)
+    containerEvent->Set();
+}
+
+void Protocol::DrainRing(MessageRing& ring, std::deque<Message*>& messages)
+{
+  // senders which already reserved a slot are about to publish their message, wait for them
+  const size_t reserved = ring.GetPushPosition();
+  Message* msg;
+  while (true)
+  {
+    while (ring.TryPop(msg))
+      messages.push_back(msg);
+
+    if (ring.GetPopPosition() >= reserved)
+      break;
+
+    std::this_thread::yield();
+  }
+}
+
+bool Protocol::DequeueMessage(MessageRing& ring, std::deque<Message*>& messages, Message** msg)
+{
+  // messages in the deque are always older than the ones in the ring
+  if (!messages.empty())
+  {
+    *msg = messages.front();
+    messages.pop_front();
+  }
+  else if (!ring.TryPop(*msg))
+    return false;
+
+  RecordLatency(**msg);
+  return true;
+}
+
+void Protocol::RecordLatency(const Message& msg)
+{
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - msg.sendTime);
+  const auto us = static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+
+  const size_t index = std::min<size_t>(static_cast<size_t>(std::max(msg.signal, 0)),
+                                        MAX_SIGNALS - 1);
+  LatencyCounter& counter = msg.isOut ? outLatency[index] : inLatency[index];
+  counter.count.fetch_add(1, std::memory_order_relaxed);
+  counter.totalUs.fetch_add(us, std::memory_order_relaxed);
+  // only the receiving thread, holding criticalSection, updates the maximum
+  if (us > counter.maxUs.load(std::memory_order_relaxed))
+    counter.maxUs.store(us, std::memory_order_relaxed);
+}
+
+std::vector<SignalLatency> Protocol::GetLatencyStatistics() const
+{
+  std::vector<SignalLatency> statistics;
+  for (const bool isOut : {true, false})
+  {
+    const auto& counters = isOut ? outLatency : inLatency;
+    for (size_t i = 0; i < counters.size(); ++i)
+    {
+      const uint64_t count = counters[i].count.load(std::memory_order_relaxed);
+      if (count == 0)
+        continue;
+
+      statistics.emplace_back(static_cast<int>(i), isOut, count,
+                              std::chrono::microseconds(counters[i].totalUs / count),
+                              std::chrono::microseconds(counters[i].maxUs));
+    }
+  }
+  return statistics;
 }
 
 bool Protocol::SendOutMessage(int signal,
@@ -133,20 +246,9 @@ bool Protocol::SendOutMessage(int signal,
   msg->isOut = true;
 
   if (data)
-  {
-    if (size > sizeof(msg->buffer))
-      msg->data = new uint8_t[size];
-    else
-      msg->data = msg->buffer;
-    memcpy(msg->data, data, size);
-  }
+    msg->SetData(data, size);
 
-  {
-    std::unique_lock lock(criticalSection);
-    outMessages.push(msg);
-  }
-  if (containerOutEvent)
-    containerOutEvent->Set();
+  QueueMessage(msg);
 
   return true;
 }
@@ -164,12 +266,7 @@ bool Protocol::SendOutMessage(int signal, CPayloadWrapBase *payload, Message *ou
 
   msg->payloadObj.reset(payload);
 
-  {
-    std::unique_lock lock(criticalSection);
-    outMessages.push(msg);
-  }
-  if (containerOutEvent)
-    containerOutEvent->Set();
+  QueueMessage(msg);
 
   return true;
 }
@@ -189,20 +286,9 @@ bool Protocol::SendInMessage(int signal,
   msg->isOut = false;
 
   if (data)
-  {
-    if (size > sizeof(msg->data))
-      msg->data = new uint8_t[size];
-    else
-      msg->data = msg->buffer;
-    memcpy(msg->data, data, size);
-  }
+    msg->SetData(data, size);
 
-  {
-    std::unique_lock lock(criticalSection);
-    inMessages.push(msg);
-  }
-  if (containerInEvent)
-    containerInEvent->Set();
+  QueueMessage(msg);
 
   return true;
 }
@@ -220,12 +306,7 @@ bool Protocol::SendInMessage(int signal, CPayloadWrapBase *payload, Message *out
 
   msg->payloadObj.reset(payload);
 
-  {
-    std::unique_lock lock(criticalSection);
-    inMessages.push(msg);
-  }
-  if (containerInEvent)
-    containerInEvent->Set();
+  QueueMessage(msg);
 
   return true;
 }
@@ -239,8 +320,7 @@ bool Protocol::SendOutMessageSync(int signal,
   Message *msg = GetMessage();
   msg->isOut = true;
   msg->isSync = true;
-  msg->event = new CEvent;
-  msg->event->Reset();
+  msg->event = msg->GetSyncEvent();
   SendOutMessage(signal, data, size, msg);
 
   if (!msg->event->Wait(timeout))
@@ -273,8 +353,7 @@ bool Protocol::SendOutMessageSync(int signal,
   Message *msg = GetMessage();
   msg->isOut = true;
   msg->isSync = true;
-  msg->event = new CEvent;
-  msg->event->Reset();
+  msg->event = msg->GetSyncEvent();
   SendOutMessage(signal, payload, msg);
 
   if (!msg->event->Wait(timeout))
@@ -303,26 +382,20 @@ bool Protocol::ReceiveOutMessage(Message **msg)
 {
   std::unique_lock lock(criticalSection);
 
-  if (outMessages.empty() || outDefered)
+  if (outDefered)
     return false;
 
-  *msg = outMessages.front();
-  outMessages.pop();
-
-  return true;
+  return DequeueMessage(outRing, outMessages, msg);
 }
 
 bool Protocol::ReceiveInMessage(Message **msg)
 {
   std::unique_lock lock(criticalSection);
 
-  if (inMessages.empty() || inDefered)
+  if (inDefered)
     return false;
 
-  *msg = inMessages.front();
-  inMessages.pop();
-
-  return true;
+  return DequeueMessage(inRing, inMessages, msg);
 }
 
 
@@ -339,44 +412,30 @@ void Protocol::Purge()
 
 void Protocol::PurgeIn(int signal)
 {
-  Message *msg;
-  std::queue<Message*> msgs;
-
   std::unique_lock lock(criticalSection);
 
-  while (!inMessages.empty())
-  {
-    msg = inMessages.front();
-    inMessages.pop();
-    if (msg->signal != signal)
-      msgs.push(msg);
-  }
-  while (!msgs.empty())
-  {
-    msg = msgs.front();
-    msgs.pop();
-    inMessages.push(msg);
-  }
+  DrainRing(inRing, inMessages);
+  std::erase_if(inMessages,
+                [signal](Message* msg)
+                {
+                  if (msg->signal != signal)
+                    return false;
+                  msg->Release();
+                  return true;
+                });
 }
 
 void Protocol::PurgeOut(int signal)
 {
-  Message *msg;
-  std::queue<Message*> msgs;
-
   std::unique_lock lock(criticalSection);
 
-  while (!outMessages.empty())
-  {
-    msg = outMessages.front();
-    outMessages.pop();
-    if (msg->signal != signal)
-      msgs.push(msg);
-  }
-  while (!msgs.empty())
-  {
-    msg = msgs.front();
-    msgs.pop();
-    outMessages.push(msg);
-  }
+  DrainRing(outRing, outMessages);
+  std::erase_if(outMessages,
+                [signal](Message* msg)
+                {
+                  if (msg->signal != signal)
+                    return false;
+                  msg->Release();
+                  return true;
+                });
 }
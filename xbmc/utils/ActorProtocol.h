@@ -9,12 +9,17 @@
 #pragma once
 
 #include "threads/CriticalSection.h"
+#include "utils/MPSCRing.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <string>
 #include <utility>
+#include <vector>
 
 class CEvent;
 
@@ -46,9 +51,12 @@ class Message
 {
   friend class Protocol;
 
-  static constexpr size_t MSG_INTERNAL_BUFFER_SIZE = 32;
+  static constexpr size_t MSG_INTERNAL_BUFFER_SIZE = 64;
+  static constexpr size_t MSG_MAX_RETAINED_BUFFER_SIZE = 4096;
 
 public:
+  ~Message();
+
   int signal;
   bool isSync = false;
   bool isSyncFini;
@@ -61,6 +69,7 @@ public:
   Message *replyMessage = nullptr;
   Protocol &origin;
   CEvent *event = nullptr;
+  std::chrono::steady_clock::time_point sendTime;
 
   void Release();
   bool Reply(int sig, void *data = nullptr, size_t size = 0);
@@ -68,6 +77,29 @@ public:
 private:
   explicit Message(Protocol &_origin) noexcept
     :origin(_origin) {}
+
+  /*!
+   * \brief Copy data into the inline buffer or, if too large, into a heap buffer that is kept
+   * with the message for the next time it is taken from the pool.
+   */
+  void SetData(const void* payload, size_t size);
+  CEvent* GetSyncEvent();
+
+  std::unique_ptr<uint8_t[]> heapBuffer;
+  size_t heapBufferSize = 0;
+  std::unique_ptr<CEvent> syncEvent;
+};
+
+/*!
+ * \brief Time messages of a signal spent in a queue until they were received.
+ */
+struct SignalLatency
+{
+  int signal;
+  bool isOut;
+  uint64_t count;
+  std::chrono::microseconds average;
+  std::chrono::microseconds max;
 };
 
 class Protocol
@@ -109,15 +141,49 @@ public:
   void DeferOut(bool value) { outDefered = value; }
   void Lock() { criticalSection.lock(); }
   void Unlock() { criticalSection.unlock(); }
+
+  /*!
+   * \brief Get the queueing latency of all signals sent through this protocol so far.
+   */
+  std::vector<SignalLatency> GetLatencyStatistics() const;
+
   std::string portName;
 
 protected:
+  static constexpr size_t MESSAGE_RING_SIZE = 256;
+  static constexpr size_t MAX_SIGNALS = 64; //!< higher signals share the last counter
+
+  struct LatencyCounter
+  {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalUs{0};
+    std::atomic<uint64_t> maxUs{0};
+  };
+
+  using MessageRing = KODI::UTILS::CMPSCRing<Message*>;
+
+  void QueueMessage(Message* msg);
+  bool DequeueMessage(MessageRing& ring, std::deque<Message*>& messages, Message** msg);
+  void DrainRing(MessageRing& ring, std::deque<Message*>& messages);
+  void RecordLatency(const Message& msg);
+
   CEvent *containerInEvent, *containerOutEvent;
   CCriticalSection criticalSection;
-  std::queue<Message*> outMessages;
-  std::queue<Message*> inMessages;
-  std::queue<Message*> freeMessageQueue;
+
+  // senders push to the rings without locking. The deques are only used while a ring is full and
+  // hold messages that are older than everything in the ring.
+  MessageRing outRing{MESSAGE_RING_SIZE};
+  MessageRing inRing{MESSAGE_RING_SIZE};
+  std::deque<Message*> outMessages;
+  std::deque<Message*> inMessages;
+
+  CCriticalSection freeMessageSection;
+  std::vector<Message*> freeMessages;
+
   bool inDefered = false, outDefered = false;
+
+  std::array<LatencyCounter, MAX_SIGNALS> outLatency;
+  std::array<LatencyCounter, MAX_SIGNALS> inLatency;
 };
 
 }
@@ -0,0 +1,172 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AsyncLogSink.h"
+
+#include <chrono>
+#include <string>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// upper bound for how long a message may sit in the buffer unwritten
+constexpr auto MaxWriteDelay = 100ms;
+} // unnamed namespace
+
+CAsyncLogSink::CAsyncLogSink(std::shared_ptr<spdlog::sinks::sink> sink) : m_sink(std::move(sink))
+{
+}
+
+CAsyncLogSink::~CAsyncLogSink()
+{
+  Stop();
+
+  // write what was queued while stopping
+  if (m_ring)
+  {
+    spdlog::details::log_msg_buffer msg;
+    while (m_ring->TryPop(msg))
+      m_sink->log(msg);
+    m_sink->flush();
+  }
+}
+
+void CAsyncLogSink::Start(size_t queueSize, OverflowPolicy policy)
+{
+  std::unique_lock lock(m_mutex);
+
+  m_policy = policy;
+  if (m_async)
+    return;
+
+  if (!m_ring)
+    m_ring = std::make_unique<KODI::UTILS::CMPSCRing<spdlog::details::log_msg_buffer>>(queueSize);
+
+  m_stop = false;
+  m_thread = std::thread(&CAsyncLogSink::Process, this);
+  m_async = true;
+}
+
+void CAsyncLogSink::Stop()
+{
+  {
+    std::unique_lock lock(m_mutex);
+    if (!m_async)
+      return;
+
+    m_async = false;
+    m_stop = true;
+  }
+  m_wakeup.notify_one();
+
+  // the background thread writes everything buffered before it exits
+  m_thread.join();
+}
+
+void CAsyncLogSink::log(const spdlog::details::log_msg& msg)
+{
+  if (!m_async)
+  {
+    m_sink->log(msg);
+    return;
+  }
+
+  spdlog::details::log_msg_buffer buffer(msg);
+  while (!m_ring->TryPush(std::move(buffer)))
+  {
+    if (m_policy == OverflowPolicy::DROP)
+    {
+      ++m_dropped;
+      Wake();
+      return;
+    }
+
+    // BLOCK: give the background thread a chance to catch up, unless it is gone meanwhile
+    if (!m_async)
+    {
+      m_sink->log(buffer);
+      return;
+    }
+    Wake();
+    std::this_thread::yield();
+  }
+
+  Wake();
+}
+
+void CAsyncLogSink::flush()
+{
+  // in asynchronous mode every batch is flushed by the background thread
+  if (!m_async)
+    m_sink->flush();
+}
+
+void CAsyncLogSink::set_pattern(const std::string& pattern)
+{
+  m_sink->set_pattern(pattern);
+}
+
+void CAsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter)
+{
+  m_sink->set_formatter(std::move(formatter));
+}
+
+void CAsyncLogSink::Wake()
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_sleeping)
+  {
+    // taking the mutex makes sure the background thread is waiting already
+    {
+      std::unique_lock lock(m_mutex);
+    }
+    m_wakeup.notify_one();
+  }
+}
+
+void CAsyncLogSink::Process()
+{
+  spdlog::details::log_msg_buffer msg;
+  while (true)
+  {
+    bool written = false;
+    while (m_ring->TryPop(msg))
+    {
+      m_sink->log(msg);
+      written = true;
+    }
+
+    ReportDropped();
+    if (written)
+      m_sink->flush();
+
+    if (m_stop)
+      break;
+
+    std::unique_lock lock(m_mutex);
+    m_sleeping = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_ring->IsEmpty() && !m_stop)
+      m_wakeup.wait_for(lock, MaxWriteDelay);
+    m_sleeping = false;
+  }
+}
+
+void CAsyncLogSink::ReportDropped()
+{
+  const uint64_t dropped = m_dropped;
+  if (dropped == m_reportedDropped)
+    return;
+
+  const std::string message =
+      std::to_string(dropped - m_reportedDropped) + " log messages dropped, log buffer full";
+  m_reportedDropped = dropped;
+
+  m_sink->log(spdlog::details::log_msg("general", spdlog::level::warn, message));
+}
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/MPSCRing.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+
+/*!
+ * \brief Sink in front of the log sinks, which optionally hands messages over to a dedicated
+ * thread.
+ *
+ * In synchronous mode messages are passed on directly. In asynchronous mode they are copied into
+ * a preallocated ring buffer and written, and flushed, in batches by a background thread, so
+ * slow sinks like the log file don't block the logging thread. Loggers keep pointing to this
+ * sink, so the mode can be changed at any time.
+ */
+class CAsyncLogSink : public spdlog::sinks::sink
+{
+public:
+  enum class OverflowPolicy
+  {
+    DROP, //!< drop messages while the buffer is full
+    BLOCK, //!< wait for the background thread to make room
+  };
+
+  explicit CAsyncLogSink(std::shared_ptr<spdlog::sinks::sink> sink);
+  ~CAsyncLogSink() override;
+
+  /*!
+   * \brief Start writing messages from a background thread.
+   * \param queueSize number of buffered messages. The buffer is allocated once, later calls keep
+   * the size of the first one.
+   * \param policy what to do if the buffer is full
+   */
+  void Start(size_t queueSize, OverflowPolicy policy);
+
+  /*!
+   * \brief Write all buffered messages and go back to synchronous mode.
+   */
+  void Stop();
+
+  bool IsAsync() const { return m_async; }
+  uint64_t GetDropped() const { return m_dropped; }
+
+  // implementation of spdlog::sinks::sink
+  void log(const spdlog::details::log_msg& msg) override;
+  void flush() override;
+  void set_pattern(const std::string& pattern) override;
+  void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+private:
+  void Process();
+  void Wake();
+  void ReportDropped();
+
+  std::shared_ptr<spdlog::sinks::sink> m_sink;
+
+  std::unique_ptr<KODI::UTILS::CMPSCRing<spdlog::details::log_msg_buffer>> m_ring;
+  std::atomic<bool> m_async{false};
+  OverflowPolicy m_policy{OverflowPolicy::DROP};
+
+  std::atomic<uint64_t> m_dropped{0};
+  uint64_t m_reportedDropped{0};
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::atomic<bool> m_sleeping{false};
+  std::atomic<bool> m_stop{false};
+  std::thread m_thread;
+};
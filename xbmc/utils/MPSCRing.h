@@ -0,0 +1,112 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace KODI::UTILS
+{
+
+/*!
+ * \brief Bounded lock-free multi-producer/single-consumer ring.
+ *
+ * Producers never block: TryPush() fails if the ring is full and the caller has to fall back to
+ * a locked path. Pop operations must be serialised by the owner, e.g. by only calling them with
+ * a lock held or from a single thread.
+ */
+template<typename T>
+class CMPSCRing
+{
+public:
+  explicit CMPSCRing(size_t capacity)
+    : m_cells(std::make_unique<Cell[]>(std::bit_ceil(std::max<size_t>(capacity, 2)))),
+      m_mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+  {
+    for (size_t i = 0; i <= m_mask; ++i)
+      m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+  }
+
+  template<typename U>
+  bool TryPush(U&& value)
+  {
+    // each cell carries a sequence number telling producers and the consumer whose turn it is
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true)
+    {
+      cell = &m_cells[pos & m_mask];
+      const size_t seq = cell->m_sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+      if (diff == 0)
+      {
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      }
+      else if (diff < 0)
+        return false; // full
+      else
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+
+    cell->m_value = std::forward<U>(value);
+    cell->m_sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPop(T& value)
+  {
+    Cell& cell = m_cells[m_dequeuePos & m_mask];
+    const size_t seq = cell.m_sequence.load(std::memory_order_acquire);
+    if (static_cast<std::ptrdiff_t>(seq - (m_dequeuePos + 1)) < 0)
+      return false;
+
+    value = std::move(cell.m_value);
+    cell.m_value = T();
+    cell.m_sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePos;
+    return true;
+  }
+
+  bool IsEmpty() const
+  {
+    const Cell& cell = m_cells[m_dequeuePos & m_mask];
+    return static_cast<std::ptrdiff_t>(cell.m_sequence.load(std::memory_order_acquire) -
+                                       (m_dequeuePos + 1)) < 0;
+  }
+
+  /*!
+   * \brief Positions of the next push and pop. Values between them are reserved by producers,
+   * but might not be published yet.
+   */
+  size_t GetPushPosition() const { return m_enqueuePos.load(std::memory_order_acquire); }
+  size_t GetPopPosition() const { return m_dequeuePos; }
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> m_sequence;
+    T m_value{};
+  };
+
+  // fixed instead of std::hardware_destructive_interference_size, which GCC warns about as it
+  // depends on the tuning flags
+  static constexpr size_t CACHE_LINE = 64;
+
+  std::unique_ptr<Cell[]> m_cells;
+  const size_t m_mask;
+  alignas(CACHE_LINE) std::atomic<size_t> m_enqueuePos{0};
+  alignas(CACHE_LINE) size_t m_dequeuePos{0};
+};
+
+} // namespace KODI::UTILS
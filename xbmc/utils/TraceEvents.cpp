@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TraceEvents.h"
+
+#include "filesystem/File.h"
+#include "threads/Thread.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <algorithm>
+
+using namespace KODI::UTILS;
+
+namespace
+{
+constexpr int64_t ProcessId = 1;
+
+int64_t ToMicroseconds(std::chrono::steady_clock::duration duration)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+} // unnamed namespace
+
+CTraceRecorder& CTraceRecorder::GetInstance()
+{
+  // intentionally leaked, scopes may still end while static objects are destroyed
+  static CTraceRecorder* recorder = new CTraceRecorder();
+  return *recorder;
+}
+
+void CTraceRecorder::Start()
+{
+  std::unique_lock lock(m_mutex);
+
+  // forget threads which are gone, clear the others
+  std::erase_if(m_buffers, [](const auto& buffer) { return buffer.use_count() == 1; });
+  for (const auto& buffer : m_buffers)
+  {
+    std::unique_lock bufferLock(buffer->mutex);
+    buffer->events.clear();
+    buffer->next = 0;
+  }
+
+  m_epoch = std::chrono::steady_clock::now().time_since_epoch().count();
+  m_capturing = true;
+}
+
+bool CTraceRecorder::Stop(const std::string& path)
+{
+  m_capturing = false;
+
+  const std::string json = Serialize();
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::Log(LOGERROR, "CTraceRecorder: failed to write trace to {}", path);
+    return false;
+  }
+
+  CLog::Log(LOGINFO, "CTraceRecorder: trace written to {}", path);
+  return true;
+}
+
+CTraceRecorder::ThreadBuffer& CTraceRecorder::GetThreadBuffer()
+{
+  thread_local std::shared_ptr<ThreadBuffer> threadBuffer;
+  if (!threadBuffer)
+  {
+    auto buffer = std::make_shared<ThreadBuffer>();
+    buffer->events.reserve(EVENTS_PER_THREAD);
+
+    const CThread* thread = CThread::GetCurrentThread();
+    if (thread)
+      buffer->threadName = thread->GetThreadName();
+
+    std::unique_lock lock(m_mutex);
+    buffer->threadId = m_nextThreadId++;
+    if (buffer->threadName.empty())
+      buffer->threadName = "Thread " + std::to_string(buffer->threadId);
+    m_buffers.emplace_back(buffer);
+    threadBuffer = std::move(buffer);
+  }
+  return *threadBuffer;
+}
+
+void CTraceRecorder::AddEvent(const char* category,
+                              const char* name,
+                              std::chrono::steady_clock::time_point start,
+                              std::chrono::steady_clock::time_point end)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+
+  std::unique_lock lock(buffer.mutex);
+  const Event event{category, name, start, end - start};
+  if (buffer.events.size() < EVENTS_PER_THREAD)
+    buffer.events.emplace_back(event);
+  else
+    buffer.events[buffer.next] = event;
+  buffer.next = (buffer.next + 1) % EVENTS_PER_THREAD;
+}
+
+std::string CTraceRecorder::Serialize() const
+{
+  const std::chrono::steady_clock::time_point epoch{std::chrono::steady_clock::duration(m_epoch)};
+
+  CVariant events(CVariant::VariantTypeArray);
+  {
+    std::unique_lock lock(m_mutex);
+    for (const auto& buffer : m_buffers)
+    {
+      std::unique_lock bufferLock(buffer->mutex);
+      if (buffer->events.empty())
+        continue;
+
+      CVariant threadName(CVariant::VariantTypeObject);
+      threadName["name"] = "thread_name";
+      threadName["ph"] = "M";
+      threadName["pid"] = ProcessId;
+      threadName["tid"] = buffer->threadId;
+      threadName["args"]["name"] = buffer->threadName;
+      events.push_back(std::move(threadName));
+
+      for (const auto& event : buffer->events)
+      {
+        // scopes which were entered before the capture started
+        if (event.start < epoch)
+          continue;
+
+        CVariant entry(CVariant::VariantTypeObject);
+        entry["name"] = event.name;
+        entry["cat"] = event.category;
+        entry["ph"] = "X";
+        entry["ts"] = ToMicroseconds(event.start - epoch);
+        entry["dur"] = ToMicroseconds(event.duration);
+        entry["pid"] = ProcessId;
+        entry["tid"] = buffer->threadId;
+        events.push_back(std::move(entry));
+      }
+    }
+  }
+
+  CVariant trace(CVariant::VariantTypeObject);
+  trace["traceEvents"] = std::move(events);
+  trace["displayTimeUnit"] = "ms";
+
+  std::string json;
+  CJSONVariantWriter::Write(trace, json, true);
+  return json;
+}
@@ -0,0 +1,146 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace KODI::UTILS
+{
+
+/*!
+ * \brief Records scoped trace events and writes them in the trace event JSON format, which can
+ * be opened in Perfetto or chrome://tracing.
+ *
+ * Every thread records into its own fixed size ring buffer, so recording never contends with
+ * other threads. Only the most recent events of each thread are kept. Event names and categories
+ * are stored as pointers and have to stay valid until the capture is written, string literals
+ * are the norm.
+ *
+ * Instrumentation is added with KODI_TRACE_SCOPE, which compiles to nothing unless built with
+ * ENABLE_TRACE_EVENTS.
+ */
+class CTraceRecorder
+{
+public:
+  static constexpr size_t EVENTS_PER_THREAD = 8192;
+
+  static CTraceRecorder& GetInstance();
+
+  static constexpr bool IsEnabled()
+  {
+#if defined(HAS_TRACE_EVENTS)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /*!
+   * \brief Discard previously recorded events and start recording.
+   */
+  void Start();
+
+  /*!
+   * \brief Stop recording and write the capture to the given file.
+   * \return true if the file was written
+   */
+  bool Stop(const std::string& path);
+
+  bool IsCapturing() const { return m_capturing.load(std::memory_order_relaxed); }
+
+  void AddEvent(const char* category,
+                const char* name,
+                std::chrono::steady_clock::time_point start,
+                std::chrono::steady_clock::time_point end);
+
+  /*!
+   * \brief Get the recorded events as trace event JSON.
+   */
+  std::string Serialize() const;
+
+private:
+  CTraceRecorder() = default;
+
+  struct Event
+  {
+    const char* category;
+    const char* name;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::duration duration;
+  };
+
+  struct ThreadBuffer
+  {
+    // only contended while a capture is started or written
+    std::mutex mutex;
+    std::vector<Event> events;
+    size_t next{0};
+    uint64_t threadId{0};
+    std::string threadName;
+  };
+
+  ThreadBuffer& GetThreadBuffer();
+
+  std::atomic<bool> m_capturing{false};
+  std::atomic<std::chrono::steady_clock::rep> m_epoch{0};
+
+  mutable std::mutex m_mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+  uint64_t m_nextThreadId{1};
+};
+
+/*!
+ * \brief Records the lifetime of the object as trace event, if a capture is running.
+ */
+class CTraceScope
+{
+public:
+  CTraceScope(const char* category, const char* name)
+    : m_category(category),
+      m_name(name),
+      m_capturing(CTraceRecorder::GetInstance().IsCapturing())
+  {
+    if (m_capturing)
+      m_start = std::chrono::steady_clock::now();
+  }
+
+  ~CTraceScope()
+  {
+    if (m_capturing)
+      CTraceRecorder::GetInstance().AddEvent(m_category, m_name, m_start,
+                                             std::chrono::steady_clock::now());
+  }
+
+  CTraceScope(const CTraceScope&) = delete;
+  CTraceScope& operator=(const CTraceScope&) = delete;
+
+private:
+  const char* m_category;
+  const char* m_name;
+  const bool m_capturing;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace KODI::UTILS
+
+#define KODI_TRACE_CONCAT_IMPL(a, b) a##b
+#define KODI_TRACE_CONCAT(a, b) KODI_TRACE_CONCAT_IMPL(a, b)
+
+#if defined(HAS_TRACE_EVENTS)
+#define KODI_TRACE_SCOPE(category, name) \
+  const KODI::UTILS::CTraceScope KODI_TRACE_CONCAT(traceScope, __LINE__)((category), (name))
+#else
+#define KODI_TRACE_SCOPE(category, name) static_cast<void>(0)
+#endif
@@ -19,10 +19,13 @@
 #include "settings/SettingsContainer.h"
 #include "settings/lib/Setting.h"
 #include "settings/lib/SettingsManager.h"
+#include "utils/AsyncLogSink.h"
 #include "utils/Map.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 
+#include <bit>
+#include <chrono>
 #include <cstring>
 #include <set>
 
@@ -87,6 +90,7 @@ constexpr auto componentMap = make_map<int, ComponentInfo>({
 CLog::CLog()
   : m_platform(IPlatformLog::CreatePlatformLog()),
     m_sinks(std::make_shared<spdlog::sinks::dist_sink_mt>()),
+    m_asyncSink(std::make_shared<CAsyncLogSink>(m_sinks)),
     m_defaultLogger(CreateLogger("general"))
 {
   // add platform-specific debug sinks
@@ -193,6 +197,9 @@ void CLog::Deinitialize()
   if (m_fileSink == nullptr)
     return;
 
+  // write out everything still buffered
+  m_asyncSink->Stop();
+
   // flush all loggers
   spdlog::apply_all([](const std::shared_ptr<spdlog::logger>& logger) { logger->flush(); });
 
@@ -225,6 +232,26 @@ void CLog::SetLogLevel(int level)
                        fmt::make_format_args(spdlog::level::to_string_view(spdLevel)));
 }
 
+void CLog::SetAsync(bool async, size_t queueSize, bool block)
+{
+  if (async == m_asyncSink->IsAsync())
+    return;
+
+  if (async)
+    m_asyncSink->Start(queueSize, block ? CAsyncLogSink::OverflowPolicy::BLOCK
+                                        : CAsyncLogSink::OverflowPolicy::DROP);
+  else
+    m_asyncSink->Stop();
+
+  FormatAndLogInternal(spdlog::level::info, LOG_COMPONENT_GENERAL, "Asynchronous logging {}",
+                       fmt::make_format_args(async ? "enabled" : "disabled"));
+}
+
+void CLog::SetComponentRateLimit(unsigned int messagesPerSecond)
+{
+  m_componentRateLimit = messagesPerSecond;
+}
+
 bool CLog::IsLogLevelLogged(int loglevel) const
 {
   if (m_logLevel >= LOG_LEVEL_DEBUG)
@@ -316,6 +343,9 @@ void CLog::FormatAndLogInternal(spdlog::level::level_enum level,
   if (level < m_defaultLogger->level())
     return;
 
+  if (component != LOG_COMPONENT_GENERAL && IsComponentRateLimited(component))
+    return;
+
   auto message = fmt::vformat(format, args);
   FormatLineBreaks(message);
   GetLoggerById(component)->log(level, message);
@@ -337,7 +367,7 @@ void CLog::FormatAndLogInternal(const std::string& loggerName,
 Logger CLog::CreateLogger(const std::string& loggerName)
 {
   // create the logger
-  auto logger = std::make_shared<spdlog::logger>(loggerName, m_sinks);
+  auto logger = std::make_shared<spdlog::logger>(loggerName, m_asyncSink);
 
   // initialize the logger
   spdlog::initialize_logger(logger);
@@ -357,6 +387,35 @@ void CLog::SetComponentLogLevel(const std::vector<CVariant>& components)
   }
 }
 
+bool CLog::IsComponentRateLimited(uint32_t component)
+{
+  const uint32_t limit = m_componentRateLimit;
+  if (limit == 0)
+    return false;
+
+  auto& window = m_rateLimitWindows[std::countr_zero(component) % m_rateLimitWindows.size()];
+
+  const int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+  int64_t start = window.start;
+  if (now - start >= 1000 && window.start.compare_exchange_strong(start, now))
+  {
+    window.messages = 0;
+    const uint32_t suppressed = window.suppressed.exchange(0);
+    if (suppressed > 0)
+      GetLoggerById(component)->log(spdlog::level::warn,
+                                    "{} messages suppressed, more than {} per second", suppressed,
+                                    limit);
+  }
+
+  if (window.messages++ < limit)
+    return false;
+
+  ++window.suppressed;
+  return true;
+}
+
 void CLog::FormatLineBreaks(std::string& message) const
 {
   // fixup newline alignment, number of spaces should equal prefix length
@@ -30,12 +30,16 @@
 #include "utils/IPlatformLog.h"
 #include "utils/logtypes.h"
 
+#include <array>
+#include <atomic>
 #include <source_location>
 #include <string>
 #include <vector>
 
 #include <spdlog/spdlog.h>
 
+class CAsyncLogSink;
+
 namespace spdlog::sinks
 {
 class sink;
@@ -79,6 +83,21 @@ public:
   int GetLogLevel() const { return m_logLevel; }
   bool IsLogLevelLogged(int loglevel) const;
 
+  /*!
+   * \brief Write log messages from a dedicated thread instead of the logging one.
+   * \param async whether to write asynchronously
+   * \param queueSize number of messages which can be buffered
+   * \param block whether to wait for room in a full buffer instead of dropping the message
+   */
+  void SetAsync(bool async, size_t queueSize = 8192, bool block = false);
+
+  /*!
+   * \brief Limit the number of messages each log component may write per second.
+   * Suppressed messages are counted and reported once the next second starts.
+   * \param messagesPerSecond maximum number of messages, 0 to disable the limit
+   */
+  void SetComponentRateLimit(unsigned int messagesPerSecond);
+
   bool CanLogComponent(uint32_t component) const;
   static void SettingOptionsLoggingComponentsFiller(const std::shared_ptr<const CSetting>& setting,
                                                     std::vector<IntegerSettingOption>& list,
@@ -166,8 +185,11 @@ private:
 
   void FormatLineBreaks(std::string& message) const;
 
+  bool IsComponentRateLimited(uint32_t component);
+
   std::unique_ptr<IPlatformLog> m_platform;
   std::shared_ptr<spdlog::sinks::dist_sink<std::mutex>> m_sinks;
+  std::shared_ptr<CAsyncLogSink> m_asyncSink;
   Logger m_defaultLogger;
 
   std::shared_ptr<spdlog::sinks::sink> m_fileSink;
@@ -176,4 +198,13 @@ private:
 
   bool m_componentLogEnabled{false};
   uint32_t m_componentLogLevels{0};
+
+  struct RateLimitWindow
+  {
+    std::atomic<int64_t> start{0}; //!< begin of the current one second window in milliseconds
+    std::atomic<uint32_t> messages{0};
+    std::atomic<uint32_t> suppressed{0};
+  };
+  std::atomic<uint32_t> m_componentRateLimit{0};
+  std::array<RateLimitWindow, 32> m_rateLimitWindows;
 };
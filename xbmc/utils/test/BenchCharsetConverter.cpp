@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/CharsetConverter.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string UTF8_TEXT = "Amélie – Le Fabuleux Destin d'Amélie Poulain (Ünïcödé テスト)";
+} // unnamed namespace
+
+static void BM_CharsetConverter_Utf8ToW(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::wstring result;
+    CCharsetConverter::utf8ToW(UTF8_TEXT, result, false);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_CharsetConverter_Utf8ToW);
+
+static void BM_CharsetConverter_Utf8ToWBidi(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::wstring result;
+    CCharsetConverter::utf8ToW(UTF8_TEXT, result, true);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_CharsetConverter_Utf8ToWBidi);
+
+static void BM_CharsetConverter_WToUtf8(benchmark::State& state)
+{
+  std::wstring wide;
+  CCharsetConverter::utf8ToW(UTF8_TEXT, wide, false);
+  for (auto _ : state)
+  {
+    std::string result;
+    CCharsetConverter::wToUTF8(wide, result);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_CharsetConverter_WToUtf8);
+
+static void BM_CharsetConverter_Latin1ToUtf8(benchmark::State& state)
+{
+  const std::string latin1 = "Am\xe9lie - Le Fabuleux Destin d'Am\xe9lie Poulain";
+  for (auto _ : state)
+  {
+    std::string result;
+    CCharsetConverter::ToUtf8("ISO-8859-1", latin1, result);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_CharsetConverter_Latin1ToUtf8);
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+std::string MakeResponse(int items)
+{
+  CVariant result(CVariant::VariantTypeObject);
+  result["jsonrpc"] = "2.0";
+  result["id"] = 1;
+  for (int i = 0; i < items; ++i)
+  {
+    CVariant movie(CVariant::VariantTypeObject);
+    movie["movieid"] = i;
+    movie["label"] = "Movie " + std::to_string(i);
+    movie["file"] = "smb://server/share/Movies/Movie " + std::to_string(i) + ".mkv";
+    movie["rating"] = 6.5 + (i % 30) / 10.0;
+    movie["year"] = 1990 + i % 35;
+    movie["genre"].push_back("Drama");
+    movie["genre"].push_back("Comedy");
+    result["result"]["movies"].push_back(std::move(movie));
+  }
+
+  std::string json;
+  CJSONVariantWriter::Write(result, json, true);
+  return json;
+}
+} // unnamed namespace
+
+static void BM_JSONVariantParser_Parse(benchmark::State& state)
+{
+  const std::string json = MakeResponse(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    CVariant data;
+    benchmark::DoNotOptimize(CJSONVariantParser::Parse(json, data));
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JSONVariantParser_Parse)->Arg(1)->Arg(100)->Arg(2000);
+
+static void BM_JSONVariantWriter_Write(benchmark::State& state)
+{
+  CVariant data;
+  CJSONVariantParser::Parse(MakeResponse(static_cast<int>(state.range(0))), data);
+  for (auto _ : state)
+  {
+    std::string json;
+    benchmark::DoNotOptimize(CJSONVariantWriter::Write(data, json, true));
+  }
+}
+BENCHMARK(BM_JSONVariantWriter_Write)->Arg(1)->Arg(100)->Arg(2000);
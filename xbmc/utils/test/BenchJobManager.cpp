@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "jobs/JobManager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+constexpr int PRODUCERS = 4;
+constexpr int JOBS_PER_PRODUCER = 2500;
+
+void SchedulerThroughput(benchmark::State& state, bool workStealing)
+{
+  using clock = std::chrono::steady_clock;
+
+  CJobManager jobManager;
+  jobManager.SetWorkStealing(workStealing);
+
+  constexpr int total = PRODUCERS * JOBS_PER_PRODUCER;
+  std::vector<int64_t> latencies(total);
+
+  for (auto _ : state)
+  {
+    std::atomic<int> done{0};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+      producers.emplace_back(
+          [&, p]
+          {
+            for (int i = 0; i < JOBS_PER_PRODUCER; ++i)
+            {
+              const int slot = p * JOBS_PER_PRODUCER + i;
+              const auto queued = clock::now();
+              jobManager.Submit(
+                  [&latencies, &done, slot, queued]
+                  {
+                    latencies[slot] = std::chrono::duration_cast<std::chrono::microseconds>(
+                                          clock::now() - queued)
+                                          .count();
+                    ++done;
+                  },
+                  CJob::PRIORITY(i % (CJob::PRIORITY_HIGH + 1)));
+            }
+          });
+    }
+    for (auto& producer : producers)
+      producer.join();
+
+    // the jobs reference this iteration's counter, all of them have to finish
+    while (done < total)
+      std::this_thread::yield();
+  }
+
+  jobManager.CancelJobs();
+
+  std::ranges::sort(latencies);
+  state.SetItemsProcessed(state.iterations() * total);
+  state.counters["p50_latency_us"] = static_cast<double>(latencies[total / 2]);
+  state.counters["p99_latency_us"] = static_cast<double>(latencies[total * 99 / 100]);
+}
+} // unnamed namespace
+
+static void BM_JobManager_Throughput(benchmark::State& state, bool workStealing)
+{
+  SchedulerThroughput(state, workStealing);
+}
+BENCHMARK_CAPTURE(BM_JobManager_Throughput, GlobalQueue, false)->UseRealTime();
+BENCHMARK_CAPTURE(BM_JobManager_Throughput, WorkStealing, true)->UseRealTime();
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SortUtils.h"
+#include "utils/Variant.h"
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+SortItems MakeItems(int count)
+{
+  std::mt19937 random(42);
+  std::uniform_int_distribution<int> year(1950, 2025);
+
+  SortItems items;
+  items.reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    auto item = std::make_shared<SortItem>();
+    (*item)[Field::LABEL] = "The Title " + std::to_string(random() % 10000);
+    (*item)[Field::TITLE] = (*item)[Field::LABEL];
+    (*item)[Field::YEAR] = year(random);
+    (*item)[Field::ARTIST] = "Artist " + std::to_string(random() % 500);
+    items.push_back(std::move(item));
+  }
+  return items;
+}
+} // unnamed namespace
+
+static void BM_SortUtils_SortByLabel(benchmark::State& state)
+{
+  const SortItems original = MakeItems(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems items = original;
+    state.ResumeTiming();
+    SortUtils::Sort(SortBy::LABEL, SortOrder::ASCENDING, SortAttributeIgnoreArticle, items);
+    benchmark::DoNotOptimize(items);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortUtils_SortByLabel)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_SortUtils_SortByYear(benchmark::State& state)
+{
+  const SortItems original = MakeItems(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems items = original;
+    state.ResumeTiming();
+    SortUtils::Sort(SortBy::YEAR, SortOrder::DESCENDING, SortAttributeNone, items);
+    benchmark::DoNotOptimize(items);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortUtils_SortByYear)->Arg(1000)->Arg(10000);
+
+static void BM_SortUtils_SortByArtistLimited(benchmark::State& state)
+{
+  const SortItems original = MakeItems(10000);
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems items = original;
+    state.ResumeTiming();
+    SortUtils::Sort(SortBy::ARTIST, SortOrder::ASCENDING, SortAttributeNone, items, 50);
+    benchmark::DoNotOptimize(items);
+  }
+}
+BENCHMARK(BM_SortUtils_SortByArtistLimited);
@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string LONG_PATH =
+    "smb://server/share/Movies/Some Movie (2019)/Some.Movie.2019.2160p.UHD.BluRay.x265-GROUP.mkv";
+
+std::string MakeList(int entries)
+{
+  std::vector<std::string> parts;
+  for (int i = 0; i < entries; ++i)
+    parts.emplace_back("entry" + std::to_string(i));
+  return StringUtils::Join(parts, " / ");
+}
+} // unnamed namespace
+
+static void BM_StringUtils_ToLower(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string str = LONG_PATH;
+    StringUtils::ToLower(str);
+    benchmark::DoNotOptimize(str);
+  }
+}
+BENCHMARK(BM_StringUtils_ToLower);
+
+static void BM_StringUtils_EqualsNoCase(benchmark::State& state)
+{
+  std::string upper = LONG_PATH;
+  StringUtils::ToUpper(upper);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::EqualsNoCase(LONG_PATH, upper));
+}
+BENCHMARK(BM_StringUtils_EqualsNoCase);
+
+static void BM_StringUtils_Split(benchmark::State& state)
+{
+  const std::string list = MakeList(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::Split(list, " / "));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringUtils_Split)->Arg(8)->Arg(64)->Arg(512);
+
+static void BM_StringUtils_Replace(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string str = LONG_PATH;
+    benchmark::DoNotOptimize(StringUtils::Replace(str, ".", " "));
+  }
+}
+BENCHMARK(BM_StringUtils_Replace);
+
+static void BM_StringUtils_Trim(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string str = "   \t " + LONG_PATH + " \r\n  ";
+    benchmark::DoNotOptimize(StringUtils::Trim(str));
+  }
+}
+BENCHMARK(BM_StringUtils_Trim);
+
+static void BM_StringUtils_Format(benchmark::State& state)
+{
+  int i = 0;
+  for (auto _ : state)
+  {
+    const int n = ++i;
+    benchmark::DoNotOptimize(StringUtils::Format("{}/{:04d} - {:.2f}%", LONG_PATH, n, n / 3.0));
+  }
+}
+BENCHMARK(BM_StringUtils_Format);
+
+static void BM_StringUtils_AlphaNumericCompare(benchmark::State& state)
+{
+  const std::wstring left = L"Episode 10 - The Title of the Episode";
+  const std::wstring right = L"Episode 9 - The Title of the Episode";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::AlphaNumericCompare(left, right));
+}
+BENCHMARK(BM_StringUtils_AlphaNumericCompare);
@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+CVariant MakeObject(int members)
+{
+  CVariant object(CVariant::VariantTypeObject);
+  for (int i = 0; i < members; ++i)
+  {
+    const std::string key = "member" + std::to_string(i);
+    object[key]["title"] = "A title";
+    object[key]["year"] = 2000 + i;
+    object[key]["rating"] = 7.5;
+    object[key]["genres"].push_back("Drama");
+    object[key]["genres"].push_back("Thriller");
+  }
+  return object;
+}
+} // unnamed namespace
+
+static void BM_Variant_BuildObject(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(MakeObject(static_cast<int>(state.range(0))));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Variant_BuildObject)->Arg(16)->Arg(256);
+
+static void BM_Variant_Copy(benchmark::State& state)
+{
+  const CVariant object = MakeObject(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    CVariant copy(object);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_Variant_Copy)->Arg(16)->Arg(256);
+
+static void BM_Variant_MemberLookup(benchmark::State& state)
+{
+  const CVariant object = MakeObject(256);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(object["member128"]["year"].asInteger());
+}
+BENCHMARK(BM_Variant_MemberLookup);
+
+static void BM_Variant_AsString(benchmark::State& state)
+{
+  const CVariant value(123456789);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(value.asString());
+}
+BENCHMARK(BM_Variant_AsString);
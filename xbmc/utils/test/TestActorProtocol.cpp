@@ -0,0 +1,201 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/Event.h"
+#include "utils/ActorProtocol.h"
+
+#include <array>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Actor;
+using namespace std::chrono_literals;
+
+namespace
+{
+enum Signals
+{
+  PING,
+  DATA,
+  LARGE_DATA,
+};
+
+struct Item
+{
+  int producer;
+  int sequence;
+};
+} // unnamed namespace
+
+TEST(TestActorProtocol, OrderAndData)
+{
+  CEvent outEvent;
+  Protocol protocol("test", nullptr, &outEvent);
+
+  // more messages than the lock-free ring holds
+  for (int i = 0; i < 1000; ++i)
+  {
+    Item item{0, i};
+    protocol.SendOutMessage(DATA, &item, sizeof(item));
+  }
+  EXPECT_TRUE(outEvent.Wait(0ms));
+
+  Message* msg;
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_TRUE(protocol.ReceiveOutMessage(&msg));
+    EXPECT_EQ(DATA, msg->signal);
+    EXPECT_TRUE(msg->isOut);
+    EXPECT_EQ(sizeof(Item), msg->payloadSize);
+    EXPECT_EQ(i, reinterpret_cast<Item*>(msg->data)->sequence);
+    msg->Release();
+  }
+  EXPECT_FALSE(protocol.ReceiveOutMessage(&msg));
+  EXPECT_FALSE(protocol.ReceiveInMessage(&msg));
+}
+
+TEST(TestActorProtocol, LargeDataAndReuse)
+{
+  Protocol protocol("test");
+
+  std::array<char, 1000> large;
+  for (size_t i = 0; i < large.size(); ++i)
+    large[i] = static_cast<char>(i);
+
+  for (int round = 0; round < 3; ++round)
+  {
+    protocol.SendInMessage(LARGE_DATA, large.data(), large.size());
+
+    Message* msg;
+    ASSERT_TRUE(protocol.ReceiveInMessage(&msg));
+    EXPECT_FALSE(msg->isOut);
+    ASSERT_EQ(large.size(), msg->payloadSize);
+    EXPECT_EQ(0, memcmp(large.data(), msg->data, large.size()));
+    msg->Release();
+  }
+}
+
+TEST(TestActorProtocol, Defer)
+{
+  Protocol protocol("test");
+  protocol.SendInMessage(PING);
+
+  Message* msg;
+  protocol.DeferIn(true);
+  EXPECT_FALSE(protocol.ReceiveInMessage(&msg));
+  protocol.DeferIn(false);
+  ASSERT_TRUE(protocol.ReceiveInMessage(&msg));
+  msg->Release();
+}
+
+TEST(TestActorProtocol, PurgeOut)
+{
+  Protocol protocol("test");
+  for (int i = 0; i < 400; ++i)
+    protocol.SendOutMessage(i % 2 ? PING : DATA);
+
+  protocol.PurgeOut(PING);
+
+  int received = 0;
+  Message* msg;
+  while (protocol.ReceiveOutMessage(&msg))
+  {
+    EXPECT_EQ(DATA, msg->signal);
+    msg->Release();
+    ++received;
+  }
+  EXPECT_EQ(200, received);
+}
+
+TEST(TestActorProtocol, SyncMessage)
+{
+  CEvent outEvent;
+  Protocol protocol("test", nullptr, &outEvent);
+
+  std::thread actor(
+      [&]
+      {
+        for (int i = 0; i < 100; ++i)
+        {
+          Message* msg;
+          while (!protocol.ReceiveOutMessage(&msg))
+            outEvent.Wait(100ms);
+
+          int value = *reinterpret_cast<int*>(msg->data) + 1;
+          msg->Reply(DATA, &value, sizeof(value));
+          msg->Release();
+        }
+      });
+
+  for (int i = 0; i < 100; ++i)
+  {
+    Message* reply = nullptr;
+    ASSERT_TRUE(protocol.SendOutMessageSync(PING, &reply, 5s, &i, sizeof(i)));
+    ASSERT_NE(nullptr, reply);
+    EXPECT_EQ(DATA, reply->signal);
+    EXPECT_EQ(i + 1, *reinterpret_cast<int*>(reply->data));
+    reply->Release();
+  }
+
+  actor.join();
+}
+
+TEST(TestActorProtocol, MultipleSenders)
+{
+  constexpr int SENDERS = 4;
+  constexpr int MESSAGES = 20000;
+
+  CEvent inEvent;
+  Protocol protocol("test", &inEvent, nullptr);
+
+  std::vector<std::thread> senders;
+  for (int sender = 0; sender < SENDERS; ++sender)
+  {
+    senders.emplace_back(
+        [&protocol, sender]
+        {
+          for (int i = 0; i < MESSAGES; ++i)
+          {
+            Item item{sender, i};
+            protocol.SendInMessage(DATA, &item, sizeof(item));
+          }
+        });
+  }
+
+  std::vector<int> next(SENDERS, 0);
+  int received = 0;
+  while (received < SENDERS * MESSAGES)
+  {
+    Message* msg;
+    if (!protocol.ReceiveInMessage(&msg))
+    {
+      ASSERT_TRUE(inEvent.Wait(1s));
+      continue;
+    }
+
+    // messages of every single sender keep their order
+    const Item item = *reinterpret_cast<Item*>(msg->data);
+    ASSERT_EQ(next[item.producer], item.sequence);
+    ++next[item.producer];
+    ++received;
+    msg->Release();
+  }
+
+  for (auto& sender : senders)
+    sender.join();
+
+  const std::vector<SignalLatency> statistics = protocol.GetLatencyStatistics();
+  ASSERT_EQ(1U, statistics.size());
+  EXPECT_EQ(DATA, statistics[0].signal);
+  EXPECT_FALSE(statistics[0].isOut);
+  EXPECT_EQ(static_cast<uint64_t>(SENDERS * MESSAGES), statistics[0].count);
+  EXPECT_LE(statistics[0].average, statistics[0].max);
+}
@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/AsyncLogSink.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/base_sink.h>
+
+namespace
+{
+class CRecordingSink : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+  std::vector<std::string> GetMessages()
+  {
+    std::unique_lock lock(mutex_);
+    return m_messages;
+  }
+
+  std::atomic<bool> m_stall{false};
+  std::atomic<int> m_flushes{0};
+
+protected:
+  void sink_it_(const spdlog::details::log_msg& msg) override
+  {
+    while (m_stall)
+      std::this_thread::yield();
+    m_messages.emplace_back(msg.payload.data(), msg.payload.size());
+  }
+  void flush_() override { ++m_flushes; }
+
+private:
+  std::vector<std::string> m_messages;
+};
+
+void Log(CAsyncLogSink& sink, const std::string& message)
+{
+  sink.log(spdlog::details::log_msg("test", spdlog::level::info, message));
+}
+} // unnamed namespace
+
+TEST(TestAsyncLogSink, Synchronous)
+{
+  auto recorder = std::make_shared<CRecordingSink>();
+  CAsyncLogSink sink(recorder);
+
+  Log(sink, "message");
+  sink.flush();
+
+  ASSERT_EQ(1u, recorder->GetMessages().size());
+  EXPECT_EQ("message", recorder->GetMessages()[0]);
+  EXPECT_EQ(1, recorder->m_flushes);
+}
+
+TEST(TestAsyncLogSink, MultipleProducers)
+{
+  constexpr int THREADS = 4;
+  constexpr int MESSAGES = 2000;
+
+  auto recorder = std::make_shared<CRecordingSink>();
+  CAsyncLogSink sink(recorder);
+  sink.Start(256, CAsyncLogSink::OverflowPolicy::BLOCK);
+  EXPECT_TRUE(sink.IsAsync());
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; ++t)
+    threads.emplace_back(
+        [&sink, t]
+        {
+          for (int i = 0; i < MESSAGES; ++i)
+            Log(sink, std::to_string(t) + ":" + std::to_string(i));
+        });
+  for (auto& thread : threads)
+    thread.join();
+
+  sink.Stop();
+  EXPECT_FALSE(sink.IsAsync());
+  EXPECT_EQ(0u, sink.GetDropped());
+
+  // nothing lost and the order of each thread is kept
+  const auto messages = recorder->GetMessages();
+  ASSERT_EQ(static_cast<size_t>(THREADS * MESSAGES), messages.size());
+  std::vector<int> next(THREADS, 0);
+  for (const auto& message : messages)
+  {
+    const auto separator = message.find(':');
+    const int t = std::stoi(message.substr(0, separator));
+    EXPECT_EQ(next[t]++, std::stoi(message.substr(separator + 1)));
+  }
+}
+
+TEST(TestAsyncLogSink, DropWhenFull)
+{
+  auto recorder = std::make_shared<CRecordingSink>();
+  CAsyncLogSink sink(recorder);
+  sink.Start(4, CAsyncLogSink::OverflowPolicy::DROP);
+
+  recorder->m_stall = true;
+  for (int i = 0; i < 100; ++i)
+    Log(sink, "message");
+  EXPECT_GT(sink.GetDropped(), 0u);
+
+  recorder->m_stall = false;
+  sink.Stop();
+
+  // delivered messages plus the report about the dropped ones
+  const auto messages = recorder->GetMessages();
+  EXPECT_EQ(100 - sink.GetDropped() + 1, messages.size());
+  EXPECT_NE(std::string::npos, messages.back().find("dropped"));
+}
@@ -13,7 +13,12 @@
 #include "utils/XTimeUtils.h"
 
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -211,3 +216,140 @@ TEST_F(TestJobManager, IsProcessing)
 
   job->FinishAndStopBlocking();
 }
+
+TEST_F(TestJobManager, WorkStealingAddJob)
+{
+  CServiceBroker::GetJobManager()->SetWorkStealing(true);
+  EXPECT_TRUE(CServiceBroker::GetJobManager()->IsWorkStealing());
+
+  Flags* flags = new Flags();
+  ReallyDumbJob* job = new ReallyDumbJob(flags);
+  CServiceBroker::GetJobManager()->AddJob(job, nullptr);
+  ASSERT_TRUE(poll([flags]() -> bool { return flags->finished; }));
+  delete flags;
+}
+
+TEST_F(TestJobManager, WorkStealingCancelJob)
+{
+  CServiceBroker::GetJobManager()->SetWorkStealing(true);
+
+  Flags* flags = new Flags();
+  DummyJob* job = new DummyJob(flags);
+  const unsigned int id = CServiceBroker::GetJobManager()->AddJob(job, nullptr);
+
+  ASSERT_TRUE(poll([flags]() -> bool { return flags->started; }));
+  CServiceBroker::GetJobManager()->CancelJob(id);
+  flags->lingerAtWork = false;
+
+  ASSERT_TRUE(poll([flags]() -> bool { return flags->finished; }));
+  EXPECT_TRUE(flags->wasCanceled);
+  delete flags;
+}
+
+TEST_F(TestJobManager, WorkStealingPauseLowPriorityJob)
+{
+  CServiceBroker::GetJobManager()->SetWorkStealing(true);
+
+  JobControlPackage package;
+  BroadcastingJob* job(WaitForJobToStartProcessing(CJob::PRIORITY_LOW_PAUSABLE, package));
+
+  EXPECT_TRUE(CServiceBroker::GetJobManager()->IsProcessing(CJob::PRIORITY_LOW_PAUSABLE));
+  CServiceBroker::GetJobManager()->PauseJobs();
+  EXPECT_FALSE(CServiceBroker::GetJobManager()->IsProcessing(CJob::PRIORITY_LOW_PAUSABLE));
+  CServiceBroker::GetJobManager()->UnPauseJobs();
+  EXPECT_TRUE(CServiceBroker::GetJobManager()->IsProcessing(CJob::PRIORITY_LOW_PAUSABLE));
+
+  job->FinishAndStopBlocking();
+}
+
+TEST_F(TestJobManager, SwitchSchedulingWithQueuedJobs)
+{
+  CServiceBroker::GetJobManager()->PauseJobs();
+
+  std::atomic<int> done{0};
+  for (int i = 0; i < 20; ++i)
+    CServiceBroker::GetJobManager()->Submit([&done] { ++done; }, CJob::PRIORITY_LOW_PAUSABLE);
+
+  CServiceBroker::GetJobManager()->SetWorkStealing(true);
+  CServiceBroker::GetJobManager()->SetWorkStealing(false);
+  CServiceBroker::GetJobManager()->SetWorkStealing(true);
+  CServiceBroker::GetJobManager()->UnPauseJobs();
+
+  ASSERT_TRUE(poll([&done]() -> bool { return done == 20; }));
+}
+
+TEST_F(TestJobManager, WorkStealingStealsOldestJobFirst)
+{
+  const auto jobManager = CServiceBroker::GetJobManager();
+  jobManager->SetWorkStealing(true);
+
+  // shared with the jobs, which may outlive the test if it fails
+  struct State
+  {
+    std::mutex mutex;
+    std::vector<int> order;
+    std::atomic<bool> stolen{false};
+  };
+  auto state = std::make_shared<State>();
+  constexpr int jobs = 10;
+
+  // follow-up jobs are queued on the lane of the worker, which stays busy until others stole them
+  // all. With one processing slot left for pausable jobs they're stolen one after another.
+  jobManager->Submit(
+      [jobManager, state]
+      {
+        for (int i = 0; i < jobs; ++i)
+        {
+          jobManager->Submit(
+              [state, i]
+              {
+                std::unique_lock lock(state->mutex);
+                state->order.push_back(i);
+              },
+              CJob::PRIORITY_LOW_PAUSABLE);
+        }
+        state->stolen = poll(
+            [&state]() -> bool
+            {
+              std::unique_lock lock(state->mutex);
+              return state->order.size() == jobs;
+            });
+      },
+      CJob::PRIORITY_LOW_PAUSABLE);
+
+  ASSERT_TRUE(poll([&state]() -> bool { return state->stolen; }));
+
+  std::unique_lock lock(state->mutex);
+  std::vector<int> expected(jobs);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(expected, state->order);
+}
+
+TEST_F(TestJobManager, Statistics)
+{
+  Flags* flags = new Flags();
+  CServiceBroker::GetJobManager()->AddJob(new ReallyDumbJob(flags), nullptr);
+  ASSERT_TRUE(poll([flags]() -> bool { return flags->finished; }));
+
+  const CJobTypeStatistics& stats = CServiceBroker::GetJobManager()->GetStatistics().GetType("");
+  ASSERT_TRUE(poll([&stats]() -> bool { return stats.m_completed == 1; }));
+  EXPECT_EQ(0, stats.m_queued);
+  EXPECT_EQ(0, stats.m_processing);
+  EXPECT_EQ(1u, stats.m_wait.GetCount());
+  EXPECT_EQ(1u, stats.m_run.GetCount());
+  delete flags;
+}
+
+TEST(TestJobLatencyHistogram, Percentiles)
+{
+  CJobLatencyHistogram histogram;
+  for (int i = 0; i < 99; ++i)
+    histogram.Add(std::chrono::microseconds(100));
+  histogram.Add(std::chrono::microseconds(100000));
+
+  EXPECT_EQ(100u, histogram.GetCount());
+  EXPECT_EQ(100000u, histogram.GetMaxUs());
+  EXPECT_EQ(127u, histogram.GetPercentileUs(50));
+  EXPECT_EQ(127u, histogram.GetPercentileUs(95));
+  EXPECT_EQ(100000u, histogram.GetPercentileUs(100));
+}
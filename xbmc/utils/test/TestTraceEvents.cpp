@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/JSONVariantParser.h"
+#include "utils/TraceEvents.h"
+#include "utils/Variant.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using KODI::UTILS::CTraceRecorder;
+using KODI::UTILS::CTraceScope;
+
+namespace
+{
+CVariant GetTrace()
+{
+  CVariant trace;
+  EXPECT_TRUE(CJSONVariantParser::Parse(CTraceRecorder::GetInstance().Serialize(), trace));
+  return trace;
+}
+
+const CVariant* FindEvent(const CVariant& trace, const std::string& name)
+{
+  for (auto it = trace["traceEvents"].begin_array(); it != trace["traceEvents"].end_array(); ++it)
+  {
+    if ((*it)["name"].asString() == name)
+      return &*it;
+  }
+  return nullptr;
+}
+} // unnamed namespace
+
+TEST(TestTraceEvents, NotCapturing)
+{
+  auto& recorder = CTraceRecorder::GetInstance();
+  recorder.Start();
+  recorder.Stop("special://temp/trace.json");
+
+  {
+    CTraceScope scope("test", "NotCapturing");
+  }
+
+  EXPECT_EQ(nullptr, FindEvent(GetTrace(), "NotCapturing"));
+}
+
+TEST(TestTraceEvents, Scopes)
+{
+  auto& recorder = CTraceRecorder::GetInstance();
+  recorder.Start();
+  EXPECT_TRUE(recorder.IsCapturing());
+
+  {
+    CTraceScope outer("test", "Outer");
+    CTraceScope inner("test", "Inner");
+  }
+  std::thread([] { CTraceScope scope("test", "OtherThread"); }).join();
+
+  const CVariant trace = GetTrace();
+  const CVariant* outer = FindEvent(trace, "Outer");
+  const CVariant* inner = FindEvent(trace, "Inner");
+  const CVariant* other = FindEvent(trace, "OtherThread");
+  ASSERT_NE(nullptr, outer);
+  ASSERT_NE(nullptr, inner);
+  ASSERT_NE(nullptr, other);
+
+  EXPECT_EQ("X", (*outer)["ph"].asString());
+  EXPECT_EQ("test", (*outer)["cat"].asString());
+  EXPECT_LE((*outer)["ts"].asInteger(), (*inner)["ts"].asInteger());
+  EXPECT_GE((*outer)["dur"].asInteger(), (*inner)["dur"].asInteger());
+  EXPECT_EQ((*outer)["tid"].asInteger(), (*inner)["tid"].asInteger());
+  EXPECT_NE((*outer)["tid"].asInteger(), (*other)["tid"].asInteger());
+
+  const CVariant* threadName = FindEvent(trace, "thread_name");
+  ASSERT_NE(nullptr, threadName);
+  EXPECT_EQ("M", (*threadName)["ph"].asString());
+
+  // a new capture starts empty
+  recorder.Start();
+  EXPECT_EQ(nullptr, FindEvent(GetTrace(), "Outer"));
+  recorder.Stop("special://temp/trace.json");
+}
+
+TEST(TestTraceEvents, RingBuffer)
+{
+  auto& recorder = CTraceRecorder::GetInstance();
+  recorder.Start();
+
+  for (size_t i = 0; i < CTraceRecorder::EVENTS_PER_THREAD + 10; ++i)
+    CTraceScope scope("test", "Loop");
+
+  const CVariant trace = GetTrace();
+  size_t count = 0;
+  for (auto it = trace["traceEvents"].begin_array(); it != trace["traceEvents"].end_array(); ++it)
+  {
+    if ((*it)["name"].asString() == "Loop")
+      ++count;
+  }
+  EXPECT_EQ(CTraceRecorder::EVENTS_PER_THREAD, count);
+  recorder.Stop("special://temp/trace.json");
+}
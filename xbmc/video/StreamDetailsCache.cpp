@@ -0,0 +1,429 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "StreamDetailsCache.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Archive.h"
+#include "utils/Digest.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace KODI::VIDEO;
+using namespace XFILE;
+
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr int CACHE_VERSION = 1;
+
+// enough to cover the headers of common containers, which change with any remux
+constexpr size_t FINGERPRINT_HEAD_SIZE = 64 * 1024;
+} // unnamed namespace
+
+CStreamDetailsCache::CProbeLock::CProbeLock(CStreamDetailsCache& cache, std::string path)
+  : m_cache(cache), m_path(std::move(path))
+{
+  if (m_cache.IsEnabled())
+    m_cache.LockProbe(m_path);
+  else
+    m_path.clear();
+}
+
+CStreamDetailsCache::CProbeLock::~CProbeLock()
+{
+  if (!m_path.empty())
+    m_cache.UnlockProbe(m_path);
+}
+
+CStreamDetailsCache::CStreamDetailsCache(std::string path, unsigned int maxFiles)
+  : m_path(std::move(path)), m_maxFiles(maxFiles)
+{
+  URIUtils::AddSlashAtEnd(m_path);
+}
+
+CStreamDetailsCache& CStreamDetailsCache::GetInstance()
+{
+  static CStreamDetailsCache cache("special://temp/streamdetails/", 0);
+  return cache;
+}
+
+void CStreamDetailsCache::Configure(const std::string& path, unsigned int maxFiles)
+{
+  std::vector<std::string> evicted;
+  std::unique_lock lock(m_section);
+  m_maxFiles = maxFiles;
+
+  std::string newPath(path);
+  URIUtils::AddSlashAtEnd(newPath);
+  if (newPath != m_path)
+  {
+    m_path = std::move(newPath);
+    m_loaded = false;
+    m_lru.clear();
+    m_entries.clear();
+  }
+
+  if (m_loaded)
+    evicted = Evict();
+  lock.unlock();
+
+  DeleteFiles(evicted);
+}
+
+CStreamDetailsCache::Fingerprint CStreamDetailsCache::GetFingerprint(const std::string& path)
+{
+  Fingerprint fingerprint;
+
+  struct __stat64 st = {};
+  if (CFile::Stat(path, &st) != 0 || st.st_size <= 0)
+    return fingerprint;
+
+  CFile file;
+  if (!file.Open(path, READ_NO_CACHE))
+    return fingerprint;
+
+  std::vector<uint8_t> head(
+      static_cast<size_t>(std::min<int64_t>(st.st_size, FINGERPRINT_HEAD_SIZE)));
+  size_t pos = 0;
+  while (pos < head.size())
+  {
+    const ssize_t read = file.Read(head.data() + pos, head.size() - pos);
+    if (read <= 0)
+      break;
+    pos += read;
+  }
+
+  if (pos != head.size())
+    return fingerprint;
+
+  fingerprint.size = st.st_size;
+  fingerprint.mtime = st.st_mtime;
+  fingerprint.head = CDigest::Calculate(CDigest::Type::MD5, head.data(), head.size());
+  return fingerprint;
+}
+
+bool CStreamDetailsCache::Get(const std::string& path,
+                              const Fingerprint& fingerprint,
+                              Record& record)
+{
+  if (!IsEnabled() || !fingerprint.IsValid())
+    return false;
+
+  Load();
+
+  const std::string key = GetKey(path);
+  std::string file;
+  {
+    std::unique_lock lock(m_section);
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+      ++m_stats.misses;
+      return false;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    file = GetFile(key);
+  }
+
+  Fingerprint storedFingerprint;
+  Record storedRecord;
+  if (!Read(file, path, storedFingerprint, storedRecord))
+  {
+    bool erased = false;
+    {
+      std::unique_lock lock(m_section);
+      ++m_stats.misses;
+      erased = Erase(key);
+    }
+    if (erased)
+      CFile::Delete(file);
+    return false;
+  }
+
+  std::unique_lock lock(m_section);
+  // the record is replaced once the changed file is probed again
+  if (storedFingerprint != fingerprint)
+  {
+    ++m_stats.stale;
+    return false;
+  }
+
+  ++m_stats.hits;
+  record = std::move(storedRecord);
+  return true;
+}
+
+bool CStreamDetailsCache::Store(const std::string& path,
+                                const Fingerprint& fingerprint,
+                                const Record& record)
+{
+  if (!fingerprint.IsValid())
+    return false;
+
+  Load();
+
+  const std::string key = GetKey(path);
+  std::string file;
+  std::string tmpFile;
+  {
+    std::unique_lock lock(m_section);
+    if (!IsEnabled())
+      return false;
+
+    file = GetFile(key);
+    tmpFile = StringUtils::Format("{}.{}.tmp", file, ++m_tmpSerial);
+  }
+
+  // write to a temporary file first so a partially written record is never picked up
+  CFile stream;
+  if (!stream.OpenForWrite(tmpFile, true))
+  {
+    CLog::Log(LOGERROR, "CStreamDetailsCache::{} - Failed to write record \"{}\"", __FUNCTION__,
+              tmpFile);
+    return false;
+  }
+  {
+    CArchive ar(&stream, CArchive::store);
+    ar << CACHE_VERSION << path;
+    ar << fingerprint.size << fingerprint.mtime << fingerprint.head;
+    ar << record.duration << record.hasDetails;
+    // archiving only reads the details, it just shares the method with loading
+    ar << const_cast<CStreamDetails&>(record.details);
+    ar.Close();
+  }
+  stream.Close();
+
+  if (!CFile::Rename(tmpFile, file))
+  {
+    CLog::Log(LOGERROR, "CStreamDetailsCache::{} - Failed to rename record \"{}\"", __FUNCTION__,
+              tmpFile);
+    CFile::Delete(tmpFile);
+    return false;
+  }
+
+  std::vector<std::string> evicted;
+  std::unique_lock lock(m_section);
+  ++m_stats.writes;
+  const auto it = m_entries.find(key);
+  if (it != m_entries.end())
+  {
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return true;
+  }
+
+  m_lru.emplace_front(key);
+  m_entries.emplace(key, m_lru.begin());
+  evicted = Evict();
+  const bool stored = m_entries.contains(key);
+  lock.unlock();
+
+  DeleteFiles(evicted);
+  return stored;
+}
+
+void CStreamDetailsCache::Remove(const std::string& path)
+{
+  if (!IsEnabled())
+    return;
+
+  Load();
+
+  const std::string key = GetKey(path);
+  std::string file;
+  {
+    std::unique_lock lock(m_section);
+    if (!Erase(key))
+      return;
+    file = GetFile(key);
+  }
+
+  CFile::Delete(file);
+}
+
+CStreamDetailsCache::Stats CStreamDetailsCache::GetStats() const
+{
+  std::unique_lock lock(m_section);
+  return m_stats;
+}
+
+std::string CStreamDetailsCache::GetKey(const std::string& path)
+{
+  return CDigest::Calculate(CDigest::Type::MD5, path);
+}
+
+std::string CStreamDetailsCache::GetFile(const std::string& key) const
+{
+  return m_path + key + ".details";
+}
+
+bool CStreamDetailsCache::Read(const std::string& file,
+                               const std::string& path,
+                               Fingerprint& fingerprint,
+                               Record& record) const
+{
+  CFile stream;
+  if (!stream.Open(file))
+    return false;
+
+  try
+  {
+    CArchive ar(&stream, CArchive::load);
+    int version = 0;
+    std::string storedPath;
+    ar >> version;
+    if (version != CACHE_VERSION)
+      return false;
+
+    // guards against hash collisions
+    ar >> storedPath;
+    if (storedPath != path)
+      return false;
+
+    ar >> fingerprint.size >> fingerprint.mtime >> fingerprint.head;
+    ar >> record.duration >> record.hasDetails;
+    ar >> record.details;
+    ar.Close();
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::Log(LOGERROR, "CStreamDetailsCache::{} - Corrupt record \"{}\"", __FUNCTION__, file);
+    return false;
+  }
+
+  return true;
+}
+
+void CStreamDetailsCache::Load()
+{
+  std::string path;
+  {
+    std::unique_lock lock(m_section);
+    if (m_loaded || !IsEnabled())
+      return;
+    path = m_path;
+  }
+
+  // the directory is listed without holding the lock, if several threads get here the first one
+  // to finish fills the index
+  std::vector<std::string> keys;
+  std::vector<std::string> tmpFiles;
+  if (!CDirectory::Exists(path) && !CDirectory::Create(path))
+  {
+    CLog::Log(LOGERROR, "CStreamDetailsCache::{} - Failed to create cache directory \"{}\"",
+              __FUNCTION__, path);
+  }
+  else
+  {
+    CFileItemList items;
+    if (CDirectory::GetDirectory(path, items, "", DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_BYPASS_CACHE))
+    {
+      // there is no access time to restore, so the modification time orders the records initially
+      std::vector<std::shared_ptr<CFileItem>> files;
+      for (const auto& item : items)
+      {
+        if (!item->IsFolder())
+          files.emplace_back(item);
+      }
+      std::ranges::sort(files, [](const auto& a, const auto& b)
+                        { return a->GetDateTime() < b->GetDateTime(); });
+
+      for (const auto& item : files)
+      {
+        const std::string name = URIUtils::GetFileName(item->GetPath());
+        if (name.ends_with(".tmp"))
+          tmpFiles.emplace_back(item->GetPath());
+        else if (name.ends_with(".details"))
+          keys.emplace_back(name.substr(0, name.size() - 8));
+      }
+    }
+  }
+
+  std::vector<std::string> evicted;
+  {
+    std::unique_lock lock(m_section);
+    if (m_loaded || m_path != path)
+      return;
+
+    m_loaded = true;
+    for (auto& key : keys)
+    {
+      if (m_entries.contains(key))
+        continue;
+
+      m_lru.emplace_front(key);
+      m_entries.emplace(std::move(key), m_lru.begin());
+    }
+
+    CLog::Log(LOGDEBUG, "CStreamDetailsCache::{} - Found {} records in \"{}\"", __FUNCTION__,
+              m_entries.size(), m_path);
+
+    evicted = Evict();
+  }
+
+  // left over from interrupted writes, records are only written once the index is loaded
+  DeleteFiles(tmpFiles);
+  DeleteFiles(evicted);
+}
+
+std::vector<std::string> CStreamDetailsCache::Evict()
+{
+  std::vector<std::string> files;
+  while (m_lru.size() > m_maxFiles)
+  {
+    const std::string key = m_lru.back();
+    files.emplace_back(GetFile(key));
+    Erase(key);
+  }
+  return files;
+}
+
+bool CStreamDetailsCache::Erase(const std::string& key)
+{
+  const auto it = m_entries.find(key);
+  if (it == m_entries.end())
+    return false;
+
+  m_lru.erase(it->second);
+  m_entries.erase(it);
+  return true;
+}
+
+void CStreamDetailsCache::DeleteFiles(const std::vector<std::string>& files)
+{
+  for (const std::string& file : files)
+    CFile::Delete(file);
+}
+
+void CStreamDetailsCache::LockProbe(const std::string& path)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  m_probed.wait(lock, [this, &path] { return !m_probing.contains(path); });
+  m_probing.emplace(path);
+}
+
+void CStreamDetailsCache::UnlockProbe(const std::string& path)
+{
+  {
+    std::unique_lock lock(m_section);
+    m_probing.erase(path);
+  }
+  m_probed.notifyAll();
+}
@@ -0,0 +1,154 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+#include "utils/StreamDetails.h"
+
+#include <atomic>
+#include <list>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace KODI::VIDEO
+{
+
+/*!
+ \brief Persistent cache of the stream details and durations of probed video files.
+
+ Probing a file opens it and reads as much of it as it takes to find all streams, which is slow on
+ network shares. The results are stored per file together with a fingerprint of the file, made of
+ its size, modification time and a digest of its first bytes, and are only used while the
+ fingerprint still matches. The number of stored files is bounded, the least recently used ones are
+ evicted.
+ */
+class CStreamDetailsCache
+{
+public:
+  struct Fingerprint
+  {
+    int64_t size = 0;
+    int64_t mtime = 0;
+    std::string head; //!< digest of the first bytes of the file
+
+    bool IsValid() const { return size > 0 && !head.empty(); }
+    bool operator==(const Fingerprint& other) const = default;
+  };
+
+  struct Record
+  {
+    int duration = 0; //!< length of the file in ms, 0 if unknown
+    bool hasDetails = false; //!< whether the streams were probed or only the duration
+    CStreamDetails details; //!< streams of the file itself, without external subtitles
+  };
+
+  struct Stats
+  {
+    uint64_t hits = 0; //!< records served from the cache
+    uint64_t misses = 0; //!< lookups of files not in the cache
+    uint64_t stale = 0; //!< records not served as the file changed
+    uint64_t writes = 0; //!< records written to the cache
+  };
+
+  /*!
+   \brief Keeps other threads from probing a file at the same time, they wait for the first probe
+   to finish and then find its result in the cache.
+   */
+  class CProbeLock
+  {
+  public:
+    CProbeLock(CStreamDetailsCache& cache, std::string path);
+    ~CProbeLock();
+    CProbeLock(const CProbeLock&) = delete;
+    CProbeLock& operator=(const CProbeLock&) = delete;
+
+  private:
+    CStreamDetailsCache& m_cache;
+    std::string m_path;
+  };
+
+  CStreamDetailsCache(std::string path, unsigned int maxFiles);
+
+  static CStreamDetailsCache& GetInstance();
+
+  /*!
+   \brief Change location and size limit of the cache. Changing the location drops the index.
+   \param maxFiles maximum number of stored records, 0 disables the cache
+   */
+  void Configure(const std::string& path, unsigned int maxFiles);
+
+  bool IsEnabled() const { return m_maxFiles > 0; }
+
+  /*!
+   \brief Get the fingerprint of a file, which costs a stat and a single small read.
+   \return the fingerprint, invalid if the file can't be fingerprinted and mustn't be cached
+   */
+  static Fingerprint GetFingerprint(const std::string& path);
+
+  /*!
+   \brief Get the stored record of a file.
+   \param fingerprint current fingerprint of the file
+   \return true if a record with a matching fingerprint was found
+   */
+  bool Get(const std::string& path, const Fingerprint& fingerprint, Record& record);
+
+  /*!
+   \brief Store the record of a file.
+   \param fingerprint fingerprint of the file taken before it was probed
+   \sa GetFingerprint
+   */
+  bool Store(const std::string& path, const Fingerprint& fingerprint, const Record& record);
+
+  void Remove(const std::string& path);
+
+  Stats GetStats() const;
+
+private:
+  static std::string GetKey(const std::string& path);
+  std::string GetFile(const std::string& key) const;
+
+  bool Read(const std::string& file,
+            const std::string& path,
+            Fingerprint& fingerprint,
+            Record& record) const;
+
+  /*!
+   \brief Fill the index from the records in the cache directory, once. Must be called without
+   holding the lock, the directory is listed outside of it.
+   */
+  void Load();
+
+  /*!
+   \brief Drop the least recently used records over the limit from the index.
+   \return the record files to delete once the lock is released
+   */
+  std::vector<std::string> Evict();
+  bool Erase(const std::string& key);
+  static void DeleteFiles(const std::vector<std::string>& files);
+
+  void LockProbe(const std::string& path);
+  void UnlockProbe(const std::string& path);
+
+  mutable CCriticalSection m_section;
+  std::string m_path;
+  std::atomic<unsigned int> m_maxFiles;
+  bool m_loaded = false;
+  uint64_t m_tmpSerial = 0;
+  std::list<std::string> m_lru; //!< keys, most recently used first
+  std::unordered_map<std::string, std::list<std::string>::iterator> m_entries;
+  std::unordered_set<std::string> m_probing; //!< paths of the files being probed
+  XbmcThreads::ConditionVariable m_probed;
+  Stats m_stats;
+};
+
+} // namespace KODI::VIDEO
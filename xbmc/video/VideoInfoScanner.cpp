@@ -187,6 +187,8 @@ CVideoInfoScanner::CVideoInfoScanner()
 
 CVideoInfoScanner::~CVideoInfoScanner()
 {
+  ++*m_generation;
+
   // Clear cache for all used scrapers
   for (auto& [_, scraper] : m_scraperCache)
     scraper->ClearCache();
@@ -195,6 +197,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
   void CVideoInfoScanner::Process()
   {
     m_bStop = false;
+    ++*m_generation;
 
     try
     {
@@ -296,6 +299,7 @@ CVideoInfoScanner::~CVideoInfoScanner()
     }
 
     m_bRunning = false;
+    ++*m_generation;
     CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
                                                        "OnScanFinished");
 
@@ -346,6 +350,13 @@ CVideoInfoScanner::~CVideoInfoScanner()
       m_database.Interrupt();
 
     m_bStop = true;
+    ++*m_generation;
+  }
+
+  std::function<bool()> CVideoInfoScanner::GetCancelCheck() const
+  {
+    return [generation = m_generation, current = m_generation->load()]
+    { return *generation != current; };
   }
 
   bool CVideoInfoScanner::DoScan(const std::string& strDirectory)
@@ -648,6 +659,24 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
     m_database.Open();
 
+    // probe the new files in the background while they're looked up
+    if ((content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS) &&
+        CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+            CSettings::SETTING_MYVIDEOS_EXTRACTFLAGS))
+    {
+      std::vector<std::string> paths;
+      for (const auto& item : items)
+      {
+        if (item->IsFolder() || !IsVideo(*item) || item->IsNFO() || PLAYLIST::IsPlayList(*item))
+          continue;
+
+        if (content == ContentType::MOVIES ? !m_database.HasMovieInfo(item->GetDynPath())
+                                           : !m_database.HasMusicVideoInfo(item->GetPath()))
+          paths.emplace_back(item->GetDynPath());
+      }
+      CDVDFileInfo::PrewarmStreamDetails(std::move(paths), GetCancelCheck());
+    }
+
     bool FoundSomeInfo = false;
     std::vector<int> seenPaths;
     seenPaths.reserve(items.Size());
@@ -2058,6 +2087,21 @@ CVideoInfoScanner::~CVideoInfoScanner()
     for (const auto& file : files)
       episodeMap[file.strPath]++;
 
+    // probe the new files in the background while their episodes are looked up
+    if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+            CSettings::SETTING_MYVIDEOS_EXTRACTFLAGS))
+    {
+      std::vector<std::string> paths;
+      std::set<std::string> seen;
+      for (const auto& file : files)
+      {
+        if (m_database.GetEpisodeId(file.strPath, file.iEpisode, file.iSeason) < 0 &&
+            seen.insert(file.strPath).second)
+          paths.emplace_back(file.strPath);
+      }
+      CDVDFileInfo::PrewarmStreamDetails(std::move(paths), GetCancelCheck());
+    }
+
     int iMax = files.size();
     int iCurr = 1;
     for (EPISODELIST::iterator file = files.begin(); file != files.end(); ++file)
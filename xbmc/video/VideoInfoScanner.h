@@ -16,6 +16,9 @@
 #include "utils/Artwork.h"
 #include "utils/RegExp.h"
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -324,8 +327,15 @@ namespace KODI::VIDEO
     std::pair<InfoType, std::unique_ptr<IVideoInfoTagLoader>> ReadInfoTag(
         CFileItem& item, const ADDON::ScraperPtr& scraper, bool lookInFolder, bool resetTag);
 
+    /*! \brief Get a check telling whether background work started now should stop, which is the
+     case once the current scan stops or finishes, or the scanner is destroyed.
+     */
+    std::function<bool()> GetCancelCheck() const;
+
     bool m_bStop;
     bool m_scanAll;
+    std::shared_ptr<std::atomic<unsigned int>> m_generation{
+        std::make_shared<std::atomic<unsigned int>>(0)}; //!< bumped when a scan starts or ends
 
     SimilarVideoScanAction m_similarVideoAction{SimilarVideoScanAction::NONE};
     bool m_ignoreVideoExtras{false};
@@ -0,0 +1,175 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/StreamDetails.h"
+#include "video/StreamDetailsCache.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+using namespace XFILE;
+
+namespace
+{
+constexpr const char* CACHE_PATH = "special://temp/streamdetailscachetest/";
+constexpr const char* MEDIA_PATH = "special://temp/streamdetailscachetest-media/";
+
+std::string WriteMedia(const std::string& name, const std::string& content)
+{
+  CDirectory::Create(MEDIA_PATH);
+  const std::string path = MEDIA_PATH + name;
+  CFile file;
+  if (file.OpenForWrite(path, true))
+    file.Write(content.data(), content.size());
+  return path;
+}
+
+CStreamDetailsCache::Fingerprint MakeFingerprint(int64_t size)
+{
+  CStreamDetailsCache::Fingerprint fingerprint;
+  fingerprint.size = size;
+  fingerprint.mtime = 1;
+  fingerprint.head = "head";
+  return fingerprint;
+}
+
+CStreamDetailsCache::Record MakeRecord(int duration)
+{
+  CStreamDetailsCache::Record record;
+  record.duration = duration;
+  record.hasDetails = true;
+
+  auto* video = new CStreamDetailVideo();
+  video->m_strCodec = "hevc";
+  video->m_iWidth = 3840;
+  video->m_iHeight = 2160;
+  video->m_iDuration = duration / 1000;
+  video->m_strHdrType = "hdr10";
+  record.details.AddStream(video);
+
+  auto* audio = new CStreamDetailAudio();
+  audio->m_strCodec = "eac3";
+  audio->m_iChannels = 6;
+  audio->m_strLanguage = "eng";
+  record.details.AddStream(audio);
+
+  record.details.DetermineBestStreams();
+  return record;
+}
+} // namespace
+
+class TestStreamDetailsCache : public ::testing::Test
+{
+protected:
+  void TearDown() override
+  {
+    CDirectory::RemoveRecursive(CACHE_PATH);
+    CDirectory::RemoveRecursive(MEDIA_PATH);
+  }
+};
+
+TEST_F(TestStreamDetailsCache, Fingerprint)
+{
+  const std::string a = WriteMedia("a.mkv", std::string(100000, 'a'));
+  const std::string b = WriteMedia("b.mkv", std::string(100000, 'a'));
+  const std::string c = WriteMedia("c.mkv", std::string(100000, 'c'));
+
+  const CStreamDetailsCache::Fingerprint fingerprint = CStreamDetailsCache::GetFingerprint(a);
+  ASSERT_TRUE(fingerprint.IsValid());
+  EXPECT_EQ(100000, fingerprint.size);
+  EXPECT_EQ(fingerprint.head, CStreamDetailsCache::GetFingerprint(b).head);
+  EXPECT_NE(fingerprint.head, CStreamDetailsCache::GetFingerprint(c).head);
+
+  EXPECT_FALSE(CStreamDetailsCache::GetFingerprint(WriteMedia("empty.mkv", "")).IsValid());
+  EXPECT_FALSE(CStreamDetailsCache::GetFingerprint(std::string(MEDIA_PATH) + "none.mkv").IsValid());
+}
+
+TEST_F(TestStreamDetailsCache, StoreAndGet)
+{
+  CStreamDetailsCache cache(CACHE_PATH, 10);
+  const std::string path = WriteMedia("movie.mkv", "not really a movie");
+  const CStreamDetailsCache::Fingerprint fingerprint = CStreamDetailsCache::GetFingerprint(path);
+  ASSERT_TRUE(cache.Store(path, fingerprint, MakeRecord(5400000)));
+
+  CStreamDetailsCache::Record record;
+  ASSERT_TRUE(cache.Get(path, CStreamDetailsCache::GetFingerprint(path), record));
+  EXPECT_EQ(5400000, record.duration);
+  EXPECT_TRUE(record.hasDetails);
+  EXPECT_EQ(MakeRecord(5400000).details, record.details);
+  EXPECT_EQ(3840, record.details.GetVideoWidth());
+  EXPECT_EQ("eac3", record.details.GetAudioCodec());
+
+  EXPECT_FALSE(cache.Get(std::string(MEDIA_PATH) + "other.mkv", fingerprint, record));
+
+  const CStreamDetailsCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_EQ(1u, stats.writes);
+}
+
+TEST_F(TestStreamDetailsCache, ChangedFileIsStale)
+{
+  CStreamDetailsCache cache(CACHE_PATH, 10);
+  const std::string path = WriteMedia("movie.mkv", "first version");
+  ASSERT_TRUE(cache.Store(path, CStreamDetailsCache::GetFingerprint(path), MakeRecord(1000)));
+
+  // same size, likely even the same modification time
+  WriteMedia("movie.mkv", "other version");
+  CStreamDetailsCache::Record record;
+  EXPECT_FALSE(cache.Get(path, CStreamDetailsCache::GetFingerprint(path), record));
+  EXPECT_EQ(1u, cache.GetStats().stale);
+
+  // files which can't be fingerprinted are never served
+  EXPECT_FALSE(cache.Get(path, {}, record));
+  EXPECT_FALSE(cache.Store(path, {}, MakeRecord(1000)));
+}
+
+TEST_F(TestStreamDetailsCache, PersistsAcrossInstances)
+{
+  const std::string path = "smb://server/share/movie.mkv";
+  {
+    CStreamDetailsCache cache(CACHE_PATH, 10);
+    ASSERT_TRUE(cache.Store(path, MakeFingerprint(123), MakeRecord(60000)));
+  }
+
+  CStreamDetailsCache cache(CACHE_PATH, 10);
+  CStreamDetailsCache::Record record;
+  ASSERT_TRUE(cache.Get(path, MakeFingerprint(123), record));
+  EXPECT_EQ(60000, record.duration);
+  EXPECT_EQ(2, record.details.GetStreamCount(CStreamDetail::VIDEO) +
+                   record.details.GetStreamCount(CStreamDetail::AUDIO));
+
+  cache.Remove(path);
+  EXPECT_FALSE(cache.Get(path, MakeFingerprint(123), record));
+}
+
+TEST_F(TestStreamDetailsCache, EvictsLeastRecentlyUsed)
+{
+  CStreamDetailsCache cache(CACHE_PATH, 2);
+  const std::string a = "nfs://server/export/a.mkv";
+  const std::string b = "nfs://server/export/b.mkv";
+  const std::string c = "nfs://server/export/c.mkv";
+
+  ASSERT_TRUE(cache.Store(a, MakeFingerprint(1), MakeRecord(1000)));
+  ASSERT_TRUE(cache.Store(b, MakeFingerprint(1), MakeRecord(1000)));
+  CStreamDetailsCache::Record record;
+  ASSERT_TRUE(cache.Get(a, MakeFingerprint(1), record));
+  ASSERT_TRUE(cache.Store(c, MakeFingerprint(1), MakeRecord(1000)));
+
+  EXPECT_TRUE(cache.Get(a, MakeFingerprint(1), record));
+  EXPECT_FALSE(cache.Get(b, MakeFingerprint(1), record));
+  EXPECT_TRUE(cache.Get(c, MakeFingerprint(1), record));
+
+  CStreamDetailsCache disabled(CACHE_PATH, 0);
+  EXPECT_FALSE(disabled.Store(a, MakeFingerprint(1), MakeRecord(1000)));
+  EXPECT_FALSE(disabled.Get(a, MakeFingerprint(1), record));
+}
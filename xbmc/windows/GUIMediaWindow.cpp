@@ -92,6 +92,7 @@ CGUIMediaWindow::CGUIMediaWindow(int id, const char *xmlFile)
   m_loadType = KEEP_IN_MEMORY;
   m_vecItems = new CFileItemList;
   m_unfilteredItems = new CFileItemList;
+  m_previewItems = std::make_unique<CFileItemList>();
   m_vecItems->SetPath("?");
   m_iLastControl = -1;
   m_canFilterAdvanced = false;
@@ -440,6 +441,19 @@ bool CGUIMediaWindow::OnMessage(CGUIMessage& message)
       return true;
     }
     break;
+  case GUI_MSG_DIRECTORY_ITEMS:
+    {
+      // show the items of a listing in progress, see GetDirectoryItems()
+      if (message.GetParam1() == m_previewListing && message.GetItem() && IsActive())
+      {
+        const auto batch = std::static_pointer_cast<CFileItemList>(message.GetItem());
+        m_previewItems->Append(*batch);
+        m_previewItems->Sort(SortBy::LABEL, SortOrder::ASCENDING);
+        m_viewControl.SetItems(*m_previewItems);
+      }
+      return true;
+    }
+
   case GUI_MSG_PLAYBACK_STARTED:
   case GUI_MSG_PLAYBACK_ENDED:
   case GUI_MSG_PLAYBACK_STOPPED:
@@ -2199,6 +2213,20 @@ bool CGUIMediaWindow::GetDirectoryItems(CURL &url, CFileItemList &items, bool us
     bool ret = true;
     XFILE::CGetDirectoryItems getItems(m_rootDir, url, items, useDir, true);
 
+    // large listings are shown while they are still coming in, the batches are passed to the GUI
+    // thread which keeps rendering while we wait
+    const int listing = ++m_previewListing;
+    const int window = GetID();
+    m_rootDir.SetItemsCallback(
+        [listing, window](const CFileItemList& batch)
+        {
+          auto items = std::make_shared<CFileItemList>();
+          items->Append(batch);
+          CGUIMessage msg(GUI_MSG_DIRECTORY_ITEMS, window, 0, listing);
+          msg.SetItem(std::move(items));
+          CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg, window);
+        });
+
     if (!CGUIDialogBusy::Wait(&getItems, 100, true))
     {
       // cancelled
@@ -2218,6 +2246,16 @@ bool CGUIMediaWindow::GetDirectoryItems(CURL &url, CFileItemList &items, bool us
     }
 
     m_rootDir.ReleaseDirImpl();
+    m_rootDir.SetItemsCallback(nullptr);
+
+    // drop batches still queued, the caller shows the complete listing
+    ++m_previewListing;
+    if (!m_previewItems->IsEmpty())
+    {
+      m_previewItems->Clear();
+      if (!ret)
+        m_viewControl.SetItems(*m_vecItems);
+    }
     return ret;
   }
   else
@@ -16,6 +16,7 @@
 #include "view/GUIViewControl.h"
 
 #include <atomic>
+#include <memory>
 
 class CFileItemList;
 class CGUIViewState;
@@ -180,6 +181,8 @@ protected:
   // current path and history
   CFileItemList* m_vecItems;
   CFileItemList* m_unfilteredItems;        ///< \brief items prior to filtering using FilterItems()
+  std::unique_ptr<CFileItemList> m_previewItems; ///< \brief items shown while the directory is listed
+  int m_previewListing = 0; ///< \brief listing the preview items belong to
   CDirectoryHistory m_history;
   std::unique_ptr<CGUIViewState> m_guiState;
   std::atomic_bool m_vecItemsUpdating = {false};